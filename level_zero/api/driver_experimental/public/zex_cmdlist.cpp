@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,4 +52,80 @@ zexCommandListAppendWriteToMemory(
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListGetLastMutableKernelLaunchId(
+    zex_command_list_handle_t hCommandList,
+    uint64_t *pCommandId) {
+    try {
+        {
+            if (nullptr == hCommandList || nullptr == pCommandId)
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return L0::CommandList::fromHandle(hCommandList)->getLastMutableKernelLaunchId(pCommandId);
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableKernelLaunch(
+    zex_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    const ze_group_count_t *pGroupCount) {
+    try {
+        {
+            if (nullptr == hCommandList)
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return L0::CommandList::fromHandle(hCommandList)->updateMutableKernelLaunch(commandId, pGroupCount);
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListImmediateBeginCapture(
+    zex_command_list_handle_t hCommandList) {
+    try {
+        {
+            if (nullptr == hCommandList)
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return L0::CommandList::fromHandle(hCommandList)->beginGraphCapture();
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListImmediateEndCapture(
+    zex_command_list_handle_t hCommandList,
+    ze_command_list_handle_t *phCapturedCommandList) {
+    try {
+        {
+            if (nullptr == hCommandList || nullptr == phCapturedCommandList)
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return L0::CommandList::fromHandle(hCommandList)->endGraphCapture(phCapturedCommandList);
+    } catch (ze_result_t &result) {
+        return result;
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    } catch (std::exception &) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+}
 } // namespace L0
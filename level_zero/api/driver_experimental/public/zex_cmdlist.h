@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,13 @@
 #include "level_zero/api/driver_experimental/public/zex_common.h"
 #include <level_zero/ze_api.h>
 
+///////////////////////////////////////////////////////////////////////////////
+// It indicates that kernel launches appended to a regular command list are
+// recorded so they can be updated in place with
+// `zexCommandListUpdateMutableKernelLaunch` without re-recording the list.
+// Can be set in `ze_command_list_flags_t`.
+constexpr uint32_t ZEX_COMMAND_LIST_FLAG_MUTABLE = ZE_BIT(30);
+
 namespace L0 {
 
 ZE_APIEXPORT ze_result_t ZE_APICALL
@@ -24,4 +31,101 @@ zexCommandListAppendWriteToMemory(
     zex_write_to_mem_desc_t *desc,
     void *ptr,
     uint64_t data);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Returns the identifier of the last kernel launch appended to a
+///        mutable command list
+///
+/// @details
+///     - The command list must be created with ::ZEX_COMMAND_LIST_FLAG_MUTABLE.
+///     - Identifiers stay valid until the command list is reset or destroyed.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_ARGUMENT
+///         + `nullptr == hCommandList` or `nullptr == pCommandId`
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + command list is not mutable
+///     - ::ZE_RESULT_ERROR_NOT_AVAILABLE
+///         + no kernel launch has been appended
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListGetLastMutableKernelLaunchId(
+    zex_command_list_handle_t hCommandList, ///< [in] handle of the command list
+    uint64_t *pCommandId                    ///< [out] identifier of the last kernel launch
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Updates a recorded kernel launch in place
+///
+/// @details
+///     - Re-captures the current argument values of the launched kernel, set
+///       with zeKernelSetArgumentValue, into the recorded dispatch.
+///     - If pGroupCount is not null, the thread group count of the dispatch is
+///       changed as well; otherwise the previous group count is kept.
+///     - The group size of the kernel must not change after the launch was
+///       appended.
+///     - The application must not call this function while the command list
+///       is executing.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_ARGUMENT
+///         + `nullptr == hCommandList` or unknown `commandId`
+///     - ::ZE_RESULT_ERROR_INVALID_GROUP_SIZE_DIMENSION
+///         + group size of the kernel changed since the launch was appended
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + command list is not mutable or the launch cannot be patched
+///           (indirect, cooperative, partitioned, stateful or implicit-args kernels)
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableKernelLaunch(
+    zex_command_list_handle_t hCommandList, ///< [in] handle of the command list
+    uint64_t commandId,                     ///< [in] identifier of the kernel launch
+    const ze_group_count_t *pGroupCount     ///< [in][optional] new thread group count
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Starts capturing appends of an immediate command list
+///
+/// @details
+///     - Until ::zexCommandListImmediateEndCapture is called, kernel launches,
+///       copies, fills, barriers and event operations appended to the
+///       immediate command list are recorded into a regular command list
+///       instead of being submitted.
+///     - Waits on events signaled earlier within the same capture are replaced
+///       with barriers in the recorded command list.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_ARGUMENT
+///         + `nullptr == hCommandList`
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + command list is not immediate
+///     - ::ZE_RESULT_ERROR_NOT_AVAILABLE
+///         + capture is already active
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListImmediateBeginCapture(
+    zex_command_list_handle_t hCommandList ///< [in] handle of the immediate command list
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Stops capturing appends of an immediate command list
+///
+/// @details
+///     - Returns the closed regular command list with the captured appends. It
+///       can be executed with zeCommandQueueExecuteCommandLists any number of
+///       times and must be destroyed with zeCommandListDestroy.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_ARGUMENT
+///         + `nullptr == hCommandList` or `nullptr == phCapturedCommandList`
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + command list is not immediate
+///     - ::ZE_RESULT_ERROR_NOT_AVAILABLE
+///         + capture is not active
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListImmediateEndCapture(
+    zex_command_list_handle_t hCommandList,         ///< [in] handle of the immediate command list
+    ze_command_list_handle_t *phCapturedCommandList ///< [out] handle of the captured regular command list
+);
 } // namespace L0
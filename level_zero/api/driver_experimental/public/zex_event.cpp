@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/stackvec.h"
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+#include "level_zero/core/source/event/event.h"
+
+namespace L0 {
+
+using EventsVec = StackVec<Event *, 16>;
+
+namespace {
+void getEventsFromHandles(uint32_t numEvents, ze_event_handle_t *phEvents, EventsVec &events) {
+    for (uint32_t i = 0; i < numEvents; i++) {
+        events.push_back(Event::fromHandle(phEvents[i]));
+    }
+}
+} // namespace
+
+ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    zex_event_wait_mode_t mode,
+    uint64_t timeout,
+    uint32_t *pSignaledIndex) {
+    if (mode != ZEX_EVENT_WAIT_MODE_ALL && mode != ZEX_EVENT_WAIT_MODE_ANY) {
+        return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    if (numEvents == 0 || phEvents == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    EventsVec events;
+    getEventsFromHandles(numEvents, phEvents, events);
+    return Event::hostSynchronizeMultiple(numEvents, events.data(), mode == ZEX_EVENT_WAIT_MODE_ALL, timeout, pSignaledIndex);
+}
+
+ze_result_t ZE_APICALL
+zexEventQueryKernelTimestampsMultiple(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    ze_kernel_timestamp_result_t *pResults) {
+    if (numEvents == 0 || phEvents == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    EventsVec events;
+    getEventsFromHandles(numEvents, phEvents, events);
+    return Event::queryKernelTimestampsMultiple(numEvents, events.data(), pResults);
+}
+
+} // namespace L0
+
+extern "C" {
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    zex_event_wait_mode_t mode,
+    uint64_t timeout,
+    uint32_t *pSignaledIndex) {
+    return L0::zexEventHostSynchronizeMultiple(numEvents, phEvents, mode, timeout, pSignaledIndex);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventQueryKernelTimestampsMultiple(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    ze_kernel_timestamp_result_t *pResults) {
+    return L0::zexEventQueryKernelTimestampsMultiple(numEvents, phEvents, pResults);
+}
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef _ZEX_EVENT_H
+#define _ZEX_EVENT_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Completion condition for waiting on multiple events
+typedef enum _zex_event_wait_mode_t {
+    ZEX_EVENT_WAIT_MODE_ALL = 0, ///< wait until all events are signaled
+    ZEX_EVENT_WAIT_MODE_ANY = 1, ///< wait until at least one event is signaled
+    ZEX_EVENT_WAIT_MODE_FORCE_UINT32 = 0x7fffffff
+
+} zex_event_wait_mode_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Event pool flag, events of the pool signaled from an in-order
+///        immediate command list are tracked by the list's counter instead of
+///        event packets. Such events must be waited on only after their signal
+///        has been appended.
+constexpr uint32_t ZEX_EVENT_POOL_FLAG_COUNTER_BASED = ZE_BIT(30);
+
+namespace L0 {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Waits on the host for multiple events at once
+///
+/// @details
+///     - Polls all events in a single loop that shares one timeout and one GPU
+///       hang check, instead of calling zeEventHostSynchronize per event.
+///     - With ::ZEX_EVENT_WAIT_MODE_ANY, returns as soon as one event is
+///       signaled and stores its index in pSignaledIndex.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_NOT_READY
+///         + timeout expired
+///     - ::ZE_RESULT_ERROR_DEVICE_LOST
+///     - ::ZE_RESULT_ERROR_INVALID_ARGUMENT
+///         + `0 == numEvents` or `nullptr == phEvents`
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + any of `phEvents` is null
+ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(
+    uint32_t numEvents,          ///< [in] number of events in phEvents
+    ze_event_handle_t *phEvents, ///< [in][range(0, numEvents)] events to wait on
+    zex_event_wait_mode_t mode,  ///< [in] completion condition
+    uint64_t timeout,            ///< [in] timeout in nanoseconds, same semantics as zeEventHostSynchronize
+    uint32_t *pSignaledIndex     ///< [out][optional] index of the signaled event in ::ZEX_EVENT_WAIT_MODE_ANY mode
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Queries kernel timestamps of multiple events at once
+///
+/// @details
+///     - Fills pResults with the same data zeEventQueryKernelTimestamp returns
+///       for each event, packets of multi-packet events are aggregated into a
+///       single result.
+///     - Entries of events which are not signaled yet are zeroed and
+///       ::ZE_RESULT_NOT_READY is returned, entries of the remaining events
+///       are still filled.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_NOT_READY
+///         + at least one event is not signaled
+///     - ::ZE_RESULT_ERROR_INVALID_ARGUMENT
+///         + `0 == numEvents`, `nullptr == phEvents` or `nullptr == pResults`
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + any of `phEvents` is null
+ze_result_t ZE_APICALL
+zexEventQueryKernelTimestampsMultiple(
+    uint32_t numEvents,                    ///< [in] number of events in phEvents
+    ze_event_handle_t *phEvents,           ///< [in][range(0, numEvents)] events to query
+    ze_kernel_timestamp_result_t *pResults ///< [out][range(0, numEvents)] timestamps of the events
+);
+
+} // namespace L0
+
+#endif // _ZEX_EVENT_H
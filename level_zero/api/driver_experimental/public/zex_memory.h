@@ -19,6 +19,18 @@
 // Can be set in `ze_host_mem_alloc_flags_t`.
 constexpr uint32_t ZEX_HOST_MEM_ALLOC_FLAG_USE_HOST_PTR = ZE_BIT(30);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Host memory NUMA placement descriptor. Can be passed in pNext of
+///        `ze_host_mem_alloc_desc_t` to place host memory on the given NUMA
+///        node instead of the node closest to the device.
+constexpr ze_structure_type_t ZEX_STRUCTURE_TYPE_HOST_MEM_ALLOC_NUMA_PLACEMENT_DESC = static_cast<ze_structure_type_t>(0x00030020);
+
+typedef struct _zex_host_mem_alloc_numa_placement_desc_t {
+    ze_structure_type_t stype = ZEX_STRUCTURE_TYPE_HOST_MEM_ALLOC_NUMA_PLACEMENT_DESC; ///< [in] type of this structure
+    const void *pNext = nullptr;                                                        ///< [in][optional] pointer to extension-specific structure
+    uint32_t numaNode = 0;                                                              ///< [in] NUMA node to place host memory on
+} zex_host_mem_alloc_numa_placement_desc_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 #ifndef ZEX_MEM_IPC_HANDLES_NAME
 /// @brief Multiple IPC handles driver extension name
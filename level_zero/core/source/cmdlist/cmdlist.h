@@ -48,6 +48,17 @@ struct CmdListReturnPoint {
     NEO::GraphicsAllocation *currentCmdBuffer = nullptr;
 };
 
+struct CmdListMutableKernelLaunch {
+    Kernel *kernel = nullptr;
+    void *walker = nullptr;
+    void *inlineData = nullptr;
+    void *indirectData = nullptr;
+    uint32_t inlineDataSize = 0u;
+    uint32_t indirectDataSize = 0u;
+    uint32_t groupSize[3] = {};
+    ze_group_count_t groupCount = {};
+};
+
 struct CommandList : _ze_command_list_handle_t {
     static constexpr uint32_t defaultNumIddsPerBlock = 64u;
     static constexpr uint32_t commandListimmediateIddsPerBlock = 1u;
@@ -147,6 +158,10 @@ struct CommandList : _ze_command_list_handle_t {
                                                     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) = 0;
 
     virtual void *asMutable() { return nullptr; };
+    virtual ze_result_t getLastMutableKernelLaunchId(uint64_t *pCommandId) = 0;
+    virtual ze_result_t updateMutableKernelLaunch(uint64_t commandId, const ze_group_count_t *pGroupCount) = 0;
+    virtual ze_result_t beginGraphCapture() = 0;
+    virtual ze_result_t endGraphCapture(ze_command_list_handle_t *phCapturedCommandList) = 0;
 
     virtual ze_result_t reserveSpace(size_t size, void **ptr) = 0;
     virtual ze_result_t reset() = 0;
@@ -362,6 +377,7 @@ struct CommandList : _ze_command_list_handle_t {
     NEO::CommandContainer commandContainer;
 
     CmdListReturnPoints returnPoints;
+    std::vector<CmdListMutableKernelLaunch> mutableKernelLaunches;
     NEO::StreamProperties requiredStreamState{};
     NEO::StreamProperties finalStreamState{};
     CommandsToPatch commandsToPatch{};
@@ -377,11 +393,14 @@ struct CommandList : _ze_command_list_handle_t {
 
     ze_context_handle_t hContext = nullptr;
     CommandQueue *cmdQImmediate = nullptr;
+    CommandList *graphCaptureCmdList = nullptr;
+    NEO::GraphicsAllocation *lastBarrierCmdBufferAllocation = nullptr;
     NEO::CommandStreamReceiver *csr = nullptr;
     Device *device = nullptr;
 
     size_t minimalSizeForBcsSplit = 4 * MemoryConstants::megaByte;
     size_t cmdListCurrentStartOffset = 0;
+    size_t lastBarrierCmdBufferOffset = 0;
     size_t maxFillPaternSizeForCopyEngine = 0;
 
     unsigned long numThreads = 1u;
@@ -396,6 +415,8 @@ struct CommandList : _ze_command_list_handle_t {
     uint32_t commandListPerThreadPrivateScratchSize = 0u;
     uint32_t partitionCount = 1;
     uint32_t defaultMocsIndex = 0;
+    uint32_t appendedBarriersCount = 0;
+    uint32_t programmedBarriersCount = 0;
 
     bool isFlushTaskSubmissionEnabled = false;
     bool isSyncModeQueue = false;
@@ -422,6 +443,8 @@ struct CommandList : _ze_command_list_handle_t {
     bool compactL3FlushEventPacket = false;
     bool dynamicHeapRequired = false;
     bool kernelWithAssertAppended = false;
+    bool mutableKernelLaunchesEnabled = false;
+    bool barrierElisionEnabled = false;
     bool dispatchCmdListBatchBufferAsPrimary = false;
     bool copyThroughLockedPtrEnabled = false;
     bool useOnlyGlobalTimestamps = false;
@@ -21,6 +21,7 @@ namespace NEO {
 enum class MemoryPool;
 enum class ImageType;
 class LogicalStateHelper;
+struct EncodeDispatchKernelArgs;
 } // namespace NEO
 
 namespace L0 {
@@ -171,6 +172,8 @@ struct CommandListCoreFamily : CommandListImp {
     ze_result_t appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent, bool relaxedOrderingAllowed, bool trackDependencies, bool signalInOrderCompletion) override;
     void appendWaitOnInOrderDependency(bool relaxedOrderingAllowed);
     void appendSignalInOrderDependencyTimestampPacket();
+    void appendWaitOnInOrderCounter(InOrderCounter &counter, uint32_t waitValue, bool relaxedOrderingAllowed);
+    uint32_t appendSignalInOrderCounter(bool signalScope);
     ze_result_t appendWriteGlobalTimestamp(uint64_t *dstptr, ze_event_handle_t hSignalEvent,
                                            uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
     ze_result_t appendMemoryCopyFromContext(void *dstptr, ze_context_handle_t hContextSrc, const void *srcptr,
@@ -181,6 +184,12 @@ struct CommandListCoreFamily : CommandListImp {
     void appendEventForProfilingAllWalkers(Event *event, bool beforeWalker, bool singlePacketEvent);
     ze_result_t addEventsToCmdList(uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingAllowed, bool trackDependencies);
 
+    bool isBarrierRedundant(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents);
+    ze_result_t getLastMutableKernelLaunchId(uint64_t *pCommandId) override;
+    ze_result_t updateMutableKernelLaunch(uint64_t commandId, const ze_group_count_t *pGroupCount) override;
+    ze_result_t beginGraphCapture() override;
+    ze_result_t endGraphCapture(ze_command_list_handle_t *phCapturedCommandList) override;
+
     ze_result_t reserveSpace(size_t size, void **ptr) override;
     ze_result_t reset() override;
     ze_result_t executeCommandListImmediate(bool performMigration) override;
@@ -266,6 +275,8 @@ struct CommandListCoreFamily : CommandListImp {
     void updateStreamPropertiesForFlushTaskDispatchFlags(Kernel &kernel, bool isCooperative, const ze_group_count_t *threadGroupDimensions, bool isIndirect);
     void updateStreamProperties(Kernel &kernel, bool isCooperative, const ze_group_count_t *threadGroupDimensions, bool isIndirect);
     void clearCommandsToPatch();
+    void storeMutableKernelLaunch(Kernel *kernel, const ze_group_count_t *threadGroupDimensions,
+                                  const NEO::EncodeDispatchKernelArgs &dispatchKernelArgs, const CmdListKernelLaunchParams &launchParams);
 
     size_t getTotalSizeForCopyRegion(const ze_copy_region_t *region, uint32_t pitch, uint32_t slicePitch);
     bool isAppendSplitNeeded(void *dstPtr, const void *srcPtr, size_t size, NEO::TransferDirection &directionOut);
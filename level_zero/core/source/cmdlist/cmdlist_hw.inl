@@ -43,6 +43,7 @@
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/event/event.h"
+#include "level_zero/core/source/event/in_order_counter.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/source/image/image.h"
 #include "level_zero/core/source/kernel/kernel.h"
@@ -104,6 +105,11 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     removeMemoryPrefetchAllocations();
     commandContainer.reset();
     clearCommandsToPatch();
+    mutableKernelLaunches.clear();
+    lastBarrierCmdBufferAllocation = nullptr;
+    lastBarrierCmdBufferOffset = 0;
+    appendedBarriersCount = 0;
+    programmedBarriersCount = 0;
 
     if (!isCopyOnly()) {
         printfKernelContainer.clear();
@@ -148,6 +154,11 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::initialize(Device *device, NEO
     this->commandListPreemptionMode = device->getDevicePreemptionMode();
     this->engineGroupType = engineGroupType;
     this->flags = flags;
+    this->mutableKernelLaunchesEnabled = (flags & ZEX_COMMAND_LIST_FLAG_MUTABLE) &&
+                                         this->cmdListType == CommandListType::TYPE_REGULAR &&
+                                         !isCopyOnly();
+    this->barrierElisionEnabled = this->cmdListType == CommandListType::TYPE_REGULAR &&
+                                  NEO::DebugManager.flags.EnableCommandListBarrierElision.get() == 1;
 
     auto &hwInfo = device->getHwInfo();
     auto neoDevice = device->getNEODevice();
@@ -273,6 +284,9 @@ inline ze_result_t CommandListCoreFamily<gfxCoreFamily>::executeCommandListImmed
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::close() {
+    PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintCommandListBarrierStatistics.get() && this->cmdListType == CommandListType::TYPE_REGULAR, stdout,
+                       "Command list %p closed, barriers appended: %u, barriers programmed: %u\n", this, appendedBarriersCount, programmedBarriersCount);
+
     commandContainer.removeDuplicatesFromResidencyContainer();
     if (this->dispatchCmdListBatchBufferAsPrimary) {
         commandContainer.endAlignedPrimaryBuffer();
@@ -436,6 +450,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsInd
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendEventReset(ze_event_handle_t hEvent) {
     auto event = Event::fromHandle(hEvent);
+    event->setCompletionTaskCount(0u);
+    // packets are cleared on GPU, the counter of a previous in-order signal must not report completion anymore
+    event->disableCounterBasedMode();
 
     NEO::Device *neoDevice = device->getNEODevice();
     uint32_t callId = 0;
@@ -2222,6 +2239,13 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t nu
             }
         }
 
+        if (event->isCounterBasedEvent()) {
+            if (event->getInOrderCounter() != this->inOrderCounter.get()) {
+                appendWaitOnInOrderCounter(*event->getInOrderCounter(), event->getInOrderCounterValue(), relaxedOrderingAllowed);
+            }
+            continue;
+        }
+
         commandContainer.addToResidencyContainer(&event->getAllocation(this->device));
         gpuAddr = event->getCompletionFieldGpuAddress(this->device);
         uint32_t packetsToWait = event->getPacketsInUse();
@@ -2274,6 +2298,50 @@ void CommandListCoreFamily<gfxCoreFamily>::appendSignalInOrderDependencyTimestam
     NEO::TimestampPacketHelper::nonStallingContextEndNodeSignal<GfxFamily>(*commandContainer.getCommandStream(), *this->timestampPacketContainer->peekNodes()[0], (this->partitionCount > 1));
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::appendWaitOnInOrderCounter(InOrderCounter &counter, uint32_t waitValue, bool relaxedOrderingAllowed) {
+    using COMPARE_OPERATION = typename GfxFamily::MI_SEMAPHORE_WAIT::COMPARE_OPERATION;
+
+    commandContainer.addToResidencyContainer(&counter.getAllocation());
+
+    if (relaxedOrderingAllowed) {
+        NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programConditionalDataMemBatchBufferStart(*commandContainer.getCommandStream(), 0, counter.getGpuAddress(), waitValue,
+                                                                                               NEO::CompareOperation::Less, true);
+    } else {
+        NEO::EncodeSemaphore<GfxFamily>::addMiSemaphoreWaitCommand(*commandContainer.getCommandStream(),
+                                                                   counter.getGpuAddress(),
+                                                                   waitValue,
+                                                                   COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD);
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+uint32_t CommandListCoreFamily<gfxCoreFamily>::appendSignalInOrderCounter(bool signalScope) {
+    auto counterValue = this->inOrderCounter->obtainNextValue();
+    auto gpuAddress = this->inOrderCounter->getGpuAddress();
+
+    commandContainer.addToResidencyContainer(&this->inOrderCounter->getAllocation());
+
+    if (isCopyOnly()) {
+        NEO::MiFlushArgs args{this->dummyBlitWa};
+        args.commandWithPostSync = true;
+        NEO::EncodeMiFlushDW<GfxFamily>::programWithWa(*commandContainer.getCommandStream(), gpuAddress, counterValue, args);
+        makeResidentDummyAllocation();
+    } else {
+        NEO::PipeControlArgs args;
+        args.dcFlushEnable = getDcFlushRequired(signalScope);
+        NEO::MemorySynchronizationCommands<GfxFamily>::addBarrierWithPostSyncOperation(
+            *commandContainer.getCommandStream(),
+            NEO::PostSyncMode::ImmediateData,
+            gpuAddress,
+            counterValue,
+            device->getNEODevice()->getRootDeviceEnvironment(),
+            args);
+    }
+
+    return counterValue;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::programSyncBuffer(Kernel &kernel, NEO::Device &device,
                                                                     const ze_group_count_t *threadGroupDimensions) {
@@ -2776,6 +2844,117 @@ void CommandListCoreFamily<gfxCoreFamily>::clearCommandsToPatch() {
     commandsToPatch.clear();
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::storeMutableKernelLaunch(Kernel *kernel, const ze_group_count_t *threadGroupDimensions,
+                                                                   const NEO::EncodeDispatchKernelArgs &dispatchKernelArgs, const CmdListKernelLaunchParams &launchParams) {
+    if (!this->mutableKernelLaunchesEnabled || launchParams.isBuiltInKernel || launchParams.isKernelSplitOperation) {
+        return;
+    }
+
+    CmdListMutableKernelLaunch launch{};
+    launch.kernel = kernel;
+
+    auto &kernelDescriptor = kernel->getKernelDescriptor();
+    bool patchable = !launchParams.isIndirect &&
+                     !launchParams.isCooperative &&
+                     !kernelDescriptor.kernelAttributes.flags.requiresImplicitArgs &&
+                     kernelDescriptor.payloadMappings.bindingTable.numEntries == 0 &&
+                     kernel->getSurfaceStateHeapDataSize() == 0 &&
+                     dispatchKernelArgs.outWalkerPtr != nullptr;
+    if (patchable) {
+        launch.walker = dispatchKernelArgs.outWalkerPtr;
+        launch.inlineData = dispatchKernelArgs.outInlineDataPtr;
+        launch.inlineDataSize = dispatchKernelArgs.outInlineDataSize;
+        launch.indirectData = dispatchKernelArgs.outIndirectDataPtr;
+        launch.indirectDataSize = dispatchKernelArgs.outIndirectDataSize;
+        launch.groupCount = *threadGroupDimensions;
+        auto groupSize = kernel->getGroupSize();
+        std::copy(groupSize, groupSize + 3, launch.groupSize);
+    }
+
+    mutableKernelLaunches.push_back(launch);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::getLastMutableKernelLaunchId(uint64_t *pCommandId) {
+    if (!this->mutableKernelLaunchesEnabled) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if (mutableKernelLaunches.empty()) {
+        return ZE_RESULT_ERROR_NOT_AVAILABLE;
+    }
+    *pCommandId = static_cast<uint64_t>(mutableKernelLaunches.size() - 1);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableKernelLaunch(uint64_t commandId, const ze_group_count_t *pGroupCount) {
+    using WALKER_TYPE = typename GfxFamily::WALKER_TYPE;
+
+    if (!this->mutableKernelLaunchesEnabled) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if (commandId >= mutableKernelLaunches.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto &launch = mutableKernelLaunches[static_cast<size_t>(commandId)];
+    if (launch.walker == nullptr) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto kernel = launch.kernel;
+    auto groupSize = kernel->getGroupSize();
+    if (!std::equal(groupSize, groupSize + 3, launch.groupSize)) {
+        return ZE_RESULT_ERROR_INVALID_GROUP_SIZE_DIMENSION;
+    }
+    if (kernel->getCrossThreadDataSize() != launch.inlineDataSize + launch.indirectDataSize) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (pGroupCount) {
+        launch.groupCount = *pGroupCount;
+    }
+
+    // the kernel may have been launched with other dimensions since this launch was recorded
+    kernel->patchGlobalOffset();
+    kernel->setGroupCount(launch.groupCount.groupCountX,
+                          launch.groupCount.groupCountY,
+                          launch.groupCount.groupCountZ);
+
+    auto crossThreadData = kernel->getCrossThreadData();
+    if (launch.inlineDataSize > 0) {
+        memcpy_s(launch.inlineData, launch.inlineDataSize, crossThreadData, launch.inlineDataSize);
+    }
+    if (launch.indirectDataSize > 0) {
+        memcpy_s(launch.indirectData, launch.indirectDataSize, ptrOffset(crossThreadData, launch.inlineDataSize), launch.indirectDataSize);
+    }
+
+    auto walker = reinterpret_cast<WALKER_TYPE *>(launch.walker);
+    walker->setThreadGroupIdXDimension(launch.groupCount.groupCountX);
+    walker->setThreadGroupIdYDimension(launch.groupCount.groupCountY);
+    walker->setThreadGroupIdZDimension(launch.groupCount.groupCountZ);
+
+    auto &residencyContainer = commandContainer.getResidencyContainer();
+    for (auto resource : kernel->getResidencyContainer()) {
+        if (std::find(residencyContainer.begin(), residencyContainer.end(), resource) == residencyContainer.end()) {
+            commandContainer.addToResidencyContainer(resource);
+        }
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::beginGraphCapture() {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::endGraphCapture(ze_command_list_handle_t *phCapturedCommandList) {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 inline size_t CommandListCoreFamily<gfxCoreFamily>::getTotalSizeForCopyRegion(const ze_copy_region_t *region, uint32_t pitch, uint32_t slicePitch) {
     if (region->depth > 1) {
@@ -2856,6 +3035,10 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendBarrier(ze_event_handle_t hSignalEvent,
                                                                 uint32_t numWaitEvents,
                                                                 ze_event_handle_t *phWaitEvents) {
+    appendedBarriersCount++;
+    if (isBarrierRedundant(hSignalEvent, numWaitEvents)) {
+        return ZE_RESULT_SUCCESS;
+    }
 
     ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents, false, true);
     if (ret) {
@@ -2887,9 +3070,27 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendBarrier(ze_event_handle_
     }
 
     appendSignalEventPostWalker(signalEvent);
+
+    auto commandStream = commandContainer.getCommandStream();
+    programmedBarriersCount++;
+    lastBarrierCmdBufferAllocation = commandStream->getGraphicsAllocation();
+    lastBarrierCmdBufferOffset = commandStream->getUsed();
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isBarrierRedundant(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents) {
+    if (!this->barrierElisionEnabled || hSignalEvent != nullptr || numWaitEvents > 0) {
+        return false;
+    }
+
+    // nothing was programmed since the previous barrier, so there is no new work to order
+    auto commandStream = commandContainer.getCommandStream();
+    return lastBarrierCmdBufferAllocation != nullptr &&
+           lastBarrierCmdBufferAllocation == commandStream->getGraphicsAllocation() &&
+           lastBarrierCmdBufferOffset == commandStream->getUsed();
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamily<gfxCoreFamily>::addFlushRequiredCommand(bool flushOperationRequired, Event *signalEvent) {
     if (isCopyOnly()) {
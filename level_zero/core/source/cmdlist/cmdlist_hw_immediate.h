@@ -147,8 +147,35 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
                                               uint32_t numWaitEvents,
                                               ze_event_handle_t *waitEventHandles, bool relaxedOrderingDispatch) override;
 
+    ze_result_t appendLaunchMultipleKernelsIndirect(uint32_t numKernels,
+                                                    const ze_kernel_handle_t *kernelHandles,
+                                                    const uint32_t *pNumLaunchArguments,
+                                                    const ze_group_count_t *pLaunchArgumentsBuffer,
+                                                    ze_event_handle_t hEvent,
+                                                    uint32_t numWaitEvents,
+                                                    ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) override;
+
+    ze_result_t appendMemAdvise(ze_device_handle_t hDevice,
+                                const void *ptr, size_t size,
+                                ze_memory_advice_t advice) override;
+
+    ze_result_t appendMemoryPrefetch(const void *ptr, size_t count) override;
+
+    ze_result_t appendWaitOnMemory(void *desc, void *ptr,
+                                   uint32_t data, ze_event_handle_t signalEventHandle) override;
+
+    ze_result_t appendWriteToMemory(void *desc, void *ptr,
+                                    uint64_t data) override;
+
+    ze_result_t appendQueryKernelTimestamps(uint32_t numEvents, ze_event_handle_t *phEvents, void *dstptr,
+                                            const size_t *pOffsets, ze_event_handle_t hSignalEvent,
+                                            uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
+
     ze_result_t hostSynchronize(uint64_t timeout) override;
 
+    ze_result_t beginGraphCapture() override;
+    ze_result_t endGraphCapture(ze_command_list_handle_t *phCapturedCommandList) override;
+
     MOCKABLE_VIRTUAL ze_result_t executeCommandListImmediateWithFlushTask(bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies);
     ze_result_t executeCommandListImmediateWithFlushTaskImpl(bool performMigration, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, CommandQueue *cmdQ);
 
@@ -175,9 +202,15 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     size_t getTransferThreshold(TransferType transferType);
     bool isBarrierRequired();
     bool isRelaxedOrderingDispatchAllowed(uint32_t numWaitEvents) const override;
+    bool isCounterBasedSignalEvent(ze_event_handle_t hSignalEvent) const;
+    ze_event_handle_t getSignalEventForAppend(ze_event_handle_t hSignalEvent) const;
+
+    template <typename AppendFuncT>
+    ze_result_t appendToGraphCapture(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, AppendFuncT appendFunc);
 
   protected:
     using BaseClass::deferredTimestampPackets;
+    using BaseClass::inOrderCounter;
     using BaseClass::timestampPacketContainer;
 
     void printKernelsPrintfOutput(bool hangDetected);
@@ -186,6 +219,8 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     MOCKABLE_VIRTUAL void checkAssert();
     ComputeFlushMethodType computeFlushMethod = nullptr;
     std::atomic<bool> dependenciesPresent{false};
+    std::vector<ze_event_handle_t> graphCaptureSignalEvents;
+    uint32_t graphCaptureAppendCount = 0;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
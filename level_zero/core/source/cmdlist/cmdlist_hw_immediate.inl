@@ -333,6 +333,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
     const CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
 
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendLaunchKernel(kernelHandle, threadGroupDimensions, hSignalEvent,
+                                                                 numCapturedWaitEvents, phCapturedWaitEvents, launchParams, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -348,7 +355,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     }
 
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(kernelHandle, threadGroupDimensions,
-                                                                        hSignalEvent, numWaitEvents, phWaitEvents,
+                                                                        getSignalEventForAppend(hSignalEvent), numWaitEvents, phWaitEvents,
                                                                         launchParams, relaxedOrderingDispatch);
     return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
 }
@@ -357,6 +364,13 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelIndirect(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t *pDispatchArgumentsBuffer,
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendLaunchKernelIndirect(kernelHandle, pDispatchArgumentsBuffer, hSignalEvent,
+                                                                         numCapturedWaitEvents, phCapturedWaitEvents, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -365,7 +379,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelInd
     }
 
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelIndirect(kernelHandle, pDispatchArgumentsBuffer,
-                                                                                hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+                                                                                getSignalEventForAppend(hSignalEvent), numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
     return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
 }
 
@@ -376,11 +390,17 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendBarrier(
     ze_event_handle_t *phWaitEvents) {
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendBarrier(hSignalEvent, numCapturedWaitEvents, phCapturedWaitEvents);
+        });
+    }
+
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace(numWaitEvents, false);
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
-    ret = CommandListCoreFamily<gfxCoreFamily>::appendBarrier(hSignalEvent, numWaitEvents, phWaitEvents);
+    ret = CommandListCoreFamily<gfxCoreFamily>::appendBarrier(getSignalEventForAppend(hSignalEvent), numWaitEvents, phWaitEvents);
 
     this->dependenciesPresent = true;
     return flushImmediate(ret, true, true, false, hSignalEvent);
@@ -394,6 +414,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendMemoryCopy(dstptr, srcptr, size, hSignalEvent,
+                                                               numCapturedWaitEvents, phCapturedWaitEvents, false, forceDisableCopyOnlyInOrderSignaling);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -416,11 +443,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     auto isSplitNeeded = this->isAppendSplitNeeded(dstptr, srcptr, size, direction);
     if (isSplitNeeded) {
         relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(1); // split generates more than 1 event
-        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, void *, const void *>(this, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, true, relaxedOrderingDispatch, direction, [&](void *dstptrParam, const void *srcptrParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
+        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, void *, const void *>(this, dstptr, srcptr, size, getSignalEventForAppend(hSignalEvent), numWaitEvents, phWaitEvents, true, relaxedOrderingDispatch, direction, [&](void *dstptrParam, const void *srcptrParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             return CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(dstptrParam, srcptrParam, sizeParam, hSignalEventParam, 0u, nullptr, relaxedOrderingDispatch, true);
         });
     } else {
-        ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(dstptr, srcptr, size, hSignalEvent,
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(dstptr, srcptr, size, getSignalEventForAppend(hSignalEvent),
                                                                      numWaitEvents, phWaitEvents, relaxedOrderingDispatch, forceDisableCopyOnlyInOrderSignaling);
     }
     return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
@@ -439,6 +466,14 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendMemoryCopyRegion(dstPtr, dstRegion, dstPitch, dstSlicePitch,
+                                                                     srcPtr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent,
+                                                                     numCapturedWaitEvents, phCapturedWaitEvents, false, forceDisableCopyOnlyInOrderSignaling);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -452,7 +487,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     auto isSplitNeeded = this->isAppendSplitNeeded(dstPtr, srcPtr, this->getTotalSizeForCopyRegion(dstRegion, dstPitch, dstSlicePitch), direction);
     if (isSplitNeeded) {
         relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(1); // split generates more than 1 event
-        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uint32_t, uint32_t>(this, dstRegion->originX, srcRegion->originX, dstRegion->width, hSignalEvent, numWaitEvents, phWaitEvents, true, relaxedOrderingDispatch, direction, [&](uint32_t dstOriginXParam, uint32_t srcOriginXParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
+        ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uint32_t, uint32_t>(this, dstRegion->originX, srcRegion->originX, dstRegion->width, getSignalEventForAppend(hSignalEvent), numWaitEvents, phWaitEvents, true, relaxedOrderingDispatch, direction, [&](uint32_t dstOriginXParam, uint32_t srcOriginXParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             ze_copy_region_t dstRegionLocal = {};
             ze_copy_region_t srcRegionLocal = {};
             memcpy(&dstRegionLocal, dstRegion, sizeof(ze_copy_region_t));
@@ -468,7 +503,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     } else {
         ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopyRegion(dstPtr, dstRegion, dstPitch, dstSlicePitch,
                                                                            srcPtr, srcRegion, srcPitch, srcSlicePitch,
-                                                                           hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch, forceDisableCopyOnlyInOrderSignaling);
+                                                                           getSignalEventForAppend(hSignalEvent), numWaitEvents, phWaitEvents, relaxedOrderingDispatch, forceDisableCopyOnlyInOrderSignaling);
     }
 
     return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
@@ -480,6 +515,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
                                                                             ze_event_handle_t hSignalEvent,
                                                                             uint32_t numWaitEvents,
                                                                             ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendMemoryFill(ptr, pattern, patternSize, size, hSignalEvent,
+                                                               numCapturedWaitEvents, phCapturedWaitEvents, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -487,7 +529,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
-    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(ptr, pattern, patternSize, size, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(ptr, pattern, patternSize, size, getSignalEventForAppend(hSignalEvent), numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
 
     return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
 }
@@ -497,10 +539,18 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, 0u, nullptr, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendSignalEvent(hSignalEvent);
+        });
+    }
+
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace(0, false);
     }
-    ret = CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hSignalEvent);
+    if (!isCounterBasedSignalEvent(hSignalEvent)) {
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hSignalEvent);
+    }
     return flushImmediate(ret, true, true, false, hSignalEvent);
 }
 
@@ -509,11 +559,31 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_e
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
+    if (this->graphCaptureCmdList) {
+        // waits appended after the reset depend on a signal from outside of the captured list again
+        auto &signalEvents = this->graphCaptureSignalEvents;
+        signalEvents.erase(std::remove(signalEvents.begin(), signalEvents.end(), hSignalEvent), signalEvents.end());
+        return appendToGraphCapture(nullptr, 0u, nullptr, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendEventReset(hSignalEvent);
+        });
+    }
+
+    if (this->inOrderCounter) {
+        auto event = Event::fromHandle(hSignalEvent);
+        if (event->isCounterBasedEvent()) {
+            return event->reset();
+        }
+    }
+
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace(0, false);
     }
     ret = CommandListCoreFamily<gfxCoreFamily>::appendEventReset(hSignalEvent);
-    return flushImmediate(ret, true, true, false, hSignalEvent);
+    ret = flushImmediate(ret, true, true, false, this->inOrderCounter ? nullptr : hSignalEvent);
+
+    // the submission resets the event, its task count must not mark it as signaled
+    Event::fromHandle(hSignalEvent)->setCompletionTaskCount(0u);
+    return ret;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -550,6 +620,15 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingAllowed, bool trackDependencies, bool signalInOrderCompletion) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(nullptr, numEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            if (numCapturedWaitEvents == 0) {
+                return ZE_RESULT_SUCCESS;
+            }
+            return this->graphCaptureCmdList->appendWaitOnEvents(numCapturedWaitEvents, phCapturedWaitEvents, false, trackDependencies, signalInOrderCompletion);
+        });
+    }
+
     bool allSignaled = true;
     for (auto i = 0u; i < numEvents; i++) {
         allSignaled &= (!this->dcFlushSupport && Event::fromHandle(phWaitEvents[i])->isAlreadyCompleted());
@@ -571,11 +650,17 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteGlobalTime
     uint64_t *dstptr, ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
 
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendWriteGlobalTimestamp(dstptr, hSignalEvent, numCapturedWaitEvents, phCapturedWaitEvents);
+        });
+    }
+
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace(numWaitEvents, false);
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
-    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWriteGlobalTimestamp(dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWriteGlobalTimestamp(dstptr, getSignalEventForAppend(hSignalEvent), numWaitEvents, phWaitEvents);
 
     return flushImmediate(ret, true, true, false, hSignalEvent);
 }
@@ -607,6 +692,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyRegion
                                                                                  ze_event_handle_t hSignalEvent,
                                                                                  uint32_t numWaitEvents,
                                                                                  ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendImageCopyRegion(hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent,
+                                                                    numCapturedWaitEvents, phCapturedWaitEvents, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -614,7 +706,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyRegion
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
-    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendImageCopyRegion(hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent,
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendImageCopyRegion(hDstImage, hSrcImage, pDstRegion, pSrcRegion, getSignalEventForAppend(hSignalEvent),
                                                                            numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
     return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
 }
@@ -627,6 +719,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendImageCopyFromMemory(hDstImage, srcPtr, pDstRegion, hSignalEvent,
+                                                                        numCapturedWaitEvents, phCapturedWaitEvents, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -634,7 +733,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
-    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendImageCopyFromMemory(hDstImage, srcPtr, pDstRegion, hSignalEvent,
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendImageCopyFromMemory(hDstImage, srcPtr, pDstRegion, getSignalEventForAppend(hSignalEvent),
                                                                                numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
 
     return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
@@ -648,6 +747,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendImageCopyToMemory(dstPtr, hSrcImage, pSrcRegion, hSignalEvent,
+                                                                      numCapturedWaitEvents, phCapturedWaitEvents, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -655,7 +761,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
 
-    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendImageCopyToMemory(dstPtr, hSrcImage, pSrcRegion, hSignalEvent,
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendImageCopyToMemory(dstPtr, hSrcImage, pSrcRegion, getSignalEventForAppend(hSignalEvent),
                                                                              numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
 
     return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
@@ -668,11 +774,18 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
                                                                                      ze_event_handle_t hSignalEvent,
                                                                                      uint32_t numWaitEvents,
                                                                                      ze_event_handle_t *phWaitEvents) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent,
+                                                                        numCapturedWaitEvents, phCapturedWaitEvents);
+        });
+    }
+
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace(numWaitEvents, false);
         checkWaitEventsState(numWaitEvents, phWaitEvents);
     }
-    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, getSignalEventForAppend(hSignalEvent), numWaitEvents, phWaitEvents);
     return flushImmediate(ret, true, true, false, hSignalEvent);
 }
 
@@ -682,6 +795,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchCooperati
                                                                                          ze_event_handle_t hSignalEvent,
                                                                                          uint32_t numWaitEvents,
                                                                                          ze_event_handle_t *waitEventHandles, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, waitEventHandles, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendLaunchCooperativeKernel(kernelHandle, launchKernelArgs, hSignalEvent,
+                                                                            numCapturedWaitEvents, phCapturedWaitEvents, false);
+        });
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -689,10 +809,167 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchCooperati
         checkWaitEventsState(numWaitEvents, waitEventHandles);
     }
 
-    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchCooperativeKernel(kernelHandle, launchKernelArgs, hSignalEvent, numWaitEvents, waitEventHandles, relaxedOrderingDispatch);
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchCooperativeKernel(kernelHandle, launchKernelArgs, getSignalEventForAppend(hSignalEvent), numWaitEvents, waitEventHandles, relaxedOrderingDispatch);
     return flushImmediate(ret, true, false, relaxedOrderingDispatch, hSignalEvent);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchMultipleKernelsIndirect(uint32_t numKernels,
+                                                                                               const ze_kernel_handle_t *kernelHandles,
+                                                                                               const uint32_t *pNumLaunchArguments,
+                                                                                               const ze_group_count_t *pLaunchArgumentsBuffer,
+                                                                                               ze_event_handle_t hSignalEvent,
+                                                                                               uint32_t numWaitEvents,
+                                                                                               ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendLaunchMultipleKernelsIndirect(numKernels, kernelHandles, pNumLaunchArguments, pLaunchArgumentsBuffer,
+                                                                                  hSignalEvent, numCapturedWaitEvents, phCapturedWaitEvents, false);
+        });
+    }
+
+    return CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsIndirect(numKernels, kernelHandles, pNumLaunchArguments, pLaunchArgumentsBuffer,
+                                                                                     hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemAdvise(ze_device_handle_t hDevice,
+                                                                           const void *ptr, size_t size,
+                                                                           ze_memory_advice_t advice) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(nullptr, 0u, nullptr, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendMemAdvise(hDevice, ptr, size, advice);
+        });
+    }
+
+    return CommandListCoreFamily<gfxCoreFamily>::appendMemAdvise(hDevice, ptr, size, advice);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryPrefetch(const void *ptr, size_t count) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(nullptr, 0u, nullptr, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendMemoryPrefetch(ptr, count);
+        });
+    }
+
+    return CommandListCoreFamily<gfxCoreFamily>::appendMemoryPrefetch(ptr, count);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnMemory(void *desc, void *ptr,
+                                                                              uint32_t data, ze_event_handle_t signalEventHandle) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(signalEventHandle, 0u, nullptr, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendWaitOnMemory(desc, ptr, data, signalEventHandle);
+        });
+    }
+
+    return CommandListCoreFamily<gfxCoreFamily>::appendWaitOnMemory(desc, ptr, data, signalEventHandle);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteToMemory(void *desc, void *ptr,
+                                                                               uint64_t data) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(nullptr, 0u, nullptr, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendWriteToMemory(desc, ptr, data);
+        });
+    }
+
+    return CommandListCoreFamily<gfxCoreFamily>::appendWriteToMemory(desc, ptr, data);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendQueryKernelTimestamps(uint32_t numEvents, ze_event_handle_t *phEvents, void *dstptr,
+                                                                                       const size_t *pOffsets, ze_event_handle_t hSignalEvent,
+                                                                                       uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    if (this->graphCaptureCmdList) {
+        return appendToGraphCapture(hSignalEvent, numWaitEvents, phWaitEvents, [&](uint32_t numCapturedWaitEvents, ze_event_handle_t *phCapturedWaitEvents) {
+            return this->graphCaptureCmdList->appendQueryKernelTimestamps(numEvents, phEvents, dstptr, pOffsets, hSignalEvent,
+                                                                          numCapturedWaitEvents, phCapturedWaitEvents);
+        });
+    }
+
+    return CommandListCoreFamily<gfxCoreFamily>::appendQueryKernelTimestamps(numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::beginGraphCapture() {
+    if (this->graphCaptureCmdList) {
+        return ZE_RESULT_ERROR_NOT_AVAILABLE;
+    }
+
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto productFamily = this->device->getHwInfo().platform.eProductFamily;
+    auto captureCmdList = CommandList::create(productFamily, this->device, this->engineGroupType, 0u, returnValue);
+    if (captureCmdList == nullptr) {
+        return returnValue;
+    }
+    captureCmdList->setCmdListContext(this->hContext);
+
+    this->graphCaptureCmdList = captureCmdList;
+    this->graphCaptureSignalEvents.clear();
+    this->graphCaptureAppendCount = 0;
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::endGraphCapture(ze_command_list_handle_t *phCapturedCommandList) {
+    if (this->graphCaptureCmdList == nullptr) {
+        return ZE_RESULT_ERROR_NOT_AVAILABLE;
+    }
+
+    auto captureCmdList = this->graphCaptureCmdList;
+    this->graphCaptureCmdList = nullptr;
+    this->graphCaptureSignalEvents.clear();
+
+    auto ret = captureCmdList->close();
+    if (ret != ZE_RESULT_SUCCESS) {
+        captureCmdList->destroy();
+        return ret;
+    }
+
+    *phCapturedCommandList = captureCmdList->toHandle();
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+template <typename AppendFuncT>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendToGraphCapture(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, AppendFuncT appendFunc) {
+    auto &signalEvents = this->graphCaptureSignalEvents;
+
+    // commands of a regular command list may overlap, so dependencies between captured commands are replaced with barriers
+    bool barrierRequired = isInOrderExecutionEnabled() && this->graphCaptureAppendCount > 0;
+    StackVec<ze_event_handle_t, 8> externalWaitEvents;
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        if (std::find(signalEvents.begin(), signalEvents.end(), phWaitEvents[i]) != signalEvents.end()) {
+            barrierRequired = true;
+        } else {
+            externalWaitEvents.push_back(phWaitEvents[i]);
+        }
+    }
+
+    if (barrierRequired) {
+        auto ret = this->graphCaptureCmdList->appendBarrier(nullptr, 0u, nullptr);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+
+    auto numExternalWaitEvents = static_cast<uint32_t>(externalWaitEvents.size());
+    auto ret = appendFunc(numExternalWaitEvents, numExternalWaitEvents > 0 ? externalWaitEvents.begin() : nullptr);
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+
+    this->graphCaptureAppendCount++;
+    if (hSignalEvent && std::find(signalEvents.begin(), signalEvents.end(), hSignalEvent) == signalEvents.end()) {
+        signalEvents.push_back(hSignalEvent);
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint64_t timeout) {
     auto syncTaskCount = this->csr->peekTaskCount();
@@ -723,6 +1000,8 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint6
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_result_t inputRet, bool performMigration, bool hasStallingCmds,
                                                                           bool hasRelaxedOrderingDependencies, ze_event_handle_t hSignalEvent) {
+    uint32_t counterValue = 0;
+
     if (inputRet == ZE_RESULT_SUCCESS) {
         if (isInOrderExecutionEnabled()) {
             auto node = this->timestampPacketContainer->peekNodes()[0];
@@ -730,6 +1009,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
             this->commandContainer.addToResidencyContainer(allocation);
         }
 
+        if (isCounterBasedSignalEvent(hSignalEvent)) {
+            counterValue = this->appendSignalInOrderCounter(Event::fromHandle(hSignalEvent)->isSignalScope());
+        }
+
         if (this->isFlushTaskSubmissionEnabled) {
             inputRet = executeCommandListImmediateWithFlushTask(performMigration, hasStallingCmds, hasRelaxedOrderingDependencies);
         } else {
@@ -741,8 +1024,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
 
     if (signalEvent) {
         signalEvent->setCsr(this->csr);
+        signalEvent->setCompletionTaskCount(inputRet == ZE_RESULT_SUCCESS ? this->csr->peekTaskCount() : 0u);
 
-        if (isInOrderExecutionEnabled()) {
+        if (counterValue > 0) {
+            signalEvent->enableCounterBasedMode(this->inOrderCounter, counterValue);
+        } else if (isInOrderExecutionEnabled()) {
             signalEvent->enableInOrderExecMode(*this->timestampPacketContainer);
         }
     }
@@ -1079,6 +1365,23 @@ bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isRelaxedOrderingDispatchAll
     return NEO::RelaxedOrderingHelper::isRelaxedOrderingDispatchAllowed(*this->csr, numEvents);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isCounterBasedSignalEvent(ze_event_handle_t hSignalEvent) const {
+    if (!hSignalEvent || !this->inOrderCounter || this->partitionCount > 1) {
+        return false;
+    }
+
+    auto event = Event::fromHandle(hSignalEvent);
+
+    // timestamp events still need their packets for the profiling data
+    return !event->isEventTimestampFlagSet() && event->isCounterBasedModeAllowed();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_event_handle_t CommandListCoreFamilyImmediate<gfxCoreFamily>::getSignalEventForAppend(ze_event_handle_t hSignalEvent) const {
+    return isCounterBasedSignalEvent(hSignalEvent) ? nullptr : hSignalEvent;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::synchronizeInOrderExecution(uint64_t timeout) const {
     using TSPacketType = typename GfxFamily::TimestampPacketType;
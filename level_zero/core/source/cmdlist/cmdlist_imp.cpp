@@ -24,6 +24,7 @@
 #include "level_zero/core/source/cmdqueue/cmdqueue.h"
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/device/device_imp.h"
+#include "level_zero/core/source/event/in_order_counter.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/tools/source/metrics/metric.h"
 
@@ -43,6 +44,11 @@ CommandListAllocatorFn commandListFactory[IGFX_MAX_PRODUCT] = {};
 CommandListAllocatorFn commandListFactoryImmediate[IGFX_MAX_PRODUCT] = {};
 
 ze_result_t CommandListImp::destroy() {
+    if (this->graphCaptureCmdList) {
+        this->graphCaptureCmdList->destroy();
+        this->graphCaptureCmdList = nullptr;
+    }
+
     if (this->isBcsSplitNeeded) {
         static_cast<DeviceImp *>(this->device)->bcsSplit.releaseResources();
     }
@@ -179,6 +185,12 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
             commandList->immediateCmdListHeapSharing = L0GfxCoreHelper::enableImmediateCmdListHeapSharing(rootDeviceEnvironment, enabledCmdListSharing);
         }
         csr->initializeResources();
+        if (!csr->ensureEngineResourcesCreated()) {
+            commandList->destroy();
+            commandList = nullptr;
+            returnValue = ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+            return commandList;
+        }
         csr->initDirectSubmission();
         returnValue = commandList->initialize(device, engineGroupType, desc->flags);
 
@@ -234,6 +246,10 @@ void CommandListImp::enableInOrderExecution() {
     timestampPacketContainer = std::make_unique<NEO::TimestampPacketContainer>();
     deferredTimestampPackets = std::make_unique<NEO::TimestampPacketContainer>();
 
+    if (NEO::DebugManager.flags.EnableInOrderCounterBasedEvents.get() == 1) {
+        inOrderCounter = InOrderCounter::create(device);
+    }
+
     inOrderExecutionEnabled = true;
 }
 
@@ -17,6 +17,7 @@ class LogicalStateHelper;
 }
 
 namespace L0 {
+class InOrderCounter;
 
 struct CommandListImp : CommandList {
     using CommandList::CommandList;
@@ -41,6 +42,7 @@ struct CommandListImp : CommandList {
     std::unique_ptr<NEO::LogicalStateHelper> nonImmediateLogicalStateHelper;
     std::unique_ptr<NEO::TimestampPacketContainer> deferredTimestampPackets;
     std::unique_ptr<NEO::TimestampPacketContainer> timestampPacketContainer;
+    std::shared_ptr<InOrderCounter> inOrderCounter;
     bool inOrderExecutionEnabled = false;
 
     ~CommandListImp() override = default;
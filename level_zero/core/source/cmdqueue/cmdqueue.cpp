@@ -244,6 +244,11 @@ CommandQueue *CommandQueue::create(uint32_t productFamily, Device *device, NEO::
     }
 
     csr->initializeResources();
+    if (!csr->ensureEngineResourcesCreated()) {
+        commandQueue->destroy();
+        returnValue = ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+        return nullptr;
+    }
     csr->initDirectSubmission();
     if (commandQueue->cmdListHeapAddressModel == NEO::HeapAddressModel::GlobalStateless) {
         csr->createGlobalStatelessHeap();
@@ -57,6 +57,14 @@ ContextImp::ContextImp(DriverHandle *driverHandle) {
     this->driverHandle = static_cast<DriverHandleImp *>(driverHandle);
 }
 
+EventPoolSlabAllocator &ContextImp::getEventPoolSlabAllocator() {
+    std::unique_lock<std::mutex> lock(this->eventPoolSlabAllocatorMutex);
+    if (!this->eventPoolSlabAllocator) {
+        this->eventPoolSlabAllocator = std::make_unique<EventPoolSlabAllocator>(this->driverHandle->getMemoryManager());
+    }
+    return *this->eventPoolSlabAllocator;
+}
+
 ze_result_t ContextImp::allocHostMem(const ze_host_mem_alloc_desc_t *hostDesc,
                                      size_t size,
                                      size_t alignment,
@@ -128,6 +136,10 @@ ze_result_t ContextImp::allocHostMem(const ze_host_mem_alloc_desc_t *hostDesc,
         unifiedMemoryProperties.allocationFlags.hostptr = reinterpret_cast<uintptr_t>(*ptr);
     }
 
+    if (lookupTable.hasNumaPlacement) {
+        unifiedMemoryProperties.numaNode = static_cast<int32_t>(lookupTable.numaNode);
+    }
+
     auto usmPtr = this->driverHandle->svmAllocsManager->createHostUnifiedMemoryAllocation(size,
                                                                                           unifiedMemoryProperties);
     if (usmPtr == nullptr) {
@@ -175,6 +187,11 @@ ze_result_t ContextImp::allocDeviceMem(ze_device_handle_t hDevice,
         return parseResult;
     }
 
+    // NUMA placement applies to host allocations only, device and shared memory is placed by the kernel driver
+    if (lookupTable.hasNumaPlacement) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+
     auto neoDevice = device->getNEODevice();
     auto rootDeviceIndex = neoDevice->getRootDeviceIndex();
     auto deviceBitfields = this->driverHandle->deviceBitfields;
@@ -279,6 +296,11 @@ ze_result_t ContextImp::allocSharedMem(ze_device_handle_t hDevice,
         return parseResult;
     }
 
+    // NUMA placement applies to host allocations only, device and shared memory is placed by the kernel driver
+    if (lookupTable.hasNumaPlacement) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+
     if (lookupTable.relaxedSizeAllowed == false &&
         (size > neoDevice->getDeviceInfo().maxMemAllocSize)) {
         *ptr = nullptr;
@@ -11,6 +11,7 @@
 #include "shared/source/utilities/stackvec.h"
 
 #include "level_zero/core/source/context/context.h"
+#include "level_zero/core/source/event/event_pool_slab_allocator.h"
 
 #include <map>
 
@@ -185,6 +186,7 @@ struct ContextImp : Context {
     NEO::VirtualMemoryReservation *findSupportedVirtualReservation(const void *ptr, size_t size);
     std::map<uint64_t, IpcHandleTracking *> &getIPCHandleMap() { return this->ipcHandles; };
     [[nodiscard]] std::unique_lock<std::mutex> lockIPCHandleMap() { return std::unique_lock<std::mutex>(this->ipcHandleMapMutex); };
+    EventPoolSlabAllocator &getEventPoolSlabAllocator();
 
   protected:
     void setIPCHandleData(NEO::GraphicsAllocation *graphicsAllocation, uint64_t handle, IpcMemoryData &ipcData, uint64_t ptrAddress, uint8_t type);
@@ -194,6 +196,8 @@ struct ContextImp : Context {
     std::map<uint32_t, ze_device_handle_t> devices;
     std::map<uint64_t, IpcHandleTracking *> ipcHandles;
     std::mutex ipcHandleMapMutex;
+    std::unique_ptr<EventPoolSlabAllocator> eventPoolSlabAllocator;
+    std::mutex eventPoolSlabAllocatorMutex;
     std::vector<ze_device_handle_t> deviceHandles;
     DriverHandleImp *driverHandle = nullptr;
     uint32_t numDevices = 0;
@@ -1456,6 +1456,9 @@ ze_result_t DeviceImp::getCsrForOrdinalAndIndex(NEO::CommandStreamReceiver **csr
 
         if (neoDevice->isMultiRegularContextSelectionAllowed(osContext.getEngineType(), osContext.getEngineUsage())) {
             *csr = neoDevice->getNextEngineForMultiRegularContextMode(osContext.getEngineType()).commandStreamReceiver;
+        } else if (NEO::DebugManager.flags.CmdQEngineAssignPolicy.get() == 2 && !NEO::EngineHelpers::isBcs(osContext.getEngineType())) {
+            // explicit opt-in, the application selected index is replaced with the least loaded compute engine of the group
+            *csr = getActiveDevice()->getLeastLoadedEngine(engines).commandStreamReceiver;
         }
     } else {
         auto subDeviceOrdinal = ordinal - numEngineGroups;
@@ -133,6 +133,7 @@ bool HostPointerManager::freeHostPointerAllocation(void *ptr) {
     for (auto gpuAllocation : graphicsAllocations) {
         memoryManager->freeGraphicsMemory(gpuAllocation);
     }
+    memoryManager->invalidateHostPtrCache(hostPtrData->basePtr, hostPtrData->size);
     hostPointerAllocations.remove(hostPtrData->basePtr);
     return true;
 }
@@ -18,11 +18,13 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/wait_util.h"
 
+#include "level_zero/api/driver_experimental/public/zex_event.h"
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/cmdlist/cmdlist_imp.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue.h"
@@ -31,8 +33,10 @@
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/event/event_impl.inl"
+#include "level_zero/core/source/event/event_pool_slab_allocator.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 
+#include <algorithm>
 #include <set>
 
 namespace L0 {
@@ -77,6 +81,8 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
         isImplicitScalingCapable |= eventDevice->isImplicitScalingCapable();
     }
 
+    this->isMultiRootDeviceEventPool = rootDeviceIndices.size() > 1;
+
     auto &rootDeviceEnvironment = getDevice()->getNEODevice()->getRootDeviceEnvironment();
     auto &l0GfxCoreHelper = rootDeviceEnvironment.getHelper<L0GfxCoreHelper>();
     this->isDeviceEventPoolAllocation |= l0GfxCoreHelper.alwaysAllocateEventInLocalMem();
@@ -93,11 +99,29 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
         allocationType = NEO::AllocationType::GPU_TIMESTAMP_DEVICE_BUFFER;
     }
 
+    auto neoDevice = devices[0]->getNEODevice();
+    if (isSlabAllocationAllowed()) {
+        EventPoolSlabDescriptor slabDescriptor{};
+        slabDescriptor.rootDeviceIndices = rootDeviceIndices;
+        slabDescriptor.deviceBitfield = this->isDeviceEventPoolAllocation ? neoDevice->getDeviceBitfield() : systemMemoryBitfield;
+        slabDescriptor.allocationType = allocationType;
+        slabDescriptor.alignment = eventAlignment;
+        slabDescriptor.deviceAllocation = this->isDeviceEventPoolAllocation;
+        slabDescriptor.writeMemoryOnly = neoDevice->getDefaultEngine().commandStreamReceiver->isTbxMode();
+
+        auto sliceSize = alignUp<size_t>(this->numEvents * eventSize, eventAlignment);
+        this->slab = this->context->getEventPoolSlabAllocator().allocate(slabDescriptor, sliceSize, this->slabOffset);
+        if (this->slab) {
+            this->isHostVisibleEventPoolAllocation = this->isDeviceEventPoolAllocation ? !(isEventPoolDeviceAllocationFlagSet()) : true;
+            this->eventPoolSize = sliceSize;
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+
     eventPoolAllocations = std::make_unique<NEO::MultiGraphicsAllocation>(maxRootDeviceIndex);
 
     bool allocatedMemory = false;
 
-    auto neoDevice = devices[0]->getNEODevice();
     if (this->isDeviceEventPoolAllocation) {
         this->isHostVisibleEventPoolAllocation = !(isEventPoolDeviceAllocationFlagSet());
         NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), this->eventPoolSize, allocationType, neoDevice->getDeviceBitfield()};
@@ -137,6 +161,9 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
 }
 
 EventPool::~EventPool() {
+    if (slab) {
+        slab->free(slabOffset, eventPoolSize);
+    }
     if (eventPoolAllocations) {
         auto graphicsAllocations = eventPoolAllocations->getGraphicsAllocations();
         auto memoryManager = devices[0]->getDriverHandle()->getMemoryManager();
@@ -146,6 +173,23 @@ EventPool::~EventPool() {
     }
 }
 
+NEO::MultiGraphicsAllocation &EventPool::getAllocation() {
+    if (slab) {
+        return slab->getAllocation();
+    }
+    return *eventPoolAllocations;
+}
+
+bool EventPool::isSlabAllocationAllowed() const {
+    if (!EventPoolSlabAllocator::isEnabled() || this->context == nullptr) {
+        return false;
+    }
+    if (eventPoolFlags & ZE_EVENT_POOL_FLAG_IPC) {
+        return false;
+    }
+    return alignUp<size_t>(this->numEvents * eventSize, eventAlignment) <= EventPoolSlabAllocator::maxSliceSize;
+}
+
 ze_result_t EventPool::destroy() {
     delete this;
 
@@ -210,6 +254,10 @@ bool EventPool::isEventPoolTimestampFlagSet() const {
     return false;
 }
 
+bool EventPool::isCounterBasedFlagSet() const {
+    return !!(eventPoolFlags & ZEX_EVENT_POOL_FLAG_COUNTER_BASED);
+}
+
 ze_result_t EventPool::closeIpcHandle() {
     return this->destroy();
 }
@@ -347,6 +395,166 @@ NEO::GraphicsAllocation &Event::getAllocation(Device *device) const {
     return *this->eventPool->getAllocation().getGraphicsAllocation(device->getNEODevice()->getRootDeviceIndex());
 }
 
+void Event::printAssertIfPresent() {
+    auto assertHandler = this->device->getNEODevice()->getRootDeviceEnvironment().assertHandler.get();
+    if (assertHandler) {
+        assertHandler->printAssertAndAbort();
+    }
+}
+
+void Event::handleCompletedHostSynchronization() {
+    if (this->getKernelForPrintf() != nullptr) {
+        static_cast<Kernel *>(this->getKernelForPrintf())->printPrintfOutput(true);
+        this->setKernelForPrintf(nullptr);
+    }
+    printAssertIfPresent();
+}
+
+ze_result_t Event::hostSynchronizeMultiple(uint32_t numEvents, Event **events, bool waitForAll, uint64_t timeout, uint32_t *signaledIndex) {
+    if (numEvents == 0 || events == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (NEO::DebugManager.flags.OverrideEventSynchronizeTimeout.get() != -1) {
+        timeout = NEO::DebugManager.flags.OverrideEventSynchronizeTimeout.get();
+    }
+
+    StackVec<uint32_t, 32> pendingEvents;
+    StackVec<NEO::CommandStreamReceiver *, 4> csrsToCheck;
+    auto gpuHangCheckPeriod = events[0] ? events[0]->gpuHangCheckPeriod : std::chrono::microseconds{0};
+
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto event = events[i];
+        if (event == nullptr) {
+            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+        if (event->csrs[0]->getType() == NEO::CommandStreamReceiverType::CSR_AUB) {
+            if (!waitForAll) {
+                if (signaledIndex) {
+                    *signaledIndex = i;
+                }
+                return ZE_RESULT_SUCCESS;
+            }
+            continue;
+        }
+
+        pendingEvents.push_back(i);
+        for (auto &csr : event->csrs) {
+            if (std::find(csrsToCheck.begin(), csrsToCheck.end(), csr) == csrsToCheck.end()) {
+                csrsToCheck.push_back(csr);
+            }
+        }
+        gpuHangCheckPeriod = std::min(gpuHangCheckPeriod, event->gpuHangCheckPeriod);
+    }
+
+    auto waitStartTime = std::chrono::high_resolution_clock::now();
+    auto lastHangCheckTime = waitStartTime;
+    uint64_t timeDiff = 0;
+
+    do {
+        size_t stillPendingCount = 0;
+        for (auto eventIndex : pendingEvents) {
+            auto event = events[eventIndex];
+            if (event->queryStatus() == ZE_RESULT_SUCCESS) {
+                event->handleCompletedHostSynchronization();
+                if (!waitForAll) {
+                    if (signaledIndex) {
+                        *signaledIndex = eventIndex;
+                    }
+                    return ZE_RESULT_SUCCESS;
+                }
+            } else {
+                pendingEvents[stillPendingCount++] = eventIndex;
+            }
+        }
+        pendingEvents.resize(stillPendingCount);
+
+        if (pendingEvents.empty()) {
+            return ZE_RESULT_SUCCESS;
+        }
+
+        auto currentTime = std::chrono::high_resolution_clock::now();
+        auto elapsedTimeSinceGpuHangCheck = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - lastHangCheckTime);
+
+        if (elapsedTimeSinceGpuHangCheck.count() >= gpuHangCheckPeriod.count()) {
+            lastHangCheckTime = currentTime;
+            for (auto &csr : csrsToCheck) {
+                if (csr->isGpuHangDetected()) {
+                    events[pendingEvents[0]]->printAssertIfPresent();
+                    return ZE_RESULT_ERROR_DEVICE_LOST;
+                }
+            }
+        }
+
+        if (timeout == std::numeric_limits<uint64_t>::max()) {
+            continue;
+        } else if (timeout == 0) {
+            break;
+        }
+
+        timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count();
+
+    } while (timeDiff < timeout);
+
+    events[pendingEvents[0]]->printAssertIfPresent();
+    return ZE_RESULT_NOT_READY;
+}
+
+ze_result_t Event::queryKernelTimestampsMultiple(uint32_t numEvents, Event **events, ze_kernel_timestamp_result_t *results) {
+    if (numEvents == 0 || events == nullptr || results == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    for (uint32_t i = 0; i < numEvents; i++) {
+        if (events[i] == nullptr) {
+            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    // events usually share CSRs and pool allocations, synchronize with each of them once for the whole list
+    StackVec<NEO::CommandStreamReceiver *, 4> csrsToCheck;
+    StackVec<std::pair<NEO::CommandStreamReceiver *, NEO::GraphicsAllocation *>, 16> downloadedAllocations;
+    for (uint32_t i = 0; i < numEvents; i++) {
+        for (auto &csr : events[i]->csrs) {
+            if (std::find(csrsToCheck.begin(), csrsToCheck.end(), csr) == csrsToCheck.end()) {
+                csrsToCheck.push_back(csr);
+            }
+            if (csr->isTbxMode()) {
+                std::pair<NEO::CommandStreamReceiver *, NEO::GraphicsAllocation *> csrAllocation{csr, &events[i]->getAllocation(events[i]->device)};
+                if (std::find(downloadedAllocations.begin(), downloadedAllocations.end(), csrAllocation) == downloadedAllocations.end()) {
+                    csr->downloadAllocation(*csrAllocation.second);
+                    downloadedAllocations.push_back(csrAllocation);
+                }
+            }
+        }
+    }
+    for (auto &csr : csrsToCheck) {
+        if (csr->isTbxMode()) {
+            csr->downloadAllocations();
+        }
+    }
+
+    ze_result_t status = ZE_RESULT_SUCCESS;
+    bool anyCompleted = false;
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto result = events[i]->queryKernelTimestampInBatch(&results[i]);
+        if (result == ZE_RESULT_NOT_READY) {
+            results[i] = {};
+            status = ZE_RESULT_NOT_READY;
+        } else if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        } else {
+            anyCompleted = true;
+        }
+    }
+
+    if (anyCompleted) {
+        for (auto &csr : csrsToCheck) {
+            csr->getInternalAllocationStorage()->cleanAllocationList(csr->peekTaskCount(), NEO::AllocationUsage::TEMPORARY_ALLOCATION);
+        }
+    }
+    return status;
+}
+
 void Event::setGpuStartTimestamp() {
     if (isEventTimestampFlagSet()) {
         this->device->getGlobalTimestamps(&cpuStartTimestamp, &gpuStartTimestamp);
@@ -400,4 +608,32 @@ void Event::enableInOrderExecMode(const NEO::TimestampPacketContainer &inOrderSy
     inOrderTimestampPacket->assignAndIncrementNodesRefCounts(inOrderSyncNodes);
 }
 
+void Event::enableCounterBasedMode(std::shared_ptr<InOrderCounter> counter, uint32_t counterValue) {
+    if (inOrderExecEvent) {
+        inOrderExecEvent = false;
+        inOrderTimestampPacket->releaseNodes();
+    }
+    resetCompletionStatus();
+
+    inOrderCounter = std::move(counter);
+    inOrderCounterValue = counterValue;
+}
+
+void Event::disableCounterBasedMode() {
+    inOrderCounter.reset();
+    inOrderCounterValue = 0;
+}
+
+bool Event::isCounterBasedModeAllowed() const {
+    // counter allocation is local to this process and root device
+    if (isFromIpcPool || eventPool == nullptr) {
+        return false;
+    }
+    // counter based events are not written to memory, waits programmed on their packets would never be satisfied
+    if (!eventPool->isCounterBasedFlagSet()) {
+        return false;
+    }
+    return !eventPool->isIpcPoolFlagSet() && !eventPool->isMultiRootDevicePool();
+}
+
 } // namespace L0
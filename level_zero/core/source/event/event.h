@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/helpers/timestamp_packet_constants.h"
 #include "shared/source/helpers/timestamp_packet_container.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
@@ -39,6 +40,8 @@ struct Context;
 struct DriverHandle;
 struct DriverHandleImp;
 struct Device;
+struct EventPoolSlab;
+class InOrderCounter;
 struct Kernel;
 
 #pragma pack(1)
@@ -51,6 +54,7 @@ struct IpcEventPoolData {
     bool isDeviceEventPoolAllocation = false;
     bool isHostVisibleEventPoolAllocation = false;
     bool isImplicitScalingCapable = false;
+    bool isMultiRootDeviceEventPool = false;
 };
 #pragma pack()
 static_assert(sizeof(IpcEventPoolData) <= ZE_MAX_IPC_HANDLE_SIZE, "IpcEventPoolData is bigger than ZE_MAX_IPC_HANDLE_SIZE");
@@ -68,6 +72,8 @@ struct Event : _ze_event_handle_t {
     virtual ze_result_t queryStatus() = 0;
     virtual ze_result_t reset() = 0;
     virtual ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) = 0;
+    // CSR synchronization is done once by the caller of a bulk query for all queried events
+    virtual ze_result_t queryKernelTimestampInBatch(ze_kernel_timestamp_result_t *dstptr) { return queryKernelTimestamp(dstptr); }
     virtual ze_result_t queryTimestampsExp(Device *device, uint32_t *count, ze_kernel_timestamp_result_t *timestamps) = 0;
     enum State : uint32_t {
         STATE_SIGNALED = 0u,
@@ -80,6 +86,9 @@ struct Event : _ze_event_handle_t {
     template <typename TagSizeT>
     static Event *create(EventPool *eventPool, const ze_event_desc_t *desc, Device *device);
 
+    static ze_result_t hostSynchronizeMultiple(uint32_t numEvents, Event **events, bool waitForAll, uint64_t timeout, uint32_t *signaledIndex);
+    static ze_result_t queryKernelTimestampsMultiple(uint32_t numEvents, Event **events, ze_kernel_timestamp_result_t *results);
+
     static Event *fromHandle(ze_event_handle_t handle) { return static_cast<Event *>(handle); }
 
     inline ze_event_handle_t toHandle() { return this; }
@@ -210,10 +219,21 @@ struct Event : _ze_event_handle_t {
     void enableInOrderExecMode(const NEO::TimestampPacketContainer &inOrderSyncNodes);
     bool isInOrderExecEvent() const { return inOrderExecEvent; }
     const NEO::TimestampPacketContainer *getInOrderTimestampPacket() const { return inOrderTimestampPacket.get(); }
+    void enableCounterBasedMode(std::shared_ptr<InOrderCounter> counter, uint32_t counterValue);
+    void disableCounterBasedMode();
+    bool isCounterBasedEvent() const { return inOrderCounter != nullptr; }
+    InOrderCounter *getInOrderCounter() const { return inOrderCounter.get(); }
+    uint32_t getInOrderCounterValue() const { return inOrderCounterValue; }
+    bool isCounterBasedModeAllowed() const;
+    void setCompletionTaskCount(TaskCountType taskCount) { completionTaskCount = taskCount; }
+    TaskCountType getCompletionTaskCount() const { return completionTaskCount; }
 
   protected:
     Event(EventPool *eventPool, int index, Device *device) : device(device), eventPool(eventPool), index(index) {}
 
+    void handleCompletedHostSynchronization();
+    void printAssertIfPresent();
+
     uint64_t globalStartTS = 1;
     uint64_t globalEndTS = 1;
     uint64_t contextStartTS = 1;
@@ -234,6 +254,9 @@ struct Event : _ze_event_handle_t {
     size_t gpuStartTimestamp = 0u;
     size_t gpuEndTimestamp = 0u;
 
+    // task count of the submission that signals this event, 0 if unknown
+    TaskCountType completionTaskCount = 0u;
+
     // Metric streamer instance associated with the event.
     MetricStreamer *metricStreamer = nullptr;
     StackVec<NEO::CommandStreamReceiver *, 1> csrs;
@@ -242,11 +265,13 @@ struct Event : _ze_event_handle_t {
     EventPool *eventPool = nullptr;
     Kernel *kernelWithPrintf = nullptr;
     std::unique_ptr<NEO::TimestampPacketContainer> inOrderTimestampPacket;
+    std::shared_ptr<InOrderCounter> inOrderCounter;
 
     uint32_t maxKernelCount = 0;
     uint32_t kernelCount = 1u;
     uint32_t maxPacketCount = 0;
     uint32_t totalEventSize = 0;
+    uint32_t inOrderCounterValue = 0;
 
     ze_event_scope_flags_t signalScope = 0u;
     ze_event_scope_flags_t waitScope = 0u;
@@ -281,7 +306,7 @@ struct EventPool : _ze_event_pool_handle_t {
 
     inline ze_event_pool_handle_t toHandle() { return this; }
 
-    MOCKABLE_VIRTUAL NEO::MultiGraphicsAllocation &getAllocation() { return *eventPoolAllocations; }
+    MOCKABLE_VIRTUAL NEO::MultiGraphicsAllocation &getAllocation();
 
     uint32_t getEventSize() const { return eventSize; }
     void setEventSize(uint32_t size) { eventSize = size; }
@@ -289,6 +314,8 @@ struct EventPool : _ze_event_pool_handle_t {
     size_t getNumEvents() const { return numEvents; }
     uint32_t getEventMaxPackets() const { return eventPackets; }
     size_t getEventPoolSize() const { return eventPoolSize; }
+    size_t getSlabOffset() const { return slabOffset; }
+    bool isAllocatedFromSlab() const { return slab != nullptr; }
 
     bool isEventPoolTimestampFlagSet() const;
 
@@ -306,6 +333,7 @@ struct EventPool : _ze_event_pool_handle_t {
     ze_result_t initialize(DriverHandle *driver, Context *context, uint32_t numDevices, ze_device_handle_t *deviceHandles);
 
     void initializeSizeParameters(uint32_t numDevices, ze_device_handle_t *deviceHandles, DriverHandleImp &driver, const NEO::RootDeviceEnvironment &rootDeviceEnvironment);
+    bool isSlabAllocationAllowed() const;
 
     Device *getDevice() const { return devices[0]; }
 
@@ -317,6 +345,16 @@ struct EventPool : _ze_event_pool_handle_t {
         return isImplicitScalingCapable;
     }
 
+    bool isIpcPoolFlagSet() const {
+        return !!(eventPoolFlags & ZE_EVENT_POOL_FLAG_IPC);
+    }
+
+    bool isCounterBasedFlagSet() const;
+
+    bool isMultiRootDevicePool() const {
+        return isMultiRootDeviceEventPool;
+    }
+
   protected:
     EventPool() = default;
     EventPool(size_t numEvents) : numEvents(numEvents) {}
@@ -324,11 +362,13 @@ struct EventPool : _ze_event_pool_handle_t {
     std::vector<Device *> devices;
 
     std::unique_ptr<NEO::MultiGraphicsAllocation> eventPoolAllocations;
+    std::shared_ptr<EventPoolSlab> slab;
     void *eventPoolPtr = nullptr;
     ContextImp *context = nullptr;
 
     size_t numEvents = 1;
     size_t eventPoolSize = 0;
+    size_t slabOffset = 0;
 
     uint32_t eventAlignment = 0;
     uint32_t eventSize = 0;
@@ -51,6 +51,7 @@ struct EventImp : public Event {
     ze_result_t reset() override;
 
     ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) override;
+    ze_result_t queryKernelTimestampInBatch(ze_kernel_timestamp_result_t *dstptr) override;
     ze_result_t queryTimestampsExp(Device *device, uint32_t *count, ze_kernel_timestamp_result_t *timestamps) override;
 
     void resetDeviceCompletionData(bool resetAllPackets);
@@ -68,7 +69,11 @@ struct EventImp : public Event {
   protected:
     ze_result_t calculateProfilingData();
     ze_result_t queryStatusEventPackets();
+    bool areEventPacketsSignaled();
+    bool isCompletedByTaskCount();
+    void setKernelTimestampResult(ze_kernel_timestamp_result_t &result);
     ze_result_t queryInOrderEventStatus();
+    ze_result_t queryCounterBasedEventStatus();
     void handleSuccessfulHostSynchronization();
     MOCKABLE_VIRTUAL ze_result_t hostEventSetValue(TagSizeT eventValue);
     ze_result_t hostEventSetValueTimestamps(TagSizeT eventVal);
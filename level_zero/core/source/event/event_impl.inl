@@ -14,6 +14,7 @@
 #include "shared/source/os_interface/os_time.h"
 
 #include "level_zero/core/source/event/event_imp.h"
+#include "level_zero/core/source/event/in_order_counter.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/tools/source/metrics/metric.h"
@@ -40,7 +41,7 @@ Event *Event::create(EventPool *eventPool, const ze_event_desc_t *desc, Device *
 
     uint64_t baseHostAddr = reinterpret_cast<uint64_t>(alloc->getUnderlyingBuffer());
     event->totalEventSize = eventPool->getEventSize();
-    event->eventPoolOffset = desc->index * event->totalEventSize;
+    event->eventPoolOffset = eventPool->getSlabOffset() + desc->index * event->totalEventSize;
     event->hostAddress = reinterpret_cast<void *>(baseHostAddr + event->eventPoolOffset);
     event->signalScope = desc->signal;
     event->waitScope = desc->wait;
@@ -154,6 +155,17 @@ ze_result_t EventImp<TagSizeT>::queryInOrderEventStatus() {
     return ZE_RESULT_SUCCESS;
 }
 
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::queryCounterBasedEventStatus() {
+    if (!this->inOrderCounter->isValueReached(this->inOrderCounterValue)) {
+        return ZE_RESULT_NOT_READY;
+    }
+
+    handleSuccessfulHostSynchronization();
+
+    return ZE_RESULT_SUCCESS;
+}
+
 template <typename TagSizeT>
 void EventImp<TagSizeT>::handleSuccessfulHostSynchronization() {
     if (this->downloadAllocationRequired) {
@@ -167,9 +179,26 @@ void EventImp<TagSizeT>::handleSuccessfulHostSynchronization() {
     }
 }
 
+template <typename TagSizeT>
+bool EventImp<TagSizeT>::isCompletedByTaskCount() {
+    return this->completionTaskCount != 0 && !this->downloadAllocationRequired && this->csrs.size() == 1 &&
+           this->csrs[0]->isTaskCountCompleted(this->completionTaskCount);
+}
+
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
     assignKernelEventCompletionData(this->hostAddress);
+    if (!areEventPacketsSignaled()) {
+        return ZE_RESULT_NOT_READY;
+    }
+
+    handleSuccessfulHostSynchronization();
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <typename TagSizeT>
+bool EventImp<TagSizeT>::areEventPacketsSignaled() {
     uint32_t queryVal = Event::STATE_CLEARED;
     uint32_t packets = 0;
     for (uint32_t i = 0; i < this->kernelCount; i++) {
@@ -183,7 +212,7 @@ ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
                 queryVal,
                 std::not_equal_to<TagSizeT>());
             if (!ready) {
-                return ZE_RESULT_NOT_READY;
+                return false;
             }
         }
     }
@@ -199,16 +228,14 @@ ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
                     queryVal,
                     std::not_equal_to<TagSizeT>());
                 if (!ready) {
-                    return ZE_RESULT_NOT_READY;
+                    return false;
                 }
                 remainingPacketSyncAddress = ptrOffset(remainingPacketSyncAddress, this->singlePacketSize);
             }
         }
     }
 
-    handleSuccessfulHostSynchronization();
-
-    return ZE_RESULT_SUCCESS;
+    return true;
 }
 
 template <typename TagSizeT>
@@ -216,6 +243,10 @@ ze_result_t EventImp<TagSizeT>::queryStatus() {
     if (metricStreamer != nullptr) {
         hostEventSetValue(metricStreamer->getNotificationState());
     }
+    if (isCompletedByTaskCount()) {
+        this->setIsCompleted();
+        return ZE_RESULT_SUCCESS;
+    }
     if (this->downloadAllocationRequired) {
         for (auto &csr : csrs) {
             csr->downloadAllocation(this->getAllocation(this->device));
@@ -225,11 +256,16 @@ ze_result_t EventImp<TagSizeT>::queryStatus() {
 
                 csr->downloadAllocation(*nodeAlloc);
             }
+            if (isCounterBasedEvent()) {
+                csr->downloadAllocation(this->inOrderCounter->getAllocation());
+            }
         }
     }
 
     if (!this->isFromIpcPool && isAlreadyCompleted()) {
         return ZE_RESULT_SUCCESS;
+    } else if (isCounterBasedEvent()) {
+        return queryCounterBasedEventStatus();
     } else if (this->inOrderExecEvent) {
         return queryInOrderEventStatus();
     } else {
@@ -324,6 +360,9 @@ ze_result_t EventImp<TagSizeT>::hostEventSetValue(TagSizeT eventVal) {
 
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::hostSignal() {
+    if (isCounterBasedEvent()) {
+        disableCounterBasedMode();
+    }
     auto status = hostEventSetValue(Event::STATE_SIGNALED);
     if (status == ZE_RESULT_SUCCESS) {
         this->setIsCompleted();
@@ -352,13 +391,7 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
     do {
         ret = queryStatus();
         if (ret == ZE_RESULT_SUCCESS) {
-            if (this->getKernelForPrintf() != nullptr) {
-                static_cast<Kernel *>(this->getKernelForPrintf())->printPrintfOutput(true);
-                this->setKernelForPrintf(nullptr);
-            }
-            if (device->getNEODevice()->getRootDeviceEnvironment().assertHandler.get()) {
-                device->getNEODevice()->getRootDeviceEnvironment().assertHandler->printAssertAndAbort();
-            }
+            handleCompletedHostSynchronization();
             return ret;
         }
 
@@ -393,10 +426,13 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
 
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::reset() {
+    // packet memory may still hold a signal from before the event was counter based, so clear it as well
+    disableCounterBasedMode();
     if (inOrderExecEvent) {
         inOrderExecEvent = false;
         inOrderTimestampPacket->releaseNodes();
     }
+    this->completionTaskCount = 0u;
     this->resetCompletionStatus();
     this->resetDeviceCompletionData(false);
     this->l3FlushAppliedOnKernel.reset();
@@ -419,16 +455,39 @@ void EventImp<TagSizeT>::resetDeviceCompletionData(bool resetAllPackets) {
 
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) {
-
-    ze_kernel_timestamp_result_t &result = *dstptr;
-
     if (queryStatus() != ZE_RESULT_SUCCESS) {
         return ZE_RESULT_NOT_READY;
     }
 
     assignKernelEventCompletionData(hostAddress);
     calculateProfilingData();
+    setKernelTimestampResult(*dstptr);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::queryKernelTimestampInBatch(ze_kernel_timestamp_result_t *dstptr) {
+    if (metricStreamer != nullptr || this->isFromIpcPool || this->inOrderExecEvent || isCounterBasedEvent()) {
+        return queryKernelTimestamp(dstptr);
+    }
 
+    // completion has to be known before packets are copied, otherwise the copy may predate the final packet writes
+    bool completed = isAlreadyCompleted() || isCompletedByTaskCount();
+
+    // packets are copied once and used both for completion check and profiling data
+    assignKernelEventCompletionData(hostAddress);
+    if (!completed && !areEventPacketsSignaled()) {
+        return ZE_RESULT_NOT_READY;
+    }
+    this->setIsCompleted();
+
+    calculateProfilingData();
+    setKernelTimestampResult(*dstptr);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <typename TagSizeT>
+void EventImp<TagSizeT>::setKernelTimestampResult(ze_kernel_timestamp_result_t &result) {
     auto eventTsSetFunc = [&](uint64_t &timestampFieldToCopy, uint64_t &timestampFieldForWriting) {
         memcpy_s(&(timestampFieldForWriting), sizeof(uint64_t), static_cast<void *>(&timestampFieldToCopy), sizeof(uint64_t));
     };
@@ -445,7 +504,6 @@ ze_result_t EventImp<TagSizeT>::queryKernelTimestamp(ze_kernel_timestamp_result_
         eventTsSetFunc(globalEndTS, result.context.kernelEnd);
         eventTsSetFunc(globalEndTS, result.global.kernelEnd);
     }
-    return ZE_RESULT_SUCCESS;
 }
 
 template <typename TagSizeT>
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/event/event_pool_slab_allocator.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/multi_graphics_allocation.h"
+#include "shared/source/utilities/heap_allocator.h"
+
+#include <algorithm>
+
+namespace L0 {
+
+bool EventPoolSlabDescriptor::isCompatible(const EventPoolSlabDescriptor &other) const {
+    if (allocationType != other.allocationType ||
+        deviceAllocation != other.deviceAllocation ||
+        deviceBitfield != other.deviceBitfield ||
+        alignment != other.alignment ||
+        writeMemoryOnly != other.writeMemoryOnly ||
+        rootDeviceIndices.size() != other.rootDeviceIndices.size()) {
+        return false;
+    }
+    return std::equal(rootDeviceIndices.begin(), rootDeviceIndices.end(), other.rootDeviceIndices.begin());
+}
+
+EventPoolSlab::EventPoolSlab(NEO::MemoryManager *memoryManager, const EventPoolSlabDescriptor &descriptor)
+    : memoryManager(memoryManager), descriptor(descriptor) {
+    UNRECOVERABLE_IF(descriptor.rootDeviceIndices.size() == 0);
+
+    auto maxRootDeviceIndex = *std::max_element(descriptor.rootDeviceIndices.begin(), descriptor.rootDeviceIndices.end());
+    auto slabAllocations = std::make_unique<NEO::MultiGraphicsAllocation>(maxRootDeviceIndex);
+
+    bool allocatedMemory = false;
+    if (descriptor.deviceAllocation) {
+        NEO::AllocationProperties allocationProperties{*descriptor.rootDeviceIndices.begin(), slabSize, descriptor.allocationType, descriptor.deviceBitfield};
+        allocationProperties.alignment = descriptor.alignment;
+
+        auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(allocationProperties);
+        if (graphicsAllocation) {
+            slabAllocations->addAllocation(graphicsAllocation);
+            allocatedMemory = true;
+        }
+    } else {
+        NEO::AllocationProperties allocationProperties{*descriptor.rootDeviceIndices.begin(), slabSize, descriptor.allocationType, systemMemoryBitfield};
+        allocationProperties.alignment = descriptor.alignment;
+
+        auto rootDeviceIndices = descriptor.rootDeviceIndices;
+        allocatedMemory = (nullptr != memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndices,
+                                                                                                   allocationProperties,
+                                                                                                   *slabAllocations));
+    }
+
+    if (!allocatedMemory) {
+        return;
+    }
+
+    if (descriptor.writeMemoryOnly) {
+        slabAllocations->getDefaultGraphicsAllocation()->setWriteMemoryOnly(true);
+    }
+
+    allocations = std::move(slabAllocations);
+    sliceAllocator = std::make_unique<NEO::HeapAllocator>(startingOffset, slabSize, descriptor.alignment);
+}
+
+EventPoolSlab::~EventPoolSlab() {
+    if (allocations) {
+        for (auto graphicsAllocation : allocations->getGraphicsAllocations()) {
+            memoryManager->freeGraphicsMemory(graphicsAllocation);
+        }
+    }
+}
+
+bool EventPoolSlab::allocate(size_t &size, size_t &offset) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto sliceAddress = sliceAllocator->allocateWithCustomAlignment(size, descriptor.alignment);
+    if (sliceAddress == 0) {
+        return false;
+    }
+    offset = static_cast<size_t>(sliceAddress - startingOffset);
+    liveSlices++;
+    return true;
+}
+
+void EventPoolSlab::free(size_t offset, size_t size) {
+    std::unique_lock<std::mutex> lock(mutex);
+    slicesToFree.push_back({offset + startingOffset, size});
+    DEBUG_BREAK_IF(liveSlices == 0);
+    liveSlices--;
+}
+
+void EventPoolSlab::drain() {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (slicesToFree.empty()) {
+        return;
+    }
+    for (auto graphicsAllocation : allocations->getGraphicsAllocations()) {
+        if (graphicsAllocation && memoryManager->allocInUse(*graphicsAllocation)) {
+            return;
+        }
+    }
+    for (auto &slice : slicesToFree) {
+        sliceAllocator->free(slice.first, slice.second);
+    }
+    slicesToFree.clear();
+}
+
+bool EventPoolSlab::isIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (liveSlices > 0) {
+        return false;
+    }
+    for (auto graphicsAllocation : allocations->getGraphicsAllocations()) {
+        if (graphicsAllocation && memoryManager->allocInUse(*graphicsAllocation)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool EventPoolSlabAllocator::isEnabled() {
+    return NEO::DebugManager.flags.EnableEventPoolSlabAllocator.get() == 1;
+}
+
+std::shared_ptr<EventPoolSlab> EventPoolSlabAllocator::allocate(const EventPoolSlabDescriptor &descriptor, size_t &size, size_t &offset) {
+    if (!isSizeWithinThreshold(size)) {
+        return nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    auto slab = allocateFromSlabs(descriptor, size, offset);
+    if (slab) {
+        return slab;
+    }
+
+    for (auto &existingSlab : slabs) {
+        if (existingSlab->getDescriptor().isCompatible(descriptor)) {
+            existingSlab->drain();
+        }
+    }
+
+    slab = allocateFromSlabs(descriptor, size, offset);
+    if (slab) {
+        return slab;
+    }
+
+    // bound memory held by the context, pools that do not fit fall back to dedicated allocations
+    if (slabs.size() >= maxSlabCount) {
+        trimIdleSlabs();
+        if (slabs.size() >= maxSlabCount) {
+            return nullptr;
+        }
+    }
+
+    auto newSlab = std::make_shared<EventPoolSlab>(memoryManager, descriptor);
+    if (!newSlab->isValid()) {
+        return nullptr;
+    }
+    slabs.push_back(std::move(newSlab));
+    return allocateFromSlabs(descriptor, size, offset);
+}
+
+std::shared_ptr<EventPoolSlab> EventPoolSlabAllocator::allocateFromSlabs(const EventPoolSlabDescriptor &descriptor, size_t &size, size_t &offset) {
+    for (auto &slab : slabs) {
+        if (slab->getDescriptor().isCompatible(descriptor) && slab->allocate(size, offset)) {
+            return slab;
+        }
+    }
+    return nullptr;
+}
+
+void EventPoolSlabAllocator::trimIdleSlabs() {
+    slabs.erase(std::remove_if(slabs.begin(), slabs.end(), [](const std::shared_ptr<EventPoolSlab> &slab) {
+                    return slab.use_count() == 1 && slab->isIdle();
+                }),
+                slabs.end());
+}
+
+} // namespace L0
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/device_bitfield.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/allocation_type.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+class HeapAllocator;
+class MemoryManager;
+class MultiGraphicsAllocation;
+} // namespace NEO
+
+namespace L0 {
+
+struct EventPoolSlabDescriptor {
+    RootDeviceIndicesContainer rootDeviceIndices;
+    NEO::DeviceBitfield deviceBitfield;
+    NEO::AllocationType allocationType = NEO::AllocationType::UNKNOWN;
+    size_t alignment = MemoryConstants::cacheLineSize;
+    bool deviceAllocation = false;
+    bool writeMemoryOnly = false;
+
+    bool isCompatible(const EventPoolSlabDescriptor &other) const;
+};
+
+struct EventPoolSlab : NEO::NonCopyableOrMovableClass {
+    static constexpr size_t slabSize = 16 * MemoryConstants::pageSize64k;
+    static constexpr size_t startingOffset = MemoryConstants::pageSize64k;
+
+    EventPoolSlab(NEO::MemoryManager *memoryManager, const EventPoolSlabDescriptor &descriptor);
+    ~EventPoolSlab();
+
+    bool isValid() const { return allocations != nullptr; }
+    bool allocate(size_t &size, size_t &offset);
+    void free(size_t offset, size_t size);
+    void drain();
+    bool isIdle();
+
+    const EventPoolSlabDescriptor &getDescriptor() const { return descriptor; }
+    NEO::MultiGraphicsAllocation &getAllocation() const { return *allocations; }
+
+  protected:
+    NEO::MemoryManager *memoryManager = nullptr;
+    EventPoolSlabDescriptor descriptor;
+    std::unique_ptr<NEO::MultiGraphicsAllocation> allocations;
+    std::unique_ptr<NEO::HeapAllocator> sliceAllocator;
+    std::vector<std::pair<size_t, size_t>> slicesToFree;
+    size_t liveSlices = 0;
+    std::mutex mutex;
+};
+
+class EventPoolSlabAllocator : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t maxSliceSize = MemoryConstants::pageSize64k;
+    static constexpr size_t maxSlabCount = 16;
+
+    EventPoolSlabAllocator(NEO::MemoryManager *memoryManager) : memoryManager(memoryManager) {}
+
+    static bool isEnabled();
+    bool isSizeWithinThreshold(size_t size) const { return size <= maxSliceSize; }
+
+    std::shared_ptr<EventPoolSlab> allocate(const EventPoolSlabDescriptor &descriptor, size_t &size, size_t &offset);
+
+    size_t getSlabCount() const { return slabs.size(); }
+
+  protected:
+    std::shared_ptr<EventPoolSlab> allocateFromSlabs(const EventPoolSlabDescriptor &descriptor, size_t &size, size_t &offset);
+    void trimIdleSlabs();
+
+    NEO::MemoryManager *memoryManager = nullptr;
+    std::vector<std::shared_ptr<EventPoolSlab>> slabs;
+    std::mutex mutex;
+};
+
+} // namespace L0
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/event/in_order_counter.h"
+
+#include "shared/source/device/device.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/utilities/wait_util.h"
+
+#include "level_zero/core/source/device/device.h"
+
+#include <cstring>
+#include <functional>
+
+namespace L0 {
+
+std::shared_ptr<InOrderCounter> InOrderCounter::create(Device *device) {
+    auto neoDevice = device->getNEODevice();
+    auto memoryManager = neoDevice->getMemoryManager();
+
+    NEO::AllocationProperties allocationProperties{device->getRootDeviceIndex(), MemoryConstants::cacheLineSize,
+                                                   NEO::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER, neoDevice->getDeviceBitfield()};
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(allocationProperties);
+    if (!allocation) {
+        return nullptr;
+    }
+    memset(allocation->getUnderlyingBuffer(), 0, allocation->getUnderlyingBufferSize());
+
+    return std::make_shared<InOrderCounter>(*memoryManager, *allocation);
+}
+
+InOrderCounter::InOrderCounter(NEO::MemoryManager &memoryManager, NEO::GraphicsAllocation &allocation)
+    : memoryManager(memoryManager), allocation(allocation) {}
+
+InOrderCounter::~InOrderCounter() {
+    memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(&allocation);
+}
+
+uint64_t InOrderCounter::getGpuAddress() const {
+    return allocation.getGpuAddress();
+}
+
+bool InOrderCounter::isValueReached(uint32_t value) const {
+    auto hostAddress = static_cast<uint32_t const *>(allocation.getUnderlyingBuffer());
+    return NEO::WaitUtils::waitFunctionWithPredicate<const uint32_t>(hostAddress, value, std::greater_equal<uint32_t>());
+}
+
+} // namespace L0
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace NEO {
+class GraphicsAllocation;
+class MemoryManager;
+} // namespace NEO
+
+namespace L0 {
+struct Device;
+
+// Monotonic completion counter of an in-order command list. Events signaled from the list
+// hold a reference to it together with the value they wait for, so the counter memory
+// outlives the list as long as any event still points at it.
+class InOrderCounter : NEO::NonCopyableOrMovableClass {
+  public:
+    static std::shared_ptr<InOrderCounter> create(Device *device);
+
+    InOrderCounter(NEO::MemoryManager &memoryManager, NEO::GraphicsAllocation &allocation);
+    ~InOrderCounter();
+
+    NEO::GraphicsAllocation &getAllocation() const { return allocation; }
+    uint64_t getGpuAddress() const;
+    uint32_t getLastValue() const { return lastValue; }
+    uint32_t obtainNextValue() { return ++lastValue; }
+    bool isValueReached(uint32_t value) const;
+
+  protected:
+    NEO::MemoryManager &memoryManager;
+    NEO::GraphicsAllocation &allocation;
+    uint32_t lastValue = 0;
+};
+
+} // namespace L0
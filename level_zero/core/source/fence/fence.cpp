@@ -25,6 +25,10 @@ Fence *Fence::create(CommandQueueImp *cmdQueue, const ze_fence_desc_t *desc) {
 
 ze_result_t Fence::queryStatus() {
     auto csr = cmdQueue->getCsr();
+    if (csr->isTaskCountCompleted(taskCount)) {
+        return ZE_RESULT_SUCCESS;
+    }
+
     csr->downloadAllocations();
 
     auto *hostAddr = csr->getTagAddress();
@@ -20,11 +20,18 @@ std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
 
     addToMap(lookupMap, zexKernelGetBaseAddress);
 
+    addToMap(lookupMap, zexEventHostSynchronizeMultiple);
+    addToMap(lookupMap, zexEventQueryKernelTimestampsMultiple);
+
     addToMap(lookupMap, zexMemGetIpcHandles);
     addToMap(lookupMap, zexMemOpenIpcHandles);
 
     addToMap(lookupMap, zexCommandListAppendWaitOnMemory);
     addToMap(lookupMap, zexCommandListAppendWriteToMemory);
+    addToMap(lookupMap, zexCommandListGetLastMutableKernelLaunchId);
+    addToMap(lookupMap, zexCommandListUpdateMutableKernelLaunch);
+    addToMap(lookupMap, zexCommandListImmediateBeginCapture);
+    addToMap(lookupMap, zexCommandListImmediateEndCapture);
     addToMap(lookupMap, zexSysmanMemoryGetBandwidth);
 #undef addToMap
 
@@ -9,6 +9,7 @@
 
 #include "shared/source/helpers/surface_format_info.h"
 
+#include "level_zero/api/driver_experimental/public/zex_memory.h"
 #include <level_zero/ze_api.h>
 
 #include <cstdint>
@@ -71,6 +72,8 @@ struct StructuresLookupTable {
     bool compressedHint;
     bool uncompressedHint;
     bool rayTracingMemory;
+    bool hasNumaPlacement;
+    uint32_t numaNode;
 };
 
 inline ze_result_t prepareL0StructuresLookupTable(StructuresLookupTable &lookupTable, const void *desc) {
@@ -139,6 +142,10 @@ inline ze_result_t prepareL0StructuresLookupTable(StructuresLookupTable &lookupT
             }
         } else if (extendedDesc->stype == ZE_STRUCTURE_TYPE_RAYTRACING_MEM_ALLOC_EXT_DESC) {
             lookupTable.rayTracingMemory = true;
+        } else if (extendedDesc->stype == ZEX_STRUCTURE_TYPE_HOST_MEM_ALLOC_NUMA_PLACEMENT_DESC) {
+            auto numaPlacementDesc = reinterpret_cast<const zex_host_mem_alloc_numa_placement_desc_t *>(extendedDesc);
+            lookupTable.hasNumaPlacement = true;
+            lookupTable.numaNode = numaPlacementDesc->numaNode;
         } else {
             return ZE_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
         }
@@ -41,7 +41,9 @@ struct WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>
     using BaseClass::appendMultiTileBarrier;
     using BaseClass::appendSignalEventPostWalker;
     using BaseClass::appendWriteKernelTimestamp;
+    using BaseClass::appendedBarriersCount;
     using BaseClass::applyMemoryRangesBarrier;
+    using BaseClass::barrierElisionEnabled;
     using BaseClass::clearCommandsToPatch;
     using BaseClass::cmdListHeapAddressModel;
     using BaseClass::cmdListType;
@@ -79,10 +81,13 @@ struct WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>
     using BaseClass::isSyncModeQueue;
     using BaseClass::isTbxMode;
     using BaseClass::isTimestampEventForMultiTile;
+    using BaseClass::mutableKernelLaunches;
+    using BaseClass::mutableKernelLaunchesEnabled;
     using BaseClass::partitionCount;
     using BaseClass::patternAllocations;
     using BaseClass::pipeControlMultiKernelEventSync;
     using BaseClass::pipelineSelectStateTracking;
+    using BaseClass::programmedBarriersCount;
     using BaseClass::requiredStreamState;
     using BaseClass::requiresQueueUncachedMocs;
     using BaseClass::setupTimestampEventForMultiTile;
@@ -163,6 +168,7 @@ struct WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>
     using BaseClass::getDcFlushRequired;
     using BaseClass::getHostPtrAlloc;
     using BaseClass::immediateCmdListHeapSharing;
+    using BaseClass::inOrderCounter;
     using BaseClass::isBcsSplitNeeded;
     using BaseClass::isFlushTaskSubmissionEnabled;
     using BaseClass::isSyncModeQueue;
@@ -472,6 +478,19 @@ struct MockCommandList : public CommandList {
                      (void *desc, void *ptr,
                       uint64_t data));
 
+    ADDMETHOD_NOBASE(getLastMutableKernelLaunchId, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t * pCommandId));
+
+    ADDMETHOD_NOBASE(updateMutableKernelLaunch, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t commandId,
+                      const ze_group_count_t *pGroupCount));
+
+    ADDMETHOD_NOBASE(beginGraphCapture, ze_result_t, ZE_RESULT_SUCCESS,
+                     ());
+
+    ADDMETHOD_NOBASE(endGraphCapture, ze_result_t, ZE_RESULT_SUCCESS,
+                     (ze_command_list_handle_t * phCapturedCommandList));
+
     ADDMETHOD_NOBASE(executeCommandListImmediate, ze_result_t, ZE_RESULT_SUCCESS,
                      (bool perforMigration));
 
@@ -59,7 +59,10 @@ struct WhiteBox<::L0::EventPool> : public ::L0::EventPool {
     using BaseClass::isDeviceEventPoolAllocation;
     using BaseClass::isHostVisibleEventPoolAllocation;
     using BaseClass::isImportedIpcPool;
+    using BaseClass::isMultiRootDeviceEventPool;
     using BaseClass::isShareableEventMemory;
+    using BaseClass::slab;
+    using BaseClass::slabOffset;
 };
 
 using EventPool = WhiteBox<::L0::EventPool>;
@@ -7,6 +7,7 @@
 
 #include "shared/source/command_container/command_encoder.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
@@ -43,6 +44,81 @@ HWTEST_F(CommandListAppendBarrier, WhenAppendingBarrierThenPipeControlIsGenerate
     EXPECT_FALSE(cmd->getDcFlushEnable());
 }
 
+HWTEST2_F(CommandListAppendBarrier, givenBarrierElisionDisabledWhenAppendingConsecutiveBarriersThenEachBarrierIsProgrammed, IsAtLeastSkl) {
+    auto regularCommandList = std::make_unique<::L0::ult::CommandListCoreFamily<gfxCoreFamily>>();
+    regularCommandList->initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    EXPECT_FALSE(regularCommandList->barrierElisionEnabled);
+
+    auto cmdStream = regularCommandList->getCmdContainer().getCommandStream();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, regularCommandList->appendBarrier(nullptr, 0, nullptr));
+    auto usedAfterFirstBarrier = cmdStream->getUsed();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, regularCommandList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_LT(usedAfterFirstBarrier, cmdStream->getUsed());
+
+    EXPECT_EQ(2u, regularCommandList->appendedBarriersCount);
+    EXPECT_EQ(2u, regularCommandList->programmedBarriersCount);
+}
+
+HWTEST2_F(CommandListAppendBarrier, givenBarrierElisionEnabledWhenAppendingBarrierWithoutNewCommandsThenBarrierIsSkipped, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCommandListBarrierElision.set(1);
+
+    auto regularCommandList = std::make_unique<::L0::ult::CommandListCoreFamily<gfxCoreFamily>>();
+    regularCommandList->initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    EXPECT_TRUE(regularCommandList->barrierElisionEnabled);
+
+    auto cmdStream = regularCommandList->getCmdContainer().getCommandStream();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, regularCommandList->appendBarrier(nullptr, 0, nullptr));
+    auto usedAfterFirstBarrier = cmdStream->getUsed();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, regularCommandList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(usedAfterFirstBarrier, cmdStream->getUsed());
+    EXPECT_EQ(2u, regularCommandList->appendedBarriersCount);
+    EXPECT_EQ(1u, regularCommandList->programmedBarriersCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, regularCommandList->appendBarrier(event->toHandle(), 0, nullptr));
+    EXPECT_LT(usedAfterFirstBarrier, cmdStream->getUsed());
+    EXPECT_EQ(2u, regularCommandList->programmedBarriersCount);
+
+    auto usedAfterSignalingBarrier = cmdStream->getUsed();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, regularCommandList->appendSignalEvent(event->toHandle()));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, regularCommandList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_LT(usedAfterSignalingBarrier, cmdStream->getUsed());
+    EXPECT_EQ(5u, regularCommandList->appendedBarriersCount);
+    EXPECT_EQ(3u, regularCommandList->programmedBarriersCount);
+
+    regularCommandList->reset();
+    EXPECT_EQ(0u, regularCommandList->appendedBarriersCount);
+    EXPECT_EQ(0u, regularCommandList->programmedBarriersCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, regularCommandList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(1u, regularCommandList->programmedBarriersCount);
+}
+
+HWTEST2_F(CommandListAppendBarrier, givenBarrierElisionEnabledWhenImmediateCommandListIsInitializedThenElisionIsNotUsed, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCommandListBarrierElision.set(1);
+
+    auto immediateCommandList = std::make_unique<::L0::ult::CommandListCoreFamily<gfxCoreFamily>>();
+    immediateCommandList->cmdListType = ::L0::CommandList::CommandListType::TYPE_IMMEDIATE;
+    immediateCommandList->initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    EXPECT_FALSE(immediateCommandList->barrierElisionEnabled);
+}
+
+HWTEST2_F(CommandListAppendBarrier, givenPrintCommandListBarrierStatisticsWhenClosingRegularCommandListThenStatisticsArePrinted, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCommandListBarrierElision.set(1);
+    DebugManager.flags.PrintCommandListBarrierStatistics.set(true);
+
+    auto regularCommandList = std::make_unique<::L0::ult::CommandListCoreFamily<gfxCoreFamily>>();
+    regularCommandList->initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    regularCommandList->appendBarrier(nullptr, 0, nullptr);
+    regularCommandList->appendBarrier(nullptr, 0, nullptr);
+
+    testing::internal::CaptureStdout();
+    regularCommandList->close();
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("barriers appended: 2, barriers programmed: 1"));
+}
+
 HWTEST_F(CommandListAppendBarrier, GivenEventVsNoEventWhenAppendingBarrierThenCorrectPipeControlsIsAddedToCommandStream) {
     using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
     auto usedSpaceBefore = commandList->getCmdContainer().getCommandStream()->getUsed();
@@ -25,9 +25,12 @@
 #include "shared/test/common/mocks/mock_os_context.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/driver_experimental/public/zex_cmdlist.h"
+#include "level_zero/api/driver_experimental/public/zex_event.h"
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
 #include "level_zero/core/source/event/event.h"
 #include "level_zero/core/source/event/event_imp.h"
+#include "level_zero/core/source/event/in_order_counter.h"
 #include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
 #include "level_zero/core/test/unit_tests/fixtures/multi_tile_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
@@ -691,9 +694,9 @@ struct InOrderCmdListTests : public CommandListAppendLaunchKernel {
     }
 
     template <typename GfxFamily>
-    std::unique_ptr<L0::EventPool> createEvents(uint32_t numEvents, bool timestampEvent) {
+    std::unique_ptr<L0::EventPool> createEvents(uint32_t numEvents, bool timestampEvent, ze_event_pool_flags_t additionalFlags = 0) {
         ze_event_pool_desc_t eventPoolDesc = {};
-        eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+        eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE | additionalFlags;
         eventPoolDesc.count = numEvents;
 
         if (timestampEvent) {
@@ -1710,6 +1713,270 @@ HWTEST2_F(InOrderCmdListTests, givenInOrderModeWhenProgrammingKernelSplitWithEve
     alignedFree(alignedPtr);
 }
 
+HWTEST2_F(InOrderCmdListTests, givenCounterBasedEventsEnabledWhenSignalingEventsThenStoreCounterValueInsteadOfEventPackets, IsAtLeastXeHpCore) {
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+
+    NEO::DebugManager.flags.EnableInOrderCounterBasedEvents.set(1);
+
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    ASSERT_NE(nullptr, immCmdList->inOrderCounter.get());
+
+    auto cmdStream = immCmdList->getCmdContainer().getCommandStream();
+    auto counterGpuVa = immCmdList->inOrderCounter->getGpuAddress();
+
+    auto eventPool = createEvents<FamilyType>(2, false, ZEX_EVENT_POOL_FLAG_COUNTER_BASED);
+
+    auto offset = cmdStream->getUsed();
+    immCmdList->appendLaunchKernel(kernel->toHandle(), &groupCount, events[0]->toHandle(), 0, nullptr, launchParams, false);
+
+    EXPECT_TRUE(events[0]->isCounterBasedEvent());
+    EXPECT_FALSE(events[0]->inOrderExecEvent);
+    EXPECT_EQ(immCmdList->inOrderCounter.get(), events[0]->getInOrderCounter());
+    EXPECT_EQ(1u, events[0]->getInOrderCounterValue());
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList,
+                                                      ptrOffset(cmdStream->getCpuBase(), offset),
+                                                      (cmdStream->getUsed() - offset)));
+
+    uint32_t counterStores = 0;
+    for (auto &pipeControlItor : findAll<PIPE_CONTROL *>(cmdList.begin(), cmdList.end())) {
+        auto pipeControl = genCmdCast<PIPE_CONTROL *>(*pipeControlItor);
+        auto postSyncAddress = NEO::UnitTestHelper<FamilyType>::getPipeControlPostSyncAddress(*pipeControl);
+
+        EXPECT_NE(events[0]->getCompletionFieldGpuAddress(device), postSyncAddress);
+        if (postSyncAddress == counterGpuVa) {
+            EXPECT_EQ(1u, pipeControl->getImmediateData());
+            counterStores++;
+        }
+    }
+    EXPECT_EQ(1u, counterStores);
+
+    immCmdList->appendSignalEvent(events[1]->toHandle());
+
+    EXPECT_TRUE(events[1]->isCounterBasedEvent());
+    EXPECT_EQ(2u, events[1]->getInOrderCounterValue());
+
+    auto counterHostValue = static_cast<uint32_t *>(immCmdList->inOrderCounter->getAllocation().getUnderlyingBuffer());
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, events[0]->queryStatus());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, events[1]->queryStatus());
+
+    *counterHostValue = 1;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, events[0]->queryStatus());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, events[1]->queryStatus());
+
+    *counterHostValue = 2;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, events[1]->hostSynchronize(0));
+}
+
+HWTEST2_F(InOrderCmdListTests, givenCounterBasedEventWhenWaitingFromOtherCmdListThenProgramSemaphoreOnCounterValue, IsAtLeastXeHpCore) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+
+    NEO::DebugManager.flags.EnableInOrderCounterBasedEvents.set(1);
+
+    auto immCmdList1 = createImmCmdList<gfxCoreFamily>();
+    auto immCmdList2 = createImmCmdList<gfxCoreFamily>();
+
+    auto eventPool = createEvents<FamilyType>(1, false, ZEX_EVENT_POOL_FLAG_COUNTER_BASED);
+
+    immCmdList1->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false);
+    immCmdList1->appendLaunchKernel(kernel->toHandle(), &groupCount, events[0]->toHandle(), 0, nullptr, launchParams, false);
+    ASSERT_TRUE(events[0]->isCounterBasedEvent());
+
+    auto cmdStream = immCmdList2->getCmdContainer().getCommandStream();
+    auto offset = cmdStream->getUsed();
+
+    auto eventHandle = events[0]->toHandle();
+    immCmdList2->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 1, &eventHandle, launchParams, false);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList,
+                                                      ptrOffset(cmdStream->getCpuBase(), offset),
+                                                      (cmdStream->getUsed() - offset)));
+
+    bool counterSemaphoreFound = false;
+    for (auto &semaphoreItor : findAll<MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end())) {
+        auto semaphoreCmd = genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphoreItor);
+
+        EXPECT_NE(events[0]->getCompletionFieldGpuAddress(device), semaphoreCmd->getSemaphoreGraphicsAddress());
+        if (semaphoreCmd->getSemaphoreGraphicsAddress() == immCmdList1->inOrderCounter->getGpuAddress()) {
+            EXPECT_EQ(1u, semaphoreCmd->getSemaphoreDataDword());
+            EXPECT_EQ(MI_SEMAPHORE_WAIT::COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD, semaphoreCmd->getCompareOperation());
+            counterSemaphoreFound = true;
+        }
+    }
+    EXPECT_TRUE(counterSemaphoreFound);
+
+    auto cmdStream1 = immCmdList1->getCmdContainer().getCommandStream();
+    offset = cmdStream1->getUsed();
+
+    immCmdList1->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 1, &eventHandle, launchParams, false);
+
+    GenCmdList cmdList1;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList1,
+                                                      ptrOffset(cmdStream1->getCpuBase(), offset),
+                                                      (cmdStream1->getUsed() - offset)));
+
+    for (auto &semaphoreItor : findAll<MI_SEMAPHORE_WAIT *>(cmdList1.begin(), cmdList1.end())) {
+        auto semaphoreCmd = genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphoreItor);
+        EXPECT_NE(immCmdList1->inOrderCounter->getGpuAddress(), semaphoreCmd->getSemaphoreGraphicsAddress());
+    }
+}
+
+HWTEST2_F(InOrderCmdListTests, givenCounterBasedEventWhenResettingThenDontProgramCommands, IsAtLeastXeHpCore) {
+    NEO::DebugManager.flags.EnableInOrderCounterBasedEvents.set(1);
+
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    auto cmdStream = immCmdList->getCmdContainer().getCommandStream();
+
+    auto eventPool = createEvents<FamilyType>(1, false, ZEX_EVENT_POOL_FLAG_COUNTER_BASED);
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), &groupCount, events[0]->toHandle(), 0, nullptr, launchParams, false);
+    ASSERT_TRUE(events[0]->isCounterBasedEvent());
+
+    auto offset = cmdStream->getUsed();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, immCmdList->appendEventReset(events[0]->toHandle()));
+
+    EXPECT_EQ(offset, cmdStream->getUsed());
+    EXPECT_FALSE(events[0]->isCounterBasedEvent());
+    EXPECT_EQ(nullptr, events[0]->getInOrderCounter());
+}
+
+HWTEST2_F(InOrderCmdListTests, givenCompletedCounterBasedEventWhenResettingFromRegularCmdListThenEventIsNotReportedAsSignaled, IsAtLeastXeHpCore) {
+    NEO::DebugManager.flags.EnableInOrderCounterBasedEvents.set(1);
+
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+
+    auto eventPool = createEvents<FamilyType>(1, false, ZEX_EVENT_POOL_FLAG_COUNTER_BASED);
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), &groupCount, events[0]->toHandle(), 0, nullptr, launchParams, false);
+    ASSERT_TRUE(events[0]->isCounterBasedEvent());
+
+    auto counterHostValue = static_cast<uint32_t *>(immCmdList->inOrderCounter->getAllocation().getUnderlyingBuffer());
+    *counterHostValue = 1;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, events[0]->queryStatus());
+
+    auto regularCmdList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    regularCmdList->initialize(device, NEO::EngineGroupType::Compute, 0u);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, regularCmdList->appendEventReset(events[0]->toHandle()));
+
+    EXPECT_FALSE(events[0]->isCounterBasedEvent());
+    EXPECT_EQ(nullptr, events[0]->getInOrderCounter());
+    EXPECT_EQ(0u, events[0]->getInOrderCounterValue());
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, events[0]->queryStatus());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, events[0]->hostSynchronize(0));
+}
+
+HWTEST2_F(InOrderCmdListTests, givenCompletedCounterBasedEventWhenResettingOnHostThenEventIsNotReportedAsSignaled, IsAtLeastXeHpCore) {
+    NEO::DebugManager.flags.EnableInOrderCounterBasedEvents.set(1);
+
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+
+    auto eventPool = createEvents<FamilyType>(1, false, ZEX_EVENT_POOL_FLAG_COUNTER_BASED);
+
+    events[0]->hostSignal();
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), &groupCount, events[0]->toHandle(), 0, nullptr, launchParams, false);
+    ASSERT_TRUE(events[0]->isCounterBasedEvent());
+
+    auto counterHostValue = static_cast<uint32_t *>(immCmdList->inOrderCounter->getAllocation().getUnderlyingBuffer());
+    *counterHostValue = 1;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, events[0]->queryStatus());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, events[0]->reset());
+
+    EXPECT_FALSE(events[0]->isCounterBasedEvent());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, events[0]->queryStatus());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, events[0]->hostSynchronize(0));
+}
+
+HWTEST2_F(InOrderCmdListTests, givenCounterBasedEventsEnabledWhenSignalingEventFromIpcPoolThenUseEventPackets, IsAtLeastXeHpCore) {
+    NEO::DebugManager.flags.EnableInOrderCounterBasedEvents.set(1);
+
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE | ZE_EVENT_POOL_FLAG_IPC | ZEX_EVENT_POOL_FLAG_COUNTER_BASED;
+    eventPoolDesc.count = 1;
+
+    auto ipcEventPool = std::unique_ptr<L0::EventPool>(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, returnValue));
+    ASSERT_NE(nullptr, ipcEventPool);
+
+    ze_event_desc_t eventDesc = {};
+    auto ipcEvent = std::unique_ptr<L0::Event>(Event::create<typename FamilyType::TimestampPacketType>(ipcEventPool.get(), &eventDesc, device));
+
+    EXPECT_FALSE(ipcEvent->isCounterBasedModeAllowed());
+    immCmdList->appendLaunchKernel(kernel->toHandle(), &groupCount, ipcEvent->toHandle(), 0, nullptr, launchParams, false);
+    EXPECT_FALSE(ipcEvent->isCounterBasedEvent());
+
+    auto eventPool = createEvents<FamilyType>(1, false, ZEX_EVENT_POOL_FLAG_COUNTER_BASED);
+    events[0]->isFromIpcPool = true;
+
+    EXPECT_FALSE(events[0]->isCounterBasedModeAllowed());
+    immCmdList->appendLaunchKernel(kernel->toHandle(), &groupCount, events[0]->toHandle(), 0, nullptr, launchParams, false);
+    EXPECT_FALSE(events[0]->isCounterBasedEvent());
+
+    EXPECT_EQ(0u, immCmdList->inOrderCounter->getLastValue());
+}
+
+HWTEST2_F(InOrderCmdListTests, givenCounterBasedEventsEnabledWhenSignalingEventFromMultiRootDevicePoolThenUseEventPackets, IsAtLeastXeHpCore) {
+    NEO::DebugManager.flags.EnableInOrderCounterBasedEvents.set(1);
+
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+
+    auto eventPool = createEvents<FamilyType>(1, false, ZEX_EVENT_POOL_FLAG_COUNTER_BASED);
+    EXPECT_TRUE(events[0]->isCounterBasedModeAllowed());
+
+    static_cast<WhiteBox<::L0::EventPool> *>(eventPool.get())->isMultiRootDeviceEventPool = true;
+
+    EXPECT_FALSE(events[0]->isCounterBasedModeAllowed());
+    immCmdList->appendLaunchKernel(kernel->toHandle(), &groupCount, events[0]->toHandle(), 0, nullptr, launchParams, false);
+
+    EXPECT_FALSE(events[0]->isCounterBasedEvent());
+    EXPECT_TRUE(events[0]->inOrderExecEvent);
+    EXPECT_EQ(0u, immCmdList->inOrderCounter->getLastValue());
+}
+
+HWTEST2_F(InOrderCmdListTests, givenCounterBasedEventsEnabledWhenSignalingTimestampEventThenUseEventPackets, IsAtLeastXeHpCore) {
+    NEO::DebugManager.flags.EnableInOrderCounterBasedEvents.set(1);
+
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+
+    auto eventPool = createEvents<FamilyType>(1, true, ZEX_EVENT_POOL_FLAG_COUNTER_BASED);
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), &groupCount, events[0]->toHandle(), 0, nullptr, launchParams, false);
+
+    EXPECT_FALSE(events[0]->isCounterBasedEvent());
+    EXPECT_TRUE(events[0]->inOrderExecEvent);
+    EXPECT_EQ(0u, immCmdList->inOrderCounter->getLastValue());
+}
+
+HWTEST2_F(InOrderCmdListTests, givenCounterBasedEventsEnabledWhenSignalingEventFromPoolWithoutCounterBasedFlagThenUseEventPackets, IsAtLeastXeHpCore) {
+    NEO::DebugManager.flags.EnableInOrderCounterBasedEvents.set(1);
+
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+    ASSERT_NE(nullptr, immCmdList->inOrderCounter.get());
+
+    auto eventPool = createEvents<FamilyType>(1, false);
+    EXPECT_FALSE(events[0]->isCounterBasedModeAllowed());
+
+    immCmdList->appendLaunchKernel(kernel->toHandle(), &groupCount, events[0]->toHandle(), 0, nullptr, launchParams, false);
+
+    EXPECT_FALSE(events[0]->isCounterBasedEvent());
+    EXPECT_TRUE(events[0]->inOrderExecEvent);
+    EXPECT_EQ(0u, immCmdList->inOrderCounter->getLastValue());
+}
+
+HWTEST2_F(InOrderCmdListTests, givenCounterBasedEventsDisabledWhenEnablingInOrderExecutionThenDontCreateCounter, IsAtLeastXeHpCore) {
+    auto immCmdList = createImmCmdList<gfxCoreFamily>();
+
+    EXPECT_EQ(nullptr, immCmdList->inOrderCounter.get());
+}
+
 struct MultiTileInOrderCmdListTests : public InOrderCmdListTests {
     void SetUp() override {
         NEO::DebugManager.flags.CreateMultipleSubDevices.set(2);
@@ -2343,5 +2610,278 @@ HWTEST2_F(MultiTileImmediateCommandListAppendLaunchKernelXeHpCoreTest, givenImpl
     auto cmdBbStart = genCmdCast<MI_BATCH_BUFFER_START *>(*itorBbStart);
     EXPECT_EQ(MI_BATCH_BUFFER_START::SECOND_LEVEL_BATCH_BUFFER::SECOND_LEVEL_BATCH_BUFFER_SECOND_LEVEL_BATCH, cmdBbStart->getSecondLevelBatchBuffer());
 }
+
+struct MutableCommandListTests : public CommandListAppendLaunchKernel {
+    void SetUp() override {
+        CommandListAppendLaunchKernel::SetUp();
+        createKernel();
+
+        auto &kernelDescriptor = const_cast<NEO::KernelDescriptor &>(kernel->getKernelDescriptor());
+        kernelDescriptor.payloadMappings.bindingTable.numEntries = 0;
+        kernelDescriptor.kernelAttributes.flags.requiresImplicitArgs = false;
+        kernel->surfaceStateHeapDataSize = 0;
+        kernel->pImplicitArgs.reset();
+        kernel->setGroupSize(1, 1, 1);
+    }
+
+    template <GFXCORE_FAMILY gfxCoreFamily>
+    std::unique_ptr<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>> createCommandList(ze_command_list_flags_t flags) {
+        auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+        commandList->initialize(device, NEO::EngineGroupType::RenderCompute, flags);
+        return commandList;
+    }
+};
+
+HWTEST2_F(MutableCommandListTests, givenCommandListWithoutMutableFlagWhenUsingMutableKernelLaunchesThenUnsupportedIsReturned, IsAtLeastSkl) {
+    auto commandList = createCommandList<gfxCoreFamily>(0u);
+    EXPECT_FALSE(commandList->mutableKernelLaunchesEnabled);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_TRUE(commandList->mutableKernelLaunches.empty());
+
+    uint64_t commandId = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->getLastMutableKernelLaunchId(&commandId));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->updateMutableKernelLaunch(0, &groupCount));
+}
+
+HWTEST2_F(MutableCommandListTests, givenMutableCommandListWhenNoKernelAppendedThenLastIdIsNotAvailable, IsAtLeastSkl) {
+    auto commandList = createCommandList<gfxCoreFamily>(ZEX_COMMAND_LIST_FLAG_MUTABLE);
+    EXPECT_TRUE(commandList->mutableKernelLaunchesEnabled);
+
+    uint64_t commandId = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, commandList->getLastMutableKernelLaunchId(&commandId));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableKernelLaunch(0, nullptr));
+}
+
+HWTEST2_F(MutableCommandListTests, givenMutableCommandListWhenUpdatingKernelLaunchThenCrossThreadDataAndGroupCountArePatchedInPlace, IsAtLeastSkl) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+
+    auto commandList = createCommandList<gfxCoreFamily>(ZEX_COMMAND_LIST_FLAG_MUTABLE);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    commandList->close();
+
+    uint64_t commandId = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->getLastMutableKernelLaunchId(&commandId));
+    EXPECT_EQ(1u, commandId);
+
+    auto cmdStream = commandList->commandContainer.getCommandStream();
+    auto usedBeforeUpdate = cmdStream->getUsed();
+
+    memset(kernel->crossThreadData.get(), 0xAB, kernel->crossThreadDataSize);
+    ze_group_count_t newGroupCount{4, 3, 2};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableKernelLaunch(commandId, &newGroupCount));
+    EXPECT_EQ(usedBeforeUpdate, cmdStream->getUsed());
+
+    auto &launch = commandList->mutableKernelLaunches[1];
+    ASSERT_NE(nullptr, launch.walker);
+    EXPECT_EQ(kernel->crossThreadDataSize, launch.inlineDataSize + launch.indirectDataSize);
+    if (launch.inlineDataSize > 0) {
+        EXPECT_EQ(0, memcmp(launch.inlineData, kernel->crossThreadData.get(), launch.inlineDataSize));
+    }
+    if (launch.indirectDataSize > 0) {
+        EXPECT_EQ(0, memcmp(launch.indirectData, ptrOffset(kernel->crossThreadData.get(), launch.inlineDataSize), launch.indirectDataSize));
+    }
+
+    auto walker = reinterpret_cast<WALKER_TYPE *>(launch.walker);
+    EXPECT_EQ(4u, walker->getThreadGroupIdXDimension());
+    EXPECT_EQ(3u, walker->getThreadGroupIdYDimension());
+    EXPECT_EQ(2u, walker->getThreadGroupIdZDimension());
+
+    auto firstWalker = reinterpret_cast<WALKER_TYPE *>(commandList->mutableKernelLaunches[0].walker);
+    EXPECT_EQ(1u, firstWalker->getThreadGroupIdXDimension());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableKernelLaunch(commandId, nullptr));
+    EXPECT_EQ(4u, walker->getThreadGroupIdXDimension());
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableKernelLaunch(2, nullptr));
+}
+
+HWTEST2_F(MutableCommandListTests, givenMutableCommandListWhenKernelGroupSizeChangedThenUpdateIsRejected, IsAtLeastSkl) {
+    auto commandList = createCommandList<gfxCoreFamily>(ZEX_COMMAND_LIST_FLAG_MUTABLE);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+
+    kernel->groupSize[0] = 2;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_GROUP_SIZE_DIMENSION, commandList->updateMutableKernelLaunch(0, nullptr));
+}
+
+HWTEST2_F(MutableCommandListTests, givenMutableCommandListWhenAppendingIndirectLaunchThenLaunchIsRecordedButCannotBeUpdated, IsAtLeastSkl) {
+    auto commandList = createCommandList<gfxCoreFamily>(ZEX_COMMAND_LIST_FLAG_MUTABLE);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernelIndirect(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, false));
+
+    uint64_t commandId = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->getLastMutableKernelLaunchId(&commandId));
+    EXPECT_EQ(0u, commandId);
+    EXPECT_EQ(nullptr, commandList->mutableKernelLaunches[0].walker);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->updateMutableKernelLaunch(commandId, nullptr));
+}
+
+HWTEST2_F(MutableCommandListTests, givenMutableCommandListWhenResetThenRecordedLaunchesAreDropped, IsAtLeastSkl) {
+    auto commandList = createCommandList<gfxCoreFamily>(ZEX_COMMAND_LIST_FLAG_MUTABLE);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, commandList->mutableKernelLaunches.size());
+
+    commandList->reset();
+    EXPECT_TRUE(commandList->mutableKernelLaunches.empty());
+
+    uint64_t commandId = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, commandList->getLastMutableKernelLaunchId(&commandId));
+}
+using GraphCaptureCommandListTests = Test<ModuleFixture>;
+
+HWTEST2_F(GraphCaptureCommandListTests, givenRegularCommandListWhenCapturingThenUnsupportedIsReturned, IsAtLeastSkl) {
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, result));
+    ASSERT_NE(nullptr, commandList);
+
+    ze_command_list_handle_t hCapturedCommandList = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->endGraphCapture(&hCapturedCommandList));
+    EXPECT_EQ(nullptr, hCapturedCommandList);
+}
+
+HWTEST2_F(GraphCaptureCommandListTests, givenImmediateCommandListWhenCapturingKernelLaunchesThenNothingIsSubmittedAndRegularCommandListIsReturned, IsAtLeastSkl) {
+    createKernel();
+
+    const ze_command_queue_desc_t desc = {};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, result));
+    ASSERT_NE(nullptr, commandList);
+    auto csr = static_cast<CommandQueueImp *>(static_cast<CommandList *>(commandList.get())->cmdQImmediate)->getCsr();
+
+    ze_command_list_handle_t hCapturedCommandList = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, commandList->endGraphCapture(&hCapturedCommandList));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, commandList->beginGraphCapture());
+
+    auto taskCountBeforeCapture = csr->peekTaskCount();
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(taskCountBeforeCapture, csr->peekTaskCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->endGraphCapture(&hCapturedCommandList));
+    ASSERT_NE(nullptr, hCapturedCommandList);
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, commandList->endGraphCapture(&hCapturedCommandList));
+
+    auto capturedCommandList = static_cast<CommandList *>(L0::CommandList::fromHandle(hCapturedCommandList));
+    EXPECT_EQ(static_cast<uint32_t>(CommandList::CommandListType::TYPE_REGULAR), capturedCommandList->getCmdListType());
+    EXPECT_LT(0u, capturedCommandList->commandContainer.getCommandStream()->getUsed());
+    EXPECT_EQ(taskCountBeforeCapture, csr->peekTaskCount());
+    capturedCommandList->destroy();
+}
+
+HWTEST2_F(GraphCaptureCommandListTests, givenEventSignaledWithinCaptureWhenWaitingOnItThenWaitIsReplacedWithBarrier, IsAtLeastSkl) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    createKernel();
+
+    const ze_command_queue_desc_t desc = {};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, result));
+    ASSERT_NE(nullptr, commandList);
+
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 2;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_NE(nullptr, eventPool);
+
+    ze_event_desc_t eventDesc = {};
+    ze_event_handle_t capturedEvent = nullptr;
+    ze_event_handle_t externalEvent = nullptr;
+    eventDesc.index = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, eventPool->createEvent(&eventDesc, &capturedEvent));
+    eventDesc.index = 1;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, eventPool->createEvent(&eventDesc, &externalEvent));
+    std::unique_ptr<L0::Event> capturedEventObject(L0::Event::fromHandle(capturedEvent));
+    std::unique_ptr<L0::Event> externalEventObject(L0::Event::fromHandle(externalEvent));
+
+    auto captureAndCountSemaphores = [&](ze_event_handle_t hWaitEvent) {
+        ze_group_count_t groupCount{1, 1, 1};
+        CmdListKernelLaunchParams launchParams = {};
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->beginGraphCapture());
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, capturedEvent, 0, nullptr, launchParams, false));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 1, &hWaitEvent, launchParams, false));
+
+        ze_command_list_handle_t hCapturedCommandList = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->endGraphCapture(&hCapturedCommandList));
+        auto capturedCommandList = static_cast<CommandList *>(L0::CommandList::fromHandle(hCapturedCommandList));
+        auto cmdStream = capturedCommandList->commandContainer.getCommandStream();
+
+        GenCmdList cmdList;
+        EXPECT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList, cmdStream->getCpuBase(), cmdStream->getUsed()));
+        auto semaphoreCount = findAll<MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end()).size();
+        capturedCommandList->destroy();
+        return semaphoreCount;
+    };
+
+    EXPECT_EQ(0u, captureAndCountSemaphores(capturedEvent));
+    EXPECT_NE(0u, captureAndCountSemaphores(externalEvent));
+}
+
+HWTEST2_F(GraphCaptureCommandListTests, givenImmediateCommandListWhenCapturingMemoryAppendsThenTheyAreRecordedInCapturedCommandList, IsAtLeastSkl) {
+    const ze_command_queue_desc_t desc = {};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, result));
+    ASSERT_NE(nullptr, commandList);
+    auto csr = static_cast<CommandQueueImp *>(static_cast<CommandList *>(commandList.get())->cmdQImmediate)->getCsr();
+    auto immediateCmdStream = static_cast<CommandList *>(commandList.get())->commandContainer.getCommandStream();
+
+    void *srcPtr = nullptr;
+    void *dstPtr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, MemoryConstants::pageSize, MemoryConstants::pageSize, &srcPtr));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, MemoryConstants::pageSize, MemoryConstants::pageSize, &dstPtr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->beginGraphCapture());
+    auto taskCountBeforeCapture = csr->peekTaskCount();
+    auto immediateUsedBeforeCapture = immediateCmdStream->getUsed();
+
+    zex_wait_on_mem_desc_t waitDesc = {};
+    waitDesc.actionFlag = ZEX_WAIT_ON_MEMORY_FLAG_EQUAL;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendWaitOnMemory(&waitDesc, srcPtr, 1u, nullptr));
+
+    zex_write_to_mem_desc_t writeDesc = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendWriteToMemory(&writeDesc, dstPtr, 1u));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemoryPrefetch(srcPtr, MemoryConstants::pageSize));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemAdvise(device->toHandle(), srcPtr, MemoryConstants::pageSize, ZE_MEMORY_ADVICE_SET_READ_MOSTLY));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemoryCopyFromContext(dstPtr, context->toHandle(), srcPtr, MemoryConstants::cacheLineSize, nullptr, 0, nullptr, false));
+
+    EXPECT_EQ(taskCountBeforeCapture, csr->peekTaskCount());
+    EXPECT_EQ(immediateUsedBeforeCapture, immediateCmdStream->getUsed());
+
+    ze_command_list_handle_t hCapturedCommandList = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->endGraphCapture(&hCapturedCommandList));
+    ASSERT_NE(nullptr, hCapturedCommandList);
+
+    auto capturedCommandList = static_cast<CommandList *>(L0::CommandList::fromHandle(hCapturedCommandList));
+    auto cmdStream = capturedCommandList->commandContainer.getCommandStream();
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList, cmdStream->getCpuBase(), cmdStream->getUsed()));
+    EXPECT_NE(0u, findAll<typename FamilyType::MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end()).size());
+    EXPECT_NE(0u, findAll<typename FamilyType::PIPE_CONTROL *>(cmdList.begin(), cmdList.end()).size());
+    EXPECT_EQ(taskCountBeforeCapture, csr->peekTaskCount());
+
+    capturedCommandList->destroy();
+    context->freeMem(srcPtr);
+    context->freeMem(dstPtr);
+}
 } // namespace ult
 } // namespace L0
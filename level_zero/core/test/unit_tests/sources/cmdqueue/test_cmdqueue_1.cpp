@@ -9,6 +9,7 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/state_base_address.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/helpers/ult_hw_config.h"
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_bindless_heaps_helper.h"
@@ -69,6 +70,45 @@ TEST_F(CommandQueueCreate, whenCreatingCommandQueueThenItIsInitialized) {
     EXPECT_EQ(returnValue, ZE_RESULT_SUCCESS);
 }
 
+HWTEST_F(CommandQueueCreate, givenDeferredEngineResourcesCreationFailureWhenCreatingCommandQueueOrImmediateCommandListThenOutOfDeviceMemoryIsReturned) {
+    for (auto &engine : neoDevice->getAllEngines()) {
+        auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(engine.commandStreamReceiver);
+        ultCsr->deferEngineResourcesCreation();
+        ultCsr->createEngineResourcesReturnValue = false;
+    }
+
+    auto csr = neoDevice->getDefaultEngine().commandStreamReceiver;
+    const ze_command_queue_desc_t desc{};
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto commandQueue = CommandQueue::create(productFamily, device, csr, &desc, false, false, false, returnValue);
+    EXPECT_EQ(nullptr, commandQueue);
+    EXPECT_EQ(ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY, returnValue);
+
+    returnValue = ZE_RESULT_SUCCESS;
+    auto commandList = CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue);
+    EXPECT_EQ(nullptr, commandList);
+    EXPECT_EQ(ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY, returnValue);
+
+    for (auto &engine : neoDevice->getAllEngines()) {
+        auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(engine.commandStreamReceiver);
+        ultCsr->createEngineResourcesReturnValue = true;
+        EXPECT_TRUE(ultCsr->ensureEngineResourcesCreated());
+    }
+}
+
+TEST_F(CommandQueueCreate, givenDirectSubmissionInitializationFailureWhenCreatingCommandQueueThenCommandQueueIsCreated) {
+    VariableBackup<UltHwConfig> backup(&ultHwConfig);
+    ultHwConfig.csrFailInitDirectSubmission = true;
+
+    auto csr = neoDevice->getDefaultEngine().commandStreamReceiver;
+    const ze_command_queue_desc_t desc{};
+    ze_result_t returnValue = ZE_RESULT_ERROR_UNKNOWN;
+    auto commandQueue = CommandQueue::create(productFamily, device, csr, &desc, false, false, false, returnValue);
+    ASSERT_NE(nullptr, commandQueue);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, returnValue);
+    commandQueue->destroy();
+}
+
 TEST_F(CommandQueueCreate, whenSynchronizeByPollingTaskCountThenCallsPrintOutputOnPrintfKernelsStoredAndClearsKernelContainer) {
     const ze_command_queue_desc_t desc{};
     ze_result_t returnValue;
@@ -22,6 +22,7 @@
 #include "shared/test/common/helpers/raii_gfx_core_helper.h"
 #include "shared/test/common/helpers/raii_product_helper.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
+#include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_compilers.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_driver_info.h"
@@ -1366,6 +1367,73 @@ TEST_F(DeviceTest, givenNodeOrdinalFlagNotSetWhenCallAdjustCommandQueueDescThenD
     EXPECT_EQ(desc.ordinal, 0u);
 }
 
+TEST_F(DeviceTest, givenCmdQEngineAssignPolicyWhenGettingCsrForOrdinalAndIndexThenRequestedIndexIsReplacedOnlyForComputeGroupsWithExplicitOptIn) {
+    DebugManagerStateRestore restore;
+
+    auto deviceImp = static_cast<Mock<L0::DeviceImp> *>(device);
+    auto &engineGroups = deviceImp->getActiveDevice()->getRegularEngineGroups();
+    auto engineGroupsBackup = engineGroups;
+    engineGroups.clear();
+
+    const aub_stream::EngineType computeEngineTypes[] = {aub_stream::EngineType::ENGINE_CCS, aub_stream::EngineType::ENGINE_CCS1};
+    const aub_stream::EngineType copyEngineTypes[] = {aub_stream::EngineType::ENGINE_BCS1, aub_stream::EngineType::ENGINE_BCS2};
+
+    std::vector<std::unique_ptr<MockOsContext>> osContexts;
+    std::vector<std::unique_ptr<MockCommandStreamReceiver>> csrs;
+    auto addEngine = [&](NEO::EngineGroupT &engineGroup, aub_stream::EngineType engineType) {
+        auto osContext = std::make_unique<MockOsContext>(0u, EngineDescriptorHelper::getDefaultDescriptor());
+        osContext->engineType = engineType;
+        auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+        csr->setupContext(*osContext);
+        *csr->tagAddress = 0;
+        engineGroup.engines.push_back({csr.get(), osContext.get()});
+        osContexts.push_back(std::move(osContext));
+        csrs.push_back(std::move(csr));
+    };
+
+    NEO::EngineGroupT engineGroupCompute{};
+    engineGroupCompute.engineGroupType = NEO::EngineGroupType::Compute;
+    NEO::EngineGroupT engineGroupCopy{};
+    engineGroupCopy.engineGroupType = NEO::EngineGroupType::Copy;
+    for (auto &engineType : computeEngineTypes) {
+        addEngine(engineGroupCompute, engineType);
+    }
+    for (auto &engineType : copyEngineTypes) {
+        addEngine(engineGroupCopy, engineType);
+    }
+    // the engine requested by the application is the busy one in both groups
+    csrs[1]->taskCount = 10u;
+    csrs[3]->taskCount = 10u;
+    engineGroups.push_back(engineGroupCompute);
+    engineGroups.push_back(engineGroupCopy);
+    const uint32_t computeOrdinal = 0u;
+    const uint32_t copyOrdinal = 1u;
+
+    for (auto policy : {-1, 0, 1}) {
+        DebugManager.flags.CmdQEngineAssignPolicy.set(policy);
+
+        NEO::CommandStreamReceiver *csr = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, deviceImp->getCsrForOrdinalAndIndex(&csr, computeOrdinal, 1u));
+        EXPECT_EQ(engineGroups[computeOrdinal].engines[1].commandStreamReceiver, csr);
+
+        csr = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, deviceImp->getCsrForOrdinalAndIndex(&csr, copyOrdinal, 1u));
+        EXPECT_EQ(engineGroups[copyOrdinal].engines[1].commandStreamReceiver, csr);
+    }
+
+    DebugManager.flags.CmdQEngineAssignPolicy.set(2);
+
+    NEO::CommandStreamReceiver *csr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, deviceImp->getCsrForOrdinalAndIndex(&csr, computeOrdinal, 1u));
+    EXPECT_EQ(engineGroups[computeOrdinal].engines[0].commandStreamReceiver, csr);
+
+    csr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, deviceImp->getCsrForOrdinalAndIndex(&csr, copyOrdinal, 1u));
+    EXPECT_EQ(engineGroups[copyOrdinal].engines[1].commandStreamReceiver, csr);
+
+    engineGroups = engineGroupsBackup;
+}
+
 struct DeviceHwInfoTest : public ::testing::Test {
     void SetUp() override {
         executionEnvironment = new NEO::ExecutionEnvironment();
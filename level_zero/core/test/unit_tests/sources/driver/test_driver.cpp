@@ -930,6 +930,12 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     decltype(&zexDriverReleaseImportedPointer) expectedRelease = L0::zexDriverReleaseImportedPointer;
     decltype(&zexDriverGetHostPointerBaseAddress) expectedGet = L0::zexDriverGetHostPointerBaseAddress;
     decltype(&zexKernelGetBaseAddress) expectedKernelGetBaseAddress = L0::zexKernelGetBaseAddress;
+    decltype(&zexEventHostSynchronizeMultiple) expectedEventHostSynchronizeMultiple = L0::zexEventHostSynchronizeMultiple;
+    decltype(&zexEventQueryKernelTimestampsMultiple) expectedEventQueryKernelTimestampsMultiple = L0::zexEventQueryKernelTimestampsMultiple;
+    decltype(&zexCommandListGetLastMutableKernelLaunchId) expectedGetLastMutableKernelLaunchId = L0::zexCommandListGetLastMutableKernelLaunchId;
+    decltype(&zexCommandListUpdateMutableKernelLaunch) expectedUpdateMutableKernelLaunch = L0::zexCommandListUpdateMutableKernelLaunch;
+    decltype(&zexCommandListImmediateBeginCapture) expectedImmediateBeginCapture = L0::zexCommandListImmediateBeginCapture;
+    decltype(&zexCommandListImmediateEndCapture) expectedImmediateEndCapture = L0::zexCommandListImmediateEndCapture;
 
     void *funPtr = nullptr;
 
@@ -948,6 +954,30 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexKernelGetBaseAddress", &funPtr);
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
     EXPECT_EQ(expectedKernelGetBaseAddress, reinterpret_cast<decltype(&zexKernelGetBaseAddress)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexEventHostSynchronizeMultiple", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedEventHostSynchronizeMultiple, reinterpret_cast<decltype(&zexEventHostSynchronizeMultiple)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexEventQueryKernelTimestampsMultiple", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedEventQueryKernelTimestampsMultiple, reinterpret_cast<decltype(&zexEventQueryKernelTimestampsMultiple)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListGetLastMutableKernelLaunchId", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedGetLastMutableKernelLaunchId, reinterpret_cast<decltype(&zexCommandListGetLastMutableKernelLaunchId)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListUpdateMutableKernelLaunch", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedUpdateMutableKernelLaunch, reinterpret_cast<decltype(&zexCommandListUpdateMutableKernelLaunch)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListImmediateBeginCapture", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedImmediateBeginCapture, reinterpret_cast<decltype(&zexCommandListImmediateBeginCapture)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListImmediateEndCapture", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedImmediateEndCapture, reinterpret_cast<decltype(&zexCommandListImmediateEndCapture)>(funPtr));
 }
 
 TEST_F(DriverExperimentalApiTest, givenHostPointerApiExistWhenImportingPtrThenExpectProperBehavior) {
@@ -19,9 +19,11 @@
 #include "shared/test/common/mocks/mock_timestamp_packet.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/driver_experimental/public/zex_api.h"
 #include "level_zero/core/source/context/context_imp.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/event/event.h"
+#include "level_zero/core/source/event/event_pool_slab_allocator.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/fixtures/event_fixture.h"
@@ -1495,6 +1497,65 @@ TEST_F(EventSynchronizeTest, GivenLongPeriodOfGpuCheckAndOneNanosecondTimeoutWhe
     EXPECT_EQ(ZE_RESULT_NOT_READY, result);
 }
 
+TEST_F(EventSynchronizeTest, givenNoEventsWhenHostSynchronizeMultipleIsCalledThenInvalidArgumentIsReturned) {
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, L0::Event::hostSynchronizeMultiple(0, nullptr, true, 0, nullptr));
+}
+
+TEST_F(EventSynchronizeTest, givenNullEventWhenHostSynchronizeMultipleIsCalledThenInvalidNullHandleIsReturned) {
+    L0::Event *events[] = {event.get(), nullptr};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, L0::Event::hostSynchronizeMultiple(2, events, true, 0, nullptr));
+}
+
+TEST_F(EventSynchronizeTest, givenOneOfTwoEventsSignaledWhenHostSynchronizeMultipleIsCalledThenAnyModeSucceedsAndAllModeIsNotReady) {
+    eventDesc.index = 1;
+    auto secondEvent = std::unique_ptr<L0::Event>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device));
+    ASSERT_NE(nullptr, secondEvent);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, secondEvent->hostSignal());
+
+    L0::Event *events[] = {event.get(), secondEvent.get()};
+    uint32_t signaledIndex = std::numeric_limits<uint32_t>::max();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::Event::hostSynchronizeMultiple(2, events, false, 0, &signaledIndex));
+    EXPECT_EQ(1u, signaledIndex);
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, L0::Event::hostSynchronizeMultiple(2, events, true, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, L0::Event::hostSynchronizeMultiple(2, events, true, 1, nullptr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSignal());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::Event::hostSynchronizeMultiple(2, events, true, std::numeric_limits<uint64_t>::max(), nullptr));
+}
+
+TEST_F(EventSynchronizeTest, givenGpuHangOnAnyEventCsrWhenHostSynchronizeMultipleIsCalledThenDeviceLostIsReturned) {
+    eventDesc.index = 1;
+    auto secondEvent = std::unique_ptr<EventImp<uint32_t>>(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device)));
+    ASSERT_NE(nullptr, secondEvent);
+
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr->isGpuHangDetectedReturnValue = true;
+
+    secondEvent->csrs[0] = csr.get();
+    event->gpuHangCheckPeriod = 0ms;
+
+    L0::Event *events[] = {event.get(), secondEvent.get()};
+    constexpr uint64_t timeout = std::numeric_limits<std::uint64_t>::max();
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, L0::Event::hostSynchronizeMultiple(2, events, false, timeout, nullptr));
+}
+
+TEST_F(EventSynchronizeTest, givenInvalidModeWhenCallingExperimentalMultipleEventSynchronizeThenInvalidEnumerationIsReturned) {
+    ze_event_handle_t events[] = {event->toHandle()};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ENUMERATION, L0::zexEventHostSynchronizeMultiple(1, events, ZEX_EVENT_WAIT_MODE_FORCE_UINT32, 0, nullptr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSignal());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexEventHostSynchronizeMultiple(1, events, ZEX_EVENT_WAIT_MODE_ALL, 0, nullptr));
+}
+
+TEST_F(EventSynchronizeTest, givenInvalidEventHandlesWhenCallingExperimentalMultipleEventSynchronizeThenErrorIsReturned) {
+    ze_event_handle_t events[] = {event->toHandle(), nullptr};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, L0::zexEventHostSynchronizeMultiple(0, events, ZEX_EVENT_WAIT_MODE_ALL, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, L0::zexEventHostSynchronizeMultiple(1, nullptr, ZEX_EVENT_WAIT_MODE_ALL, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, L0::zexEventHostSynchronizeMultiple(2, events, ZEX_EVENT_WAIT_MODE_ALL, 0, nullptr));
+}
+
 TEST_F(EventSynchronizeTest, givenCallToEventHostSynchronizeWithTimeoutZeroAndStateInitialHostSynchronizeReturnsNotReady) {
     ze_result_t result = event->hostSynchronize(0);
     EXPECT_EQ(ZE_RESULT_NOT_READY, result);
@@ -2230,6 +2291,48 @@ HWTEST2_F(TimestampEventCreateMultiKernel, givenOverflowingTimeStampDataOnTwoKer
 
 HWTEST_EXCLUDE_PRODUCT(TimestampEventCreate, givenEventTimestampsWhenQueryKernelTimestampThenCorrectDataAreSet, IGFX_GEN12LP_CORE);
 
+TEST_F(TimestampEventCreate, givenInvalidArgumentsWhenQueryingKernelTimestampsOfMultipleEventsThenErrorIsReturned) {
+    ze_kernel_timestamp_result_t results[2] = {};
+    L0::Event *events[] = {event.get(), nullptr};
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, L0::Event::queryKernelTimestampsMultiple(0, events, results));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, L0::Event::queryKernelTimestampsMultiple(1, nullptr, results));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, L0::Event::queryKernelTimestampsMultiple(1, events, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, L0::Event::queryKernelTimestampsMultiple(2, events, results));
+}
+
+TEST_F(TimestampEventCreate, givenSignaledAndNotSignaledEventsWhenQueryingKernelTimestampsOfMultipleEventsThenSignaledEntriesAreFilledAndNotReadyIsReturned) {
+    typename MockTimestampPackets32::Packet data[EventPacketsCount::eventPackets] = {};
+    data[0].contextStart = 1u;
+    data[0].contextEnd = 2u;
+    data[0].globalStart = 3u;
+    data[0].globalEnd = 4u;
+    event->hostAddress = data;
+
+    ze_kernel_timestamp_result_t expectedResult = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryKernelTimestamp(&expectedResult));
+
+    eventDesc.index = 1;
+    auto notSignaledEvent = std::unique_ptr<L0::Event>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device));
+    ASSERT_NE(nullptr, notSignaledEvent);
+
+    ze_event_handle_t events[] = {event->toHandle(), notSignaledEvent->toHandle(), event->toHandle()};
+    ze_kernel_timestamp_result_t results[3];
+    memset(results, 0xFF, sizeof(results));
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, L0::zexEventQueryKernelTimestampsMultiple(3, events, results));
+    EXPECT_EQ(0, memcmp(&expectedResult, &results[0], sizeof(ze_kernel_timestamp_result_t)));
+    EXPECT_EQ(0, memcmp(&expectedResult, &results[2], sizeof(ze_kernel_timestamp_result_t)));
+    EXPECT_EQ(0u, results[1].context.kernelStart);
+    EXPECT_EQ(0u, results[1].context.kernelEnd);
+    EXPECT_EQ(0u, results[1].global.kernelStart);
+    EXPECT_EQ(0u, results[1].global.kernelEnd);
+
+    ze_event_handle_t signaledEvents[] = {event->toHandle(), event->toHandle()};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::zexEventQueryKernelTimestampsMultiple(2, signaledEvents, results));
+    EXPECT_EQ(0, memcmp(&expectedResult, &results[1], sizeof(ze_kernel_timestamp_result_t)));
+}
+
 TEST_F(TimestampEventCreate, givenEventWhenQueryKernelTimestampThenNotReadyReturned) {
     struct MockEventQuery : public L0::EventImp<uint32_t> {
         MockEventQuery(L0::EventPool *eventPool, int index, L0::Device *device) : EventImp(eventPool, index, device, false) {}
@@ -2981,6 +3084,43 @@ HWTEST_F(EventTests, GivenNotReadyEventBecomesReadyWhenDownloadAllocationRequire
         ultCsr.downloadAllocationsCalled = false;
     }
 }
+HWTEST_F(EventTests, givenCsrTbxModeWhenQueryingKernelTimestampsOfMultipleEventsThenSharedEventAllocationIsDownloadedOnce) {
+    std::map<GraphicsAllocation *, uint32_t> downloadAllocationTrack;
+    neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0]->memoryOperationsInterface = std::make_unique<NEO::MockMemoryOperations>();
+
+    auto &ultCsr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    ultCsr.commandStreamReceiverType = CommandStreamReceiverType::CSR_TBX;
+    VariableBackup<std::function<void(GraphicsAllocation & gfxAllocation)>> backupCsrDownloadImpl(&ultCsr.downloadAllocationImpl);
+    ultCsr.downloadAllocationImpl = [&downloadAllocationTrack](GraphicsAllocation &gfxAllocation) {
+        downloadAllocationTrack[&gfxAllocation]++;
+    };
+
+    constexpr uint32_t numEvents = 2;
+    L0::Event *events[numEvents];
+    for (uint32_t eventIndex = 0; eventIndex < numEvents; eventIndex++) {
+        eventDesc.index = eventIndex + 1;
+        auto event = whiteboxCast(getHelper<L0GfxCoreHelper>().createEvent(eventPool.get(), &eventDesc, device));
+
+        void *completionAddress = ptrOffset(event->hostAddress, event->getCompletionFieldOffset());
+        uint64_t signaledValue = Event::STATE_SIGNALED;
+        for (uint32_t i = 0; i < event->getMaxPacketsCount(); i++) {
+            memcpy(completionAddress, &signaledValue, sizeof(uint64_t));
+            completionAddress = ptrOffset(completionAddress, event->getSinglePacketSize());
+        }
+        events[eventIndex] = event;
+    }
+    ASSERT_EQ(&events[0]->getAllocation(device), &events[1]->getAllocation(device));
+
+    ze_kernel_timestamp_result_t results[numEvents];
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::Event::queryKernelTimestampsMultiple(numEvents, events, results));
+    EXPECT_EQ(1u, downloadAllocationTrack[&events[0]->getAllocation(device)]);
+    EXPECT_EQ(1u, ultCsr.downloadAllocationsCalledCount);
+
+    for (auto event : events) {
+        event->destroy();
+    }
+}
+
 HWTEST_F(EventTests, GivenCsrTbxModeWhenEventCreatedAndSignaledThenEventAllocationIsResidentOnce) {
     neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0]->memoryOperationsInterface = std::make_unique<NEO::MockMemoryOperations>();
     auto mockMemIface = static_cast<NEO::MockMemoryOperations *>(neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0]->memoryOperationsInterface.get());
@@ -3065,6 +3205,12 @@ struct MockEventCompletion : public L0::EventImp<uint32_t> {
 
     void assignKernelEventCompletionData(void *address) override {
         assignKernelEventCompletionDataCounter++;
+        if (callBaseAssignKernelEventCompletionData) {
+            EventImp<uint32_t>::assignKernelEventCompletionData(address);
+        }
+        if (onAssignKernelEventCompletionData) {
+            onAssignKernelEventCompletionData();
+        }
     }
 
     ze_result_t hostEventSetValue(uint32_t eventValue) override {
@@ -3074,7 +3220,9 @@ struct MockEventCompletion : public L0::EventImp<uint32_t> {
         return EventImp<uint32_t>::hostEventSetValue(eventValue);
     }
 
+    std::function<void()> onAssignKernelEventCompletionData;
     bool shouldHostEventSetValueFail = false;
+    bool callBaseAssignKernelEventCompletionData = false;
     uint32_t assignKernelEventCompletionDataCounter = 0u;
 };
 
@@ -3120,6 +3268,35 @@ TEST_F(EventTests, WhenQueryingStatusThenAccessMemoryOnce) {
     EXPECT_EQ(event->assignKernelEventCompletionDataCounter, 1u);
 }
 
+TEST_F(EventTests, whenQueryingKernelTimestampsOfMultipleEventsThenMemoryOfEachEventIsAccessedOnce) {
+    auto firstEvent = std::make_unique<MockEventCompletion>(eventPool.get(), 1u, device);
+    auto secondEvent = std::make_unique<MockEventCompletion>(eventPool.get(), 2u, device);
+
+    L0::Event *events[] = {firstEvent.get(), secondEvent.get()};
+    ze_kernel_timestamp_result_t results[2];
+    EXPECT_EQ(ZE_RESULT_SUCCESS, L0::Event::queryKernelTimestampsMultiple(2, events, results));
+    EXPECT_EQ(1u, firstEvent->assignKernelEventCompletionDataCounter);
+    EXPECT_EQ(1u, secondEvent->assignKernelEventCompletionDataCounter);
+}
+
+HWTEST_F(EventTests, givenTaskCountCompletedAfterPacketsAreCopiedWhenQueryingKernelTimestampsOfMultipleEventsThenNotReadyIsReturned) {
+    auto &ultCsr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    ultCsr.completionWatermarkEnabled = true;
+
+    auto event = std::make_unique<MockEventCompletion>(eventPool.get(), 1u, device);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->reset());
+    event->setCompletionTaskCount(5u);
+    event->callBaseAssignKernelEventCompletionData = true;
+    event->onAssignKernelEventCompletionData = [&ultCsr]() {
+        ultCsr.updateCompletionWatermark(5u);
+    };
+
+    L0::Event *events[] = {event.get()};
+    ze_kernel_timestamp_result_t results[1];
+    EXPECT_EQ(ZE_RESULT_NOT_READY, L0::Event::queryKernelTimestampsMultiple(1, events, results));
+    EXPECT_FALSE(event->isAlreadyCompleted());
+}
+
 TEST_F(EventTests, WhenQueryingStatusAfterResetThenAccessMemory) {
     auto event = std::make_unique<MockEventCompletion>(eventPool.get(), 1u, device);
     EXPECT_EQ(event->queryStatus(), ZE_RESULT_SUCCESS);
@@ -3128,6 +3305,53 @@ TEST_F(EventTests, WhenQueryingStatusAfterResetThenAccessMemory) {
     EXPECT_EQ(event->assignKernelEventCompletionDataCounter, 2u);
 }
 
+HWTEST_F(EventTests, givenCompletionTaskCountReachedByCsrWatermarkWhenQueryingStatusThenEventMemoryIsNotAccessed) {
+    auto &ultCsr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    ultCsr.completionWatermarkEnabled = true;
+    ultCsr.updateCompletionWatermark(5u);
+
+    auto event = std::make_unique<MockEventCompletion>(eventPool.get(), 1u, device);
+    event->setCompletionTaskCount(5u);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+    EXPECT_EQ(0u, event->assignKernelEventCompletionDataCounter);
+}
+
+HWTEST_F(EventTests, givenCompletionTaskCountAboveCsrWatermarkWhenQueryingStatusThenEventMemoryIsAccessed) {
+    auto &ultCsr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    ultCsr.completionWatermarkEnabled = true;
+    ultCsr.updateCompletionWatermark(5u);
+
+    auto event = std::make_unique<MockEventCompletion>(eventPool.get(), 1u, device);
+    event->setCompletionTaskCount(6u);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+    EXPECT_EQ(1u, event->assignKernelEventCompletionDataCounter);
+}
+
+HWTEST_F(EventTests, givenCompletionTaskCountReachedByCsrWatermarkWhenSynchronizingThenEventMemoryIsNotAccessed) {
+    auto &ultCsr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    ultCsr.completionWatermarkEnabled = true;
+    ultCsr.updateCompletionWatermark(5u);
+
+    auto event = std::make_unique<MockEventCompletion>(eventPool.get(), 1u, device);
+    event->setCompletionTaskCount(5u);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(0u));
+    EXPECT_EQ(0u, event->assignKernelEventCompletionDataCounter);
+}
+
+HWTEST_F(EventTests, givenCompletionTaskCountWhenEventIsResetThenCompletionTaskCountIsClearedAndEventMemoryIsAccessed) {
+    auto &ultCsr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    ultCsr.completionWatermarkEnabled = true;
+    ultCsr.updateCompletionWatermark(5u);
+
+    auto event = std::make_unique<MockEventCompletion>(eventPool.get(), 1u, device);
+    event->setCompletionTaskCount(5u);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->reset());
+    EXPECT_EQ(0u, event->getCompletionTaskCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+    EXPECT_EQ(1u, event->assignKernelEventCompletionDataCounter);
+}
+
 TEST_F(EventTests, WhenResetEventThenZeroCpuTimestamps) {
     auto event = std::make_unique<MockEventCompletion>(eventPool.get(), 1u, device);
     event->gpuStartTimestamp = 10u;
@@ -3620,5 +3844,198 @@ HWTEST2_F(EventTimestampTest, givenAppendMemoryCopyIsCalledWhenCpuCopyIsUsedAndC
     context->freeMem(devicePtr);
 }
 
+using EventPoolSlabAllocationTest = Test<DeviceFixture>;
+
+TEST_F(EventPoolSlabAllocationTest, givenSlabAllocatorDisabledWhenCreatingEventPoolThenDedicatedAllocationIsUsed) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableEventPoolSlabAllocator.set(0);
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, ZE_EVENT_POOL_FLAG_HOST_VISIBLE, 4};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, eventPool);
+
+    EXPECT_FALSE(eventPool->isAllocatedFromSlab());
+    EXPECT_EQ(0u, eventPool->getSlabOffset());
+}
+
+TEST_F(EventPoolSlabAllocationTest, givenSlabAllocatorEnabledWhenCreatingSmallEventPoolsThenTheyShareSingleAllocation) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableEventPoolSlabAllocator.set(1);
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, ZE_EVENT_POOL_FLAG_HOST_VISIBLE, 4};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool0(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, eventPool0);
+    std::unique_ptr<L0::EventPool> eventPool1(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, eventPool1);
+
+    EXPECT_TRUE(eventPool0->isAllocatedFromSlab());
+    EXPECT_TRUE(eventPool1->isAllocatedFromSlab());
+    EXPECT_EQ(eventPool0->getAllocation().getDefaultGraphicsAllocation(), eventPool1->getAllocation().getDefaultGraphicsAllocation());
+    EXPECT_EQ(1u, context->getEventPoolSlabAllocator().getSlabCount());
+
+    EXPECT_EQ(0u, eventPool0->getSlabOffset() % eventPool0->getEventSize());
+    EXPECT_GE(eventPool1->getSlabOffset(), eventPool0->getSlabOffset() + eventPool0->getEventPoolSize());
+
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, 1, 0, 0};
+    ze_event_handle_t hEvent0 = nullptr;
+    ze_event_handle_t hEvent1 = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, eventPool0->createEvent(&eventDesc, &hEvent0));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, eventPool1->createEvent(&eventDesc, &hEvent1));
+    auto event0 = zeUniquePtr(Event::fromHandle(hEvent0));
+    auto event1 = zeUniquePtr(Event::fromHandle(hEvent1));
+
+    auto baseAllocation = eventPool0->getAllocation().getDefaultGraphicsAllocation();
+    EXPECT_EQ(baseAllocation->getGpuAddress() + eventPool0->getSlabOffset() + eventPool0->getEventSize(), event0->getGpuAddress(device));
+    EXPECT_EQ(baseAllocation->getGpuAddress() + eventPool1->getSlabOffset() + eventPool1->getEventSize(), event1->getGpuAddress(device));
+    EXPECT_EQ(ptrOffset(baseAllocation->getUnderlyingBuffer(), eventPool1->getSlabOffset() + eventPool1->getEventSize()), event1->getHostAddress());
+}
+
+TEST_F(EventPoolSlabAllocationTest, givenSlabAllocatorEnabledWhenCreatingIpcEventPoolThenDedicatedAllocationIsUsed) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableEventPoolSlabAllocator.set(1);
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, ZE_EVENT_POOL_FLAG_HOST_VISIBLE | ZE_EVENT_POOL_FLAG_IPC, 4};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, eventPool);
+
+    EXPECT_FALSE(eventPool->isAllocatedFromSlab());
+}
+
+TEST_F(EventPoolSlabAllocationTest, givenSlabAllocatorEnabledWhenEventPoolExceedsSliceThresholdThenDedicatedAllocationIsUsed) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableEventPoolSlabAllocator.set(1);
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, ZE_EVENT_POOL_FLAG_HOST_VISIBLE, 1};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> probePool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_NE(nullptr, probePool);
+
+    eventPoolDesc.count = static_cast<uint32_t>(EventPoolSlabAllocator::maxSliceSize / probePool->getEventSize()) + 1;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, eventPool);
+
+    EXPECT_TRUE(probePool->isAllocatedFromSlab());
+    EXPECT_FALSE(eventPool->isAllocatedFromSlab());
+}
+
+TEST_F(EventPoolSlabAllocationTest, givenFullSlabWhenSliceIsFreedThenItIsRecycledOnlyAfterDrain) {
+    EventPoolSlabDescriptor descriptor{};
+    descriptor.rootDeviceIndices.pushUnique(device->getRootDeviceIndex());
+    descriptor.allocationType = NEO::AllocationType::BUFFER_HOST_MEMORY;
+
+    EventPoolSlab slab(driverHandle->getMemoryManager(), descriptor);
+    ASSERT_TRUE(slab.isValid());
+
+    size_t size = EventPoolSlab::slabSize;
+    size_t offset = std::numeric_limits<size_t>::max();
+    EXPECT_TRUE(slab.allocate(size, offset));
+    EXPECT_EQ(0u, offset);
+
+    size_t otherSize = MemoryConstants::cacheLineSize;
+    size_t otherOffset = 0;
+    EXPECT_FALSE(slab.allocate(otherSize, otherOffset));
+
+    slab.free(offset, size);
+    EXPECT_FALSE(slab.allocate(otherSize, otherOffset));
+
+    slab.drain();
+    otherSize = EventPoolSlab::slabSize;
+    EXPECT_TRUE(slab.allocate(otherSize, otherOffset));
+    EXPECT_EQ(offset, otherOffset);
+}
+
+TEST_F(EventPoolSlabAllocationTest, givenDifferentSlabDescriptorsWhenAllocatingThenSeparateSlabsAreCreated) {
+    EventPoolSlabAllocator slabAllocator(driverHandle->getMemoryManager());
+
+    EventPoolSlabDescriptor hostDescriptor{};
+    hostDescriptor.rootDeviceIndices.pushUnique(device->getRootDeviceIndex());
+    hostDescriptor.allocationType = NEO::AllocationType::BUFFER_HOST_MEMORY;
+
+    EventPoolSlabDescriptor timestampDescriptor = hostDescriptor;
+    timestampDescriptor.allocationType = NEO::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER;
+
+    size_t size = MemoryConstants::cacheLineSize;
+    size_t offset = 0;
+    auto hostSlab = slabAllocator.allocate(hostDescriptor, size, offset);
+    auto timestampSlab = slabAllocator.allocate(timestampDescriptor, size, offset);
+    auto otherHostSlab = slabAllocator.allocate(hostDescriptor, size, offset);
+
+    ASSERT_NE(nullptr, hostSlab);
+    ASSERT_NE(nullptr, timestampSlab);
+    EXPECT_NE(hostSlab, timestampSlab);
+    EXPECT_EQ(hostSlab, otherHostSlab);
+    EXPECT_EQ(2u, slabAllocator.getSlabCount());
+
+    size = EventPoolSlabAllocator::maxSliceSize + 1;
+    EXPECT_EQ(nullptr, slabAllocator.allocate(hostDescriptor, size, offset));
+}
+
+TEST_F(EventPoolSlabAllocationTest, givenMaxSlabCountReachedWhenAllocatingThenIdleSlabIsTrimmedOrAllocationFails) {
+    EventPoolSlabAllocator slabAllocator(driverHandle->getMemoryManager());
+
+    EventPoolSlabDescriptor descriptor{};
+    descriptor.rootDeviceIndices.pushUnique(device->getRootDeviceIndex());
+    descriptor.allocationType = NEO::AllocationType::BUFFER_HOST_MEMORY;
+
+    constexpr size_t slicesPerSlab = EventPoolSlab::slabSize / EventPoolSlabAllocator::maxSliceSize;
+    std::vector<std::pair<std::shared_ptr<EventPoolSlab>, size_t>> slices;
+    for (size_t i = 0; i < slicesPerSlab * EventPoolSlabAllocator::maxSlabCount; i++) {
+        size_t size = EventPoolSlabAllocator::maxSliceSize;
+        size_t offset = 0;
+        auto slab = slabAllocator.allocate(descriptor, size, offset);
+        ASSERT_NE(nullptr, slab);
+        slices.push_back({std::move(slab), offset});
+    }
+    EXPECT_EQ(EventPoolSlabAllocator::maxSlabCount, slabAllocator.getSlabCount());
+
+    size_t size = EventPoolSlabAllocator::maxSliceSize;
+    size_t offset = 0;
+    EXPECT_EQ(nullptr, slabAllocator.allocate(descriptor, size, offset));
+    EXPECT_EQ(EventPoolSlabAllocator::maxSlabCount, slabAllocator.getSlabCount());
+
+    auto firstSlab = slices[0].first.get();
+    for (auto &slice : slices) {
+        if (slice.first.get() == firstSlab) {
+            slice.first->free(slice.second, EventPoolSlabAllocator::maxSliceSize);
+            slice.first.reset();
+        }
+    }
+
+    EventPoolSlabDescriptor timestampDescriptor = descriptor;
+    timestampDescriptor.allocationType = NEO::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER;
+    auto timestampSlab = slabAllocator.allocate(timestampDescriptor, size, offset);
+    ASSERT_NE(nullptr, timestampSlab);
+    EXPECT_EQ(EventPoolSlabAllocator::maxSlabCount, slabAllocator.getSlabCount());
+}
+
+TEST_F(EventPoolSlabAllocationTest, givenSlabEventPoolWhenItsContextIsDestroyedThenPoolKeepsItsAllocation) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableEventPoolSlabAllocator.set(1);
+
+    ze_context_handle_t hContext;
+    ze_context_desc_t desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, driverHandle->createContext(&desc, 0u, nullptr, &hContext));
+    auto otherContext = static_cast<ContextImp *>(Context::fromHandle(hContext));
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, ZE_EVENT_POOL_FLAG_HOST_VISIBLE, 2};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), otherContext, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_NE(nullptr, eventPool);
+    auto allocation = eventPool->getAllocation().getDefaultGraphicsAllocation();
+    EXPECT_EQ(1u, otherContext->getEventPoolSlabAllocator().getSlabCount());
+
+    otherContext->destroy();
+    EXPECT_EQ(allocation, eventPool->getAllocation().getDefaultGraphicsAllocation());
+    EXPECT_TRUE(eventPool->isAllocatedFromSlab());
+}
+
 } // namespace ult
 } // namespace L0
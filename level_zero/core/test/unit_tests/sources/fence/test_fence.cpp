@@ -7,6 +7,7 @@
 
 #include "shared/source/built_ins/sip.h"
 #include "shared/source/helpers/completion_stamp.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_csr.h"
 #include "shared/test/common/mocks/mock_driver_model.h"
@@ -57,6 +58,28 @@ TEST_F(FenceTest, whenQueryingStatusThenCsrAllocationsAreDownloaded) {
     EXPECT_EQ(ZE_RESULT_SUCCESS, status);
 }
 
+TEST_F(FenceTest, givenCsrCompletionWatermarkEnabledWhenQueryingStatusThenCompletedTaskCountIsAnsweredWithoutDownloadingAllocations) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCsrCompletionWatermark.set(1);
+
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    *csr->tagAddress = 0;
+    csr->updateCompletionWatermark(2u);
+
+    Mock<CommandQueue> cmdQueue(device, csr.get());
+    ze_fence_desc_t fenceDesc = {};
+    auto fence = std::unique_ptr<WhiteBox<L0::Fence>>(whiteboxCast(Fence::create(&cmdQueue, &fenceDesc)));
+    ASSERT_NE(nullptr, fence);
+
+    fence->taskCount = 2;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fence->queryStatus());
+    EXPECT_FALSE(csr->downloadAllocationsCalled);
+
+    fence->taskCount = 3;
+    EXPECT_EQ(ZE_RESULT_NOT_READY, fence->queryStatus());
+    EXPECT_TRUE(csr->downloadAllocationsCalled);
+}
+
 TEST_F(FenceTest, givenFenceSignalFlagUsedWhenQueryingFenceAfterCreationThenReturnReadyStatus) {
     auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
     *csr->tagAddress = 0;
@@ -399,6 +399,7 @@ DebugSessionImp::Error DebugSessionImp::resumeThreadsWithinDevice(uint32_t devic
     [[maybe_unused]] auto sipCommandResult = writeResumeCommand(resumeThreadIds);
     DEBUG_BREAK_IF(sipCommandResult != true);
 
+    invalidateStateSaveAreaSnapshots();
     auto result = resumeImp(resumeThreadIds, deviceIndex);
 
     // For resume(ALL) and multiple threads to resume - read whole state save area
@@ -895,6 +896,7 @@ void DebugSessionImp::resumeAccidentallyStoppedThreads(const std::vector<EuThrea
         if (threadIdsPerDevice[i].size() > 0) {
             [[maybe_unused]] auto writeSipCommandResult = writeResumeCommand(threadIdsPerDevice[i]);
             DEBUG_BREAK_IF(writeSipCommandResult != true);
+            invalidateStateSaveAreaSnapshots();
             resumeImp(threadIdsPerDevice[i], i);
         }
 
@@ -1252,16 +1254,66 @@ ze_result_t DebugSessionImp::registersAccessHelper(const EuThread *thread, const
     auto threadSlotOffset = calculateThreadSlotOffset(thread->getThreadId());
     auto startRegOffset = threadSlotOffset + calculateRegisterOffsetInThreadSlot(regdesc, start);
 
+    // SIP updates the command register while servicing requests, it is never served from the snapshot
+    auto stateSaveAreaHeader = getStateSaveAreaHeader();
+    const bool useSnapshot = stateSaveAreaHeader && (regdesc != &stateSaveAreaHeader->regHeader.cmd);
+    const size_t accessSize = count * regdesc->bytes;
+
     int ret = 0;
     if (write) {
-        ret = writeGpuMemory(thread->getMemoryHandle(), static_cast<const char *>(pRegisterValues), count * regdesc->bytes, gpuVa + startRegOffset);
+        ret = writeGpuMemory(thread->getMemoryHandle(), static_cast<const char *>(pRegisterValues), accessSize, gpuVa + startRegOffset);
+        if (ret == 0 && useSnapshot) {
+            updateStateSaveAreaSnapshot(thread->getMemoryHandle(), startRegOffset, pRegisterValues, accessSize);
+        }
     } else {
-        ret = readGpuMemory(thread->getMemoryHandle(), static_cast<char *>(pRegisterValues), count * regdesc->bytes, gpuVa + startRegOffset);
+        if (useSnapshot && readFromStateSaveAreaSnapshot(thread->getMemoryHandle(), startRegOffset, pRegisterValues, accessSize)) {
+            return ZE_RESULT_SUCCESS;
+        }
+        ret = readGpuMemory(thread->getMemoryHandle(), static_cast<char *>(pRegisterValues), accessSize, gpuVa + startRegOffset);
     }
 
     return ret == 0 ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
 }
 
+void DebugSessionImp::storeStateSaveAreaSnapshot(uint64_t memoryHandle, std::unique_ptr<char[]> stateSaveArea, size_t size) {
+    if (!NEO::DebugManager.flags.EnableDebuggerStateSaveAreaSnapshot.get() || !stateSaveArea) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    auto &snapshot = stateSaveAreaSnapshots[memoryHandle];
+    snapshot.data = std::move(stateSaveArea);
+    snapshot.size = size;
+}
+
+bool DebugSessionImp::readFromStateSaveAreaSnapshot(uint64_t memoryHandle, size_t offset, void *output, size_t size) {
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+
+    auto snapshot = stateSaveAreaSnapshots.find(memoryHandle);
+    if (snapshot == stateSaveAreaSnapshots.end() || offset + size > snapshot->second.size) {
+        return false;
+    }
+
+    memcpy_s(output, size, snapshot->second.data.get() + offset, size);
+    return true;
+}
+
+void DebugSessionImp::updateStateSaveAreaSnapshot(uint64_t memoryHandle, size_t offset, const void *input, size_t size) {
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+
+    auto snapshot = stateSaveAreaSnapshots.find(memoryHandle);
+    if (snapshot == stateSaveAreaSnapshots.end() || offset + size > snapshot->second.size) {
+        return;
+    }
+
+    memcpy_s(snapshot->second.data.get() + offset, snapshot->second.size - offset, input, size);
+}
+
+void DebugSessionImp::invalidateStateSaveAreaSnapshots() {
+    std::lock_guard<std::mutex> lock(stateSaveAreaSnapshotMutex);
+    stateSaveAreaSnapshots.clear();
+}
+
 ze_result_t DebugSessionImp::cmdRegisterAccessHelper(const EuThread::ThreadId &threadId, SIP::sip_command &command, bool write) {
     auto stateSaveAreaHeader = getStateSaveAreaHeader();
     auto *regdesc = &stateSaveAreaHeader->regHeader.cmd;
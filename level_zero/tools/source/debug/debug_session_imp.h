@@ -19,6 +19,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace SIP {
@@ -114,6 +115,11 @@ struct DebugSessionImp : DebugSession {
     ze_result_t registersAccessHelper(const EuThread *thread, const SIP::regset_desc *regdesc,
                                       uint32_t start, uint32_t count, void *pRegisterValues, bool write);
 
+    void storeStateSaveAreaSnapshot(uint64_t memoryHandle, std::unique_ptr<char[]> stateSaveArea, size_t size);
+    bool readFromStateSaveAreaSnapshot(uint64_t memoryHandle, size_t offset, void *output, size_t size);
+    void updateStateSaveAreaSnapshot(uint64_t memoryHandle, size_t offset, const void *input, size_t size);
+    void invalidateStateSaveAreaSnapshots();
+
     void slmSipVersionCheck();
     MOCKABLE_VIRTUAL ze_result_t cmdRegisterAccessHelper(const EuThread::ThreadId &threadId, SIP::sip_command &command, bool write);
     MOCKABLE_VIRTUAL ze_result_t waitForCmdReady(EuThread::ThreadId threadId, uint16_t retryCount);
@@ -158,6 +164,13 @@ struct DebugSessionImp : DebugSession {
     std::vector<std::pair<ze_device_thread_t, bool>> pendingInterrupts;
     std::vector<EuThread::ThreadId> newlyStoppedThreads;
     std::vector<char> stateSaveAreaHeader;
+
+    struct StateSaveAreaSnapshot {
+        std::unique_ptr<char[]> data;
+        size_t size = 0;
+    };
+    std::mutex stateSaveAreaSnapshotMutex;
+    std::unordered_map<uint64_t, StateSaveAreaSnapshot> stateSaveAreaSnapshots; // memory handle to state save area copied on attention
     SIP::version minSlmSipVersion = {2, 1, 0};
     bool sipSupportsSlm = false;
 
@@ -246,6 +259,7 @@ ze_result_t DebugSessionImp::slmMemoryAccess(EuThread::ThreadId threadId, const
             return status;
         }
 
+        invalidateStateSaveAreaSnapshots();
         status = resumeImp(std::vector<EuThread::ThreadId>{threadId}, threadId.tileIndex);
         if (status != ZE_RESULT_SUCCESS) {
             return status;
@@ -59,6 +59,7 @@ DebugSessionLinux::~DebugSessionLinux() {
         delete session.first;
     }
     tileSessions.resize(0);
+    closeCachedVmFds();
     closeFd();
 }
 
@@ -119,21 +120,85 @@ int DebugSessionLinux::ioctl(unsigned long request, void *arg) {
     return ioctlHandler->ioctl(fd, request, arg);
 }
 
-ze_result_t DebugSessionLinux::readGpuMemory(uint64_t vmHandle, char *output, size_t size, uint64_t gpuVa) {
+int DebugSessionLinux::openVmFd(uint64_t vmHandle, bool readOnly) {
     prelim_drm_i915_debug_vm_open vmOpen = {
         .client_handle = static_cast<decltype(prelim_drm_i915_debug_vm_open::client_handle)>(clientHandle),
         .handle = static_cast<decltype(prelim_drm_i915_debug_vm_open::handle)>(vmHandle),
-        .flags = PRELIM_I915_DEBUG_VM_OPEN_READ_ONLY};
+        .flags = readOnly ? PRELIM_I915_DEBUG_VM_OPEN_READ_ONLY : PRELIM_I915_DEBUG_VM_OPEN_READ_WRITE};
 
     int vmDebugFd = ioctl(PRELIM_I915_DEBUG_IOCTL_VM_OPEN, &vmOpen);
     if (vmDebugFd < 0) {
         PRINT_DEBUGGER_ERROR_LOG("PRELIM_I915_DEBUG_IOCTL_VM_OPEN failed = %d\n", vmDebugFd);
-        return ZE_RESULT_ERROR_UNKNOWN;
     }
+    return vmDebugFd;
+}
+
+int DebugSessionLinux::getCachedVmFd(uint64_t vmHandle) {
+    auto vmFd = cachedVmFds.find(vmHandle);
+    if (vmFd != cachedVmFds.end()) {
+        return vmFd->second;
+    }
+
+    // single read-write fd serves both reads and writes of the vm
+    int vmDebugFd = openVmFd(vmHandle, false);
+    if (vmDebugFd >= 0) {
+        cachedVmFds[vmHandle] = vmDebugFd;
+    }
+    return vmDebugFd;
+}
+
+void DebugSessionLinux::closeCachedVmFd(uint64_t vmHandle) {
+    std::lock_guard<std::mutex> lock(gpuMemoryCacheMutex);
+
+    auto vmFd = cachedVmFds.find(vmHandle);
+    if (vmFd != cachedVmFds.end()) {
+        NEO::SysCalls::close(vmFd->second);
+        cachedVmFds.erase(vmFd);
+    }
+
+    auto vmPages = cachedPages.find(vmHandle);
+    if (vmPages != cachedPages.end()) {
+        numCachedPages -= vmPages->second.size();
+        cachedPages.erase(vmPages);
+    }
+}
+
+void DebugSessionLinux::closeCachedVmFds() {
+    std::lock_guard<std::mutex> lock(gpuMemoryCacheMutex);
+
+    for (auto &vmFd : cachedVmFds) {
+        NEO::SysCalls::close(vmFd.second);
+    }
+    cachedVmFds.clear();
+    cachedPages.clear();
+    numCachedPages = 0;
+}
+
+void DebugSessionLinux::invalidateGpuMemoryCache(bool threadsStopped) {
+    std::lock_guard<std::mutex> lock(gpuMemoryCacheMutex);
+    cachedPages.clear();
+    numCachedPages = 0;
+    gpuMemoryCacheActive = threadsStopped;
+}
+
+void DebugSessionLinux::invalidateGpuMemoryCache(uint64_t vmHandle, uint64_t gpuVa, size_t size) {
+    std::lock_guard<std::mutex> lock(gpuMemoryCacheMutex);
+
+    auto vmPages = cachedPages.find(vmHandle);
+    if (vmPages == cachedPages.end()) {
+        return;
+    }
+
+    auto &pages = vmPages->second;
+    auto page = pages.lower_bound(alignDown(gpuVa, MemoryConstants::pageSize));
+    while (page != pages.end() && page->first < gpuVa + size) {
+        page = pages.erase(page);
+        numCachedPages--;
+    }
+}
 
+int64_t DebugSessionLinux::readGpuMemoryFromVmFd(int vmDebugFd, char *output, size_t size, uint64_t gpuVa) {
     int64_t retVal = 0;
-    auto gmmHelper = connectedDevice->getNEODevice()->getGmmHelper();
-    gpuVa = gmmHelper->decanonize(gpuVa);
 
     if (NEO::DebugManager.flags.EnableDebuggerMmapMemoryAccess.get()) {
         uint64_t alignedMem = alignDown(gpuVa, MemoryConstants::pageSize);
@@ -177,26 +242,11 @@ ze_result_t DebugSessionLinux::readGpuMemory(uint64_t vmHandle, char *output, si
         retVal = pendingSize;
     }
 
-    NEO::SysCalls::close(vmDebugFd);
-
-    return (retVal == 0) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
+    return retVal;
 }
 
-ze_result_t DebugSessionLinux::writeGpuMemory(uint64_t vmHandle, const char *input, size_t size, uint64_t gpuVa) {
-    prelim_drm_i915_debug_vm_open vmOpen = {
-        .client_handle = static_cast<decltype(prelim_drm_i915_debug_vm_open::client_handle)>(clientHandle),
-        .handle = static_cast<decltype(prelim_drm_i915_debug_vm_open::handle)>(vmHandle),
-        .flags = PRELIM_I915_DEBUG_VM_OPEN_READ_WRITE};
-
-    int vmDebugFd = ioctl(PRELIM_I915_DEBUG_IOCTL_VM_OPEN, &vmOpen);
-    if (vmDebugFd < 0) {
-        PRINT_DEBUGGER_ERROR_LOG("PRELIM_I915_DEBUG_IOCTL_VM_OPEN failed = %d\n", vmDebugFd);
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-
+int64_t DebugSessionLinux::writeGpuMemoryToVmFd(int vmDebugFd, const char *input, size_t size, uint64_t gpuVa) {
     int64_t retVal = 0;
-    auto gmmHelper = connectedDevice->getNEODevice()->getGmmHelper();
-    gpuVa = gmmHelper->decanonize(gpuVa);
 
     if (NEO::DebugManager.flags.EnableDebuggerMmapMemoryAccess.get()) {
         uint64_t alignedMem = alignDown(gpuVa, MemoryConstants::pageSize);
@@ -240,6 +290,116 @@ ze_result_t DebugSessionLinux::writeGpuMemory(uint64_t vmHandle, const char *inp
         retVal = pendingSize;
     }
 
+    return retVal;
+}
+
+ze_result_t DebugSessionLinux::readGpuMemoryCached(uint64_t vmHandle, char *output, size_t size, uint64_t gpuVa) {
+    std::lock_guard<std::mutex> lock(gpuMemoryCacheMutex);
+
+    int vmDebugFd = getCachedVmFd(vmHandle);
+    if (vmDebugFd < 0) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+
+    const uint64_t firstPage = alignDown(gpuVa, MemoryConstants::pageSize);
+    const uint64_t endPage = alignUp(gpuVa + size, MemoryConstants::pageSize);
+    const size_t pagesToRead = static_cast<size_t>((endPage - firstPage) / MemoryConstants::pageSize);
+
+    // after a resume threads rewrite SR counters, SIP commands and state save areas,
+    // so nothing is cached until the next attention reports stopped threads
+    if (!gpuMemoryCacheActive || pagesToRead > maxCachedPages) {
+        return (readGpuMemoryFromVmFd(vmDebugFd, output, size, gpuVa) == 0) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
+    }
+    if (numCachedPages + pagesToRead > maxCachedPages) {
+        cachedPages.clear();
+        numCachedPages = 0;
+    }
+
+    auto &pages = cachedPages[vmHandle];
+
+    // missing adjacent pages are fetched with a single read
+    uint64_t page = firstPage;
+    while (page < endPage) {
+        if (pages.find(page) != pages.end()) {
+            page += MemoryConstants::pageSize;
+            continue;
+        }
+
+        uint64_t rangeEnd = page + MemoryConstants::pageSize;
+        while (rangeEnd < endPage && pages.find(rangeEnd) == pages.end()) {
+            rangeEnd += MemoryConstants::pageSize;
+        }
+
+        const size_t rangeSize = static_cast<size_t>(rangeEnd - page);
+        auto range = std::make_unique<char[]>(rangeSize);
+        if (readGpuMemoryFromVmFd(vmDebugFd, range.get(), rangeSize, page) != 0) {
+            return ZE_RESULT_ERROR_UNKNOWN;
+        }
+
+        for (size_t offset = 0; offset < rangeSize; offset += MemoryConstants::pageSize) {
+            auto pageData = std::make_unique<char[]>(MemoryConstants::pageSize);
+            memcpy_s(pageData.get(), MemoryConstants::pageSize, range.get() + offset, MemoryConstants::pageSize);
+            pages[page + offset] = std::move(pageData);
+            numCachedPages++;
+        }
+        page = rangeEnd;
+    }
+
+    for (page = firstPage; page < endPage; page += MemoryConstants::pageSize) {
+        const uint64_t copyBegin = std::max(page, gpuVa);
+        const uint64_t copyEnd = std::min(page + MemoryConstants::pageSize, gpuVa + size);
+        const size_t copySize = static_cast<size_t>(copyEnd - copyBegin);
+
+        memcpy_s(output + (copyBegin - gpuVa), copySize, pages[page].get() + (copyBegin - page), copySize);
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t DebugSessionLinux::readGpuMemory(uint64_t vmHandle, char *output, size_t size, uint64_t gpuVa) {
+    auto gmmHelper = connectedDevice->getNEODevice()->getGmmHelper();
+    gpuVa = gmmHelper->decanonize(gpuVa);
+
+    if (NEO::DebugManager.flags.EnableDebuggerGpuMemoryCache.get()) {
+        return readGpuMemoryCached(vmHandle, output, size, gpuVa);
+    }
+
+    int vmDebugFd = openVmFd(vmHandle, true);
+    if (vmDebugFd < 0) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+
+    auto retVal = readGpuMemoryFromVmFd(vmDebugFd, output, size, gpuVa);
+
+    NEO::SysCalls::close(vmDebugFd);
+
+    return (retVal == 0) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
+}
+
+ze_result_t DebugSessionLinux::writeGpuMemory(uint64_t vmHandle, const char *input, size_t size, uint64_t gpuVa) {
+    auto gmmHelper = connectedDevice->getNEODevice()->getGmmHelper();
+    gpuVa = gmmHelper->decanonize(gpuVa);
+
+    if (NEO::DebugManager.flags.EnableDebuggerGpuMemoryCache.get()) {
+        int64_t retVal = -1;
+        {
+            std::lock_guard<std::mutex> lock(gpuMemoryCacheMutex);
+            int vmDebugFd = getCachedVmFd(vmHandle);
+            if (vmDebugFd >= 0) {
+                retVal = writeGpuMemoryToVmFd(vmDebugFd, input, size, gpuVa);
+            }
+        }
+        invalidateGpuMemoryCache(vmHandle, gpuVa, size);
+        return (retVal == 0) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
+    }
+
+    int vmDebugFd = openVmFd(vmHandle, false);
+    if (vmDebugFd < 0) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+
+    auto retVal = writeGpuMemoryToVmFd(vmDebugFd, input, size, gpuVa);
+
     NEO::SysCalls::close(vmDebugFd);
 
     return (retVal == 0) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
@@ -681,6 +841,7 @@ void DebugSessionLinux::handleEvent(prelim_drm_i915_debug_event *event) {
         if (event->flags & PRELIM_DRM_I915_DEBUG_EVENT_DESTROY) {
             UNRECOVERABLE_IF(clientHandleToConnection.find(vm->client_handle) == clientHandleToConnection.end());
             clientHandleToConnection[vm->client_handle]->vmIds.erase(static_cast<uint64_t>(vm->handle));
+            closeCachedVmFd(static_cast<uint64_t>(vm->handle));
         }
     } break;
 
@@ -828,6 +989,11 @@ bool DebugSessionLinux::handleVmBindEvent(prelim_drm_i915_debug_event_vm_bind *v
     const bool createEvent = (vmBind->base.flags & PRELIM_DRM_I915_DEBUG_EVENT_CREATE);
     const bool destroyEvent = (vmBind->base.flags & PRELIM_DRM_I915_DEBUG_EVENT_DESTROY);
 
+    if (destroyEvent) {
+        auto gmmHelper = connectedDevice->getNEODevice()->getGmmHelper();
+        invalidateGpuMemoryCache(vmBind->vm_handle, gmmHelper->decanonize(vmBind->va_start), static_cast<size_t>(vmBind->va_length));
+    }
+
     bool shouldAckEvent = true;
 
     if (vmBind->num_uuids > 0 && vmBind->base.size > sizeof(prelim_drm_i915_debug_event_vm_bind)) {
@@ -1260,6 +1426,7 @@ void DebugSessionLinux::handleAttentionEvent(prelim_drm_i915_debug_event_eu_atte
     }
 
     newAttentionRaised(tileIndex);
+    invalidateGpuMemoryCache(true);
 
     if (clientHandleToConnection.find(attention->client_handle) == clientHandleToConnection.end()) {
         return;
@@ -1337,6 +1504,13 @@ void DebugSessionLinux::handleAttentionEvent(prelim_drm_i915_debug_event_eu_atte
                     addThreadToNewlyStoppedFromRaisedAttention(threadId, vmHandle, stateSaveArea.get());
                 }
             }
+
+            // registers of threads stopped by this attention are read from the same copy until resume
+            if (tileSessionsEnabled) {
+                static_cast<TileDebugSessionLinux *>(tileSessions[tileIndex].first)->storeStateSaveAreaSnapshot(vmHandle, std::move(stateSaveArea), stateSaveAreaSize);
+            } else {
+                storeStateSaveAreaSnapshot(vmHandle, std::move(stateSaveArea), stateSaveAreaSize);
+            }
         }
     }
 
@@ -1545,6 +1719,7 @@ ze_result_t DebugSessionLinux::resumeImp(const std::vector<EuThread::ThreadId> &
     std::unique_ptr<uint8_t[]> bitmask;
     size_t bitmaskSize;
 
+    invalidateGpuMemoryCache(false);
     auto result = threadControl(threads, deviceIndex, ThreadControlCmd::Resume, bitmask, bitmaskSize);
 
     return result == 0 ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_NOT_AVAILABLE;
@@ -18,6 +18,7 @@
 #include "level_zero/tools/source/debug/debug_session_imp.h"
 
 #include <atomic>
+#include <map>
 #include <mutex>
 #include <queue>
 #include <unordered_set>
@@ -271,6 +272,15 @@ struct DebugSessionLinux : DebugSessionImp {
 
     ze_result_t readGpuMemory(uint64_t vmHandle, char *output, size_t size, uint64_t gpuVa) override;
     ze_result_t writeGpuMemory(uint64_t vmHandle, const char *input, size_t size, uint64_t gpuVa) override;
+    int openVmFd(uint64_t vmHandle, bool readOnly);
+    int64_t readGpuMemoryFromVmFd(int vmDebugFd, char *output, size_t size, uint64_t gpuVa);
+    int64_t writeGpuMemoryToVmFd(int vmDebugFd, const char *input, size_t size, uint64_t gpuVa);
+    ze_result_t readGpuMemoryCached(uint64_t vmHandle, char *output, size_t size, uint64_t gpuVa);
+    int getCachedVmFd(uint64_t vmHandle);
+    void invalidateGpuMemoryCache(bool threadsStopped);
+    void invalidateGpuMemoryCache(uint64_t vmHandle, uint64_t gpuVa, size_t size);
+    void closeCachedVmFd(uint64_t vmHandle);
+    void closeCachedVmFds();
     ze_result_t getISAVMHandle(uint32_t deviceIndex, const zet_debug_memory_space_desc_t *desc, size_t size, uint64_t &vmHandle);
     bool getIsaInfoForAllInstances(NEO::DeviceBitfield deviceBitfield, const zet_debug_memory_space_desc_t *desc, size_t size, uint64_t vmHandles[], ze_result_t &status);
 
@@ -364,6 +374,15 @@ struct DebugSessionLinux : DebugSessionImp {
     std::unique_ptr<IoctlHandler> ioctlHandler;
     std::atomic<bool> detached{false};
 
+    // VM fds kept open per vmHandle and page-granular copies of memory read while threads are stopped,
+    // used only with EnableDebuggerGpuMemoryCache
+    static constexpr size_t maxCachedPages = 16384;
+    std::mutex gpuMemoryCacheMutex;
+    std::unordered_map<uint64_t, int> cachedVmFds;
+    std::unordered_map<uint64_t, std::map<uint64_t, std::unique_ptr<char[]>>> cachedPages;
+    size_t numCachedPages = 0;
+    bool gpuMemoryCacheActive = false;
+
     uint64_t clientHandle = invalidClientHandle;
     uint64_t clientHandleClosed = invalidClientHandle;
     std::unordered_map<uint64_t, uint32_t> uuidL0CommandQueueHandleToDevice;
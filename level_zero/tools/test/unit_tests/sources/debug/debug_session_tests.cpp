@@ -815,6 +815,31 @@ TEST(DebugSessionTest, givenThreadsToResumeWhenResumeAccidentallyStoppedThreadsC
     EXPECT_TRUE(sessionMock->allThreads[thread2]->isRunning());
 }
 
+TEST(DebugSessionTest, givenStateSaveAreaSnapshotWhenResumeAccidentallyStoppedThreadsCalledThenSnapshotIsInvalidated) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableDebuggerStateSaveAreaSnapshot.set(true);
+
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+    auto hwInfo = *NEO::defaultHwInfo.get();
+
+    NEO::MockDevice *neoDevice(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+    Mock<L0::DeviceImp> deviceImp(neoDevice, neoDevice->getExecutionEnvironment());
+
+    auto sessionMock = std::make_unique<MockDebugSession>(config, &deviceImp);
+
+    EuThread::ThreadId thread = {0, 0, 0, 0, 1};
+    sessionMock->allThreads[thread]->verifyStopped(1u);
+
+    sessionMock->storeStateSaveAreaSnapshot(sessionMock->allThreads[thread]->getMemoryHandle(), std::make_unique<char[]>(16), 16);
+    EXPECT_FALSE(sessionMock->stateSaveAreaSnapshots.empty());
+
+    sessionMock->resumeAccidentallyStoppedThreads({thread});
+
+    EXPECT_EQ(1u, sessionMock->resumeImpCalled);
+    EXPECT_TRUE(sessionMock->stateSaveAreaSnapshots.empty());
+}
+
 TEST(DebugSessionTest, givenCr0RegisterWhenIsFEOrFEHOnlyExceptionReasonThenTrueReturnedForFEorFEHBitsOnly) {
     zet_debug_config_t config = {};
     config.pid = 0x1234;
@@ -2428,6 +2453,56 @@ TEST_F(DebugSessionRegistersAccessTest, givenReadGpuMemoryErrorWhenRegistersAcce
     EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, ret);
 }
 
+TEST_F(DebugSessionRegistersAccessTest, givenStateSaveAreaSnapshotWhenRegistersAccessHelperCalledThenRegistersAreReadFromSnapshotUntilInvalidated) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableDebuggerStateSaveAreaSnapshot.set(true);
+
+    {
+        auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data());
+        auto size = pStateSaveAreaHeader->versionHeader.size * 8 +
+                    pStateSaveAreaHeader->regHeader.state_area_offset +
+                    pStateSaveAreaHeader->regHeader.state_save_size * 16;
+        session->stateSaveAreaHeader.resize(size);
+    }
+
+    const auto snapshotSize = session->stateSaveAreaHeader.size();
+    auto snapshot = std::make_unique<char[]>(snapshotSize);
+    memcpy_s(snapshot.get(), snapshotSize, session->stateSaveAreaHeader.data(), snapshotSize);
+
+    auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data());
+    auto *regdesc = &pStateSaveAreaHeader->regHeader.grf;
+    auto *cmdRegdesc = &pStateSaveAreaHeader->regHeader.cmd;
+    auto thread = session->allThreads[stoppedThreadId].get();
+    auto grfOffset = session->calculateThreadSlotOffset(stoppedThreadId) + regdesc->offset;
+    memset(snapshot.get() + grfOffset, 0x5c, regdesc->bytes);
+
+    session->storeStateSaveAreaSnapshot(thread->getMemoryHandle(), std::move(snapshot), snapshotSize);
+    session->readMemoryResult = ZE_RESULT_ERROR_UNKNOWN;
+
+    std::vector<uint8_t> grf(regdesc->bytes, 0);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(thread, regdesc, 0, 1, grf.data(), false));
+    EXPECT_EQ(std::vector<uint8_t>(regdesc->bytes, 0x5c), grf);
+
+    std::fill(grf.begin(), grf.end(), static_cast<uint8_t>(0x17));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(thread, regdesc, 0, 1, grf.data(), true));
+    std::fill(grf.begin(), grf.end(), static_cast<uint8_t>(0));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(thread, regdesc, 0, 1, grf.data(), false));
+    EXPECT_EQ(std::vector<uint8_t>(regdesc->bytes, 0x17), grf);
+
+    std::vector<uint8_t> cmd(cmdRegdesc->bytes, 0);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, session->registersAccessHelper(thread, cmdRegdesc, 0, 1, cmd.data(), false));
+
+    session->invalidateStateSaveAreaSnapshots();
+    EXPECT_TRUE(session->stateSaveAreaSnapshots.empty());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, session->registersAccessHelper(thread, regdesc, 0, 1, grf.data(), false));
+}
+
+TEST_F(DebugSessionRegistersAccessTest, givenStateSaveAreaSnapshotDisabledWhenStoringSnapshotThenSnapshotIsNotKept) {
+    auto snapshot = std::make_unique<char[]>(session->stateSaveAreaHeader.size());
+    session->storeStateSaveAreaSnapshot(1u, std::move(snapshot), session->stateSaveAreaHeader.size());
+    EXPECT_TRUE(session->stateSaveAreaSnapshots.empty());
+}
+
 TEST_F(DebugSessionRegistersAccessTest, givenNoStateSaveAreaWhenReadRegisterCalledThenErrorUnknownReturned) {
     session->stateSaveAreaHeader.clear();
 
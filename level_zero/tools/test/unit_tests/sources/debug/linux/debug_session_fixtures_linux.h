@@ -78,6 +78,7 @@ struct MockIoctlHandler : public L0::DebugSessionLinux::IoctlHandler {
         } else if ((request == PRELIM_I915_DEBUG_IOCTL_VM_OPEN) && (arg != nullptr)) {
             prelim_drm_i915_debug_vm_open *vmOpenIn = reinterpret_cast<prelim_drm_i915_debug_vm_open *>(arg);
             vmOpen = *vmOpenIn;
+            vmOpenCalled++;
             return vmOpenRetVal;
         } else if ((request == PRELIM_I915_DEBUG_IOCTL_EU_CONTROL) && (arg != nullptr)) {
             prelim_drm_i915_debug_eu_control *euControlArg = reinterpret_cast<prelim_drm_i915_debug_eu_control *>(arg);
@@ -219,6 +220,7 @@ struct MockIoctlHandler : public L0::DebugSessionLinux::IoctlHandler {
     int ioctlCalled = 0;
     int pollRetVal = 0;
     int vmOpenRetVal = 600;
+    int vmOpenCalled = 0;
     int passedTimeout = 0;
 
     ArrayRef<char> pReadArrayRef;
@@ -268,12 +270,15 @@ struct MockDebugSessionLinux : public L0::DebugSessionLinux {
 
     using L0::DebugSessionLinux::asyncThread;
     using L0::DebugSessionLinux::blockOnFenceMode;
+    using L0::DebugSessionLinux::cachedPages;
+    using L0::DebugSessionLinux::cachedVmFds;
     using L0::DebugSessionLinux::checkAllEventsCollected;
     using L0::DebugSessionLinux::checkStoppedThreadsAndGenerateEvents;
     using L0::DebugSessionLinux::clientHandle;
     using L0::DebugSessionLinux::clientHandleClosed;
     using L0::DebugSessionLinux::clientHandleToConnection;
     using L0::DebugSessionLinux::closeAsyncThread;
+    using L0::DebugSessionLinux::closeCachedVmFds;
     using L0::DebugSessionLinux::closeInternalEventsThread;
     using L0::DebugSessionLinux::createTileSessionsIfEnabled;
     using L0::DebugSessionLinux::debugArea;
@@ -288,6 +293,7 @@ struct MockDebugSessionLinux : public L0::DebugSessionLinux {
     using L0::DebugSessionLinux::getRegisterSetProperties;
     using L0::DebugSessionLinux::getSbaBufferGpuVa;
     using L0::DebugSessionLinux::getStateSaveAreaHeader;
+    using L0::DebugSessionLinux::gpuMemoryCacheActive;
     using L0::DebugSessionLinux::handleEvent;
     using L0::DebugSessionLinux::handleEventsAsync;
     using L0::DebugSessionLinux::handleVmBindEvent;
@@ -297,6 +303,7 @@ struct MockDebugSessionLinux : public L0::DebugSessionLinux {
     using L0::DebugSessionLinux::ioctl;
     using L0::DebugSessionLinux::ioctlHandler;
     using L0::DebugSessionLinux::newlyStoppedThreads;
+    using L0::DebugSessionLinux::numCachedPages;
     using L0::DebugSessionLinux::pendingInterrupts;
     using L0::DebugSessionLinux::pendingVmBindEvents;
     using L0::DebugSessionLinux::printContextVms;
@@ -1399,6 +1399,173 @@ TEST_F(DebugApiLinuxTest, GivenDebuggerMmapMemoryAccessFalseWhenPreadFailsThenEr
     EXPECT_EQ(0u, handler->mmapCalled);
 }
 
+TEST_F(DebugApiLinuxTest, GivenGpuMemoryCacheEnabledWhenReadingSameMemoryTwiceThenVmIsOpenedOnceAndMemoryIsReadOnce) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableDebuggerGpuMemoryCache.set(true);
+
+    auto session = std::make_unique<MockDebugSessionLinux>(zet_debug_config_t{0x1234}, device, 10);
+    ASSERT_NE(nullptr, session);
+
+    auto handler = new MockIoctlHandler;
+    session->ioctlHandler.reset(handler);
+    session->gpuMemoryCacheActive = true;
+
+    NEO::SysCalls::closeFuncCalled = 0;
+    handler->preadRetVal = MemoryConstants::pageSize;
+
+    char output[bufferSize] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readGpuMemory(7, output, bufferSize, 0x23010));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readGpuMemory(7, output, bufferSize, 0x23100));
+
+    EXPECT_EQ(1, handler->vmOpenCalled);
+    EXPECT_EQ(static_cast<uint64_t>(PRELIM_I915_DEBUG_VM_OPEN_READ_WRITE), handler->vmOpen.flags);
+    EXPECT_EQ(1u, handler->preadCalled);
+    EXPECT_EQ(0x23000u, handler->preadOffset);
+    EXPECT_EQ(0u, NEO::SysCalls::closeFuncCalled);
+    EXPECT_EQ(1u, session->numCachedPages);
+
+    for (int i = 0; i < bufferSize; i++) {
+        EXPECT_EQ(static_cast<char>(0xaa), output[i]);
+    }
+
+    handler->pwriteRetVal = bufferSize;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->writeGpuMemory(7, output, bufferSize, 0x23100));
+    EXPECT_EQ(1, handler->vmOpenCalled);
+    EXPECT_EQ(0u, session->numCachedPages);
+
+    session->closeCachedVmFds();
+    EXPECT_EQ(1u, NEO::SysCalls::closeFuncCalled);
+    EXPECT_EQ(handler->vmOpenRetVal, NEO::SysCalls::closeFuncArgPassed);
+    EXPECT_TRUE(session->cachedVmFds.empty());
+}
+
+TEST_F(DebugApiLinuxTest, GivenGpuMemoryCacheEnabledWhenReadingRangeWithMissingAdjacentPagesThenMissingPagesAreReadWithSinglePread) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableDebuggerGpuMemoryCache.set(true);
+
+    auto session = std::make_unique<MockDebugSessionLinux>(zet_debug_config_t{0x1234}, device, 10);
+    ASSERT_NE(nullptr, session);
+
+    auto handler = new MockIoctlHandler;
+    session->ioctlHandler.reset(handler);
+    session->gpuMemoryCacheActive = true;
+
+    constexpr uint64_t baseVa = 0x40000;
+    constexpr size_t memorySize = 6 * MemoryConstants::pageSize;
+    auto memory = std::make_unique<char[]>(memorySize);
+    for (size_t i = 0; i < memorySize; i++) {
+        memory[i] = static_cast<char>(i * 7);
+    }
+    handler->setPreadMemory(memory.get(), memorySize, baseVa);
+
+    char output[bufferSize] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readGpuMemory(7, output, bufferSize, baseVa + MemoryConstants::pageSize));
+    EXPECT_EQ(1u, handler->preadCalled);
+
+    handler->preadCalled = 0;
+    constexpr size_t readSize = 4 * MemoryConstants::pageSize;
+    auto largeOutput = std::make_unique<char[]>(readSize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readGpuMemory(7, largeOutput.get(), readSize, baseVa + 0x100));
+
+    // page 0 and pages 2-4 are missing, page 1 is served from cache
+    EXPECT_EQ(2u, handler->preadCalled);
+    EXPECT_EQ(baseVa + 2 * MemoryConstants::pageSize, handler->preadOffset);
+    EXPECT_EQ(5u, session->numCachedPages);
+    EXPECT_EQ(0, memcmp(memory.get() + 0x100, largeOutput.get(), readSize));
+
+    handler->preadCalled = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readGpuMemory(7, largeOutput.get(), readSize, baseVa + 0x100));
+    EXPECT_EQ(0u, handler->preadCalled);
+    EXPECT_EQ(1, handler->vmOpenCalled);
+}
+
+TEST_F(DebugApiLinuxTest, GivenGpuMemoryCacheEnabledWhenVmUnbindResumeOrVmDestroyIsHandledThenCachedMemoryIsInvalidated) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableDebuggerGpuMemoryCache.set(true);
+
+    auto session = std::make_unique<MockDebugSessionLinux>(zet_debug_config_t{0x1234}, device, 10);
+    ASSERT_NE(nullptr, session);
+
+    auto handler = new MockIoctlHandler;
+    session->ioctlHandler.reset(handler);
+    session->gpuMemoryCacheActive = true;
+    handler->preadRetVal = 2 * MemoryConstants::pageSize;
+
+    char output[bufferSize] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readGpuMemory(7, output, bufferSize, 0x23ff8));
+    EXPECT_EQ(2u, session->numCachedPages);
+
+    prelim_drm_i915_debug_event_vm_bind vmBind = {};
+    vmBind.base.type = PRELIM_DRM_I915_DEBUG_EVENT_VM_BIND;
+    vmBind.base.flags = PRELIM_DRM_I915_DEBUG_EVENT_DESTROY;
+    vmBind.base.size = sizeof(prelim_drm_i915_debug_event_vm_bind);
+    vmBind.client_handle = MockDebugSessionLinux::mockClientHandle;
+    vmBind.vm_handle = 7;
+    vmBind.va_start = 0x24000;
+    vmBind.va_length = MemoryConstants::pageSize;
+    vmBind.num_uuids = 0;
+    session->handleVmBindEvent(&vmBind);
+    EXPECT_EQ(1u, session->numCachedPages);
+
+    session->resumeImp({}, 0);
+    EXPECT_EQ(0u, session->numCachedPages);
+
+    session->gpuMemoryCacheActive = true;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readGpuMemory(7, output, bufferSize, 0x23ff8));
+    EXPECT_EQ(2u, handler->preadCalled);
+
+    NEO::SysCalls::closeFuncCalled = 0;
+    session->clientHandleToConnection[MockDebugSessionLinux::mockClientHandle]->vmIds.emplace(7u);
+
+    prelim_drm_i915_debug_event_vm vmEvent = {};
+    vmEvent.base.type = PRELIM_DRM_I915_DEBUG_EVENT_VM;
+    vmEvent.base.flags = PRELIM_DRM_I915_DEBUG_EVENT_DESTROY;
+    vmEvent.base.size = sizeof(prelim_drm_i915_debug_event_vm);
+    vmEvent.client_handle = MockDebugSessionLinux::mockClientHandle;
+    vmEvent.handle = 7;
+    session->handleEvent(&vmEvent.base);
+
+    EXPECT_EQ(1u, NEO::SysCalls::closeFuncCalled);
+    EXPECT_EQ(0u, session->numCachedPages);
+    EXPECT_TRUE(session->cachedVmFds.empty());
+}
+
+TEST_F(DebugApiLinuxTest, GivenGpuMemoryCacheEnabledWhenResumeIdentChangesAfterResumeThenEveryPollReadsCurrentMemory) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableDebuggerGpuMemoryCache.set(true);
+
+    auto session = std::make_unique<MockDebugSessionLinux>(zet_debug_config_t{0x1234}, device, 10);
+    ASSERT_NE(nullptr, session);
+
+    auto handler = new MockIoctlHandler;
+    session->ioctlHandler.reset(handler);
+
+    constexpr uint64_t srIdentVa = 0x50000;
+    char memory[MemoryConstants::pageSize] = {};
+    handler->setPreadMemory(memory, sizeof(memory), srIdentVa);
+
+    // threads stopped, reads are cached
+    session->gpuMemoryCacheActive = true;
+    uint8_t srCounter = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readGpuMemory(7, reinterpret_cast<char *>(&srCounter), sizeof(srCounter), srIdentVa));
+    EXPECT_EQ(0u, srCounter);
+    EXPECT_EQ(1u, handler->preadCalled);
+
+    session->resumeImp({}, 0);
+    EXPECT_FALSE(session->gpuMemoryCacheActive);
+
+    // polling the SR counter after resume must observe the value written by the resumed thread
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readGpuMemory(7, reinterpret_cast<char *>(&srCounter), sizeof(srCounter), srIdentVa));
+    EXPECT_EQ(0u, srCounter);
+
+    memory[0] = 1;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->readGpuMemory(7, reinterpret_cast<char *>(&srCounter), sizeof(srCounter), srIdentVa));
+    EXPECT_EQ(1u, srCounter);
+    EXPECT_EQ(3u, handler->preadCalled);
+    EXPECT_EQ(0u, session->numCachedPages);
+    EXPECT_EQ(1, handler->vmOpenCalled);
+}
+
 TEST_F(DebugApiLinuxTest, WhenCallingWriteGpuMemoryThenMemoryIsWritten) {
     auto session = std::make_unique<MockDebugSessionLinux>(zet_debug_config_t{0x1234}, device, 10);
     ASSERT_NE(nullptr, session);
@@ -151,16 +151,19 @@ struct MockDebugSession : public L0::DebugSessionImp {
     using L0::DebugSessionImp::generateEventsForStoppedThreads;
     using L0::DebugSessionImp::getRegisterSize;
     using L0::DebugSessionImp::getStateSaveAreaHeader;
+    using L0::DebugSessionImp::invalidateStateSaveAreaSnapshots;
     using L0::DebugSessionImp::newAttentionRaised;
     using L0::DebugSessionImp::readSbaRegisters;
     using L0::DebugSessionImp::registersAccessHelper;
     using L0::DebugSessionImp::resumeAccidentallyStoppedThreads;
     using L0::DebugSessionImp::sendInterrupts;
+    using L0::DebugSessionImp::storeStateSaveAreaSnapshot;
     using L0::DebugSessionImp::typeToRegsetDesc;
     using L0::DebugSessionImp::validateAndSetStateSaveAreaHeader;
 
     using L0::DebugSessionImp::interruptSent;
     using L0::DebugSessionImp::stateSaveAreaHeader;
+    using L0::DebugSessionImp::stateSaveAreaSnapshots;
     using L0::DebugSessionImp::triggerEvents;
 
     using L0::DebugSessionImp::expectedAttentionEvents;
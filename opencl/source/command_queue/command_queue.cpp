@@ -25,6 +25,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/utilities/api_intercept.h"
@@ -98,6 +99,10 @@ CommandQueue::CommandQueue(Context *context, ClDevice *device, const cl_queue_pr
     storeProperties(properties);
     processProperties(properties);
 
+    if (DebugManager.flags.StagingBufferChunkSizeInKb.get() > 0) {
+        stagingBufferChunkSize = static_cast<size_t>(DebugManager.flags.StagingBufferChunkSizeInKb.get()) * MemoryConstants::kiloByte;
+    }
+
     if (device) {
         auto &hwInfo = device->getHardwareInfo();
         auto &gfxCoreHelper = device->getGfxCoreHelper();
@@ -154,6 +159,8 @@ CommandQueue::~CommandQueue() {
         }
     }
 
+    releaseStagingBuffers();
+
     timestampPacketContainer.reset();
     // for normal queue, decrement ref count on context
     // special queue is owned by context so ref count doesn't have to be decremented
@@ -172,6 +179,10 @@ void CommandQueue::initializeGpgpu() const {
             auto engineRoundRobinAvailable = productHelper.isAssignEngineRoundRobinSupported() &&
                                              this->isAssignEngineRoundRobinEnabled();
 
+            if (DebugManager.flags.CmdQEngineAssignPolicy.get() >= 1) {
+                engineRoundRobinAvailable = true;
+            }
+
             if (DebugManager.flags.EnableCmdQRoundRobindEngineAssign.get() != -1) {
                 engineRoundRobinAvailable = DebugManager.flags.EnableCmdQRoundRobindEngineAssign.get();
             }
@@ -215,6 +226,9 @@ void CommandQueue::initializeGpgpuInternals() const {
     }
 
     gpgpuEngine->commandStreamReceiver->initializeResources();
+    if (!gpgpuEngine->commandStreamReceiver->ensureEngineResourcesCreated()) {
+        this->engineInitializationFailed = true;
+    }
     gpgpuEngine->commandStreamReceiver->initDirectSubmission();
 
     if (getCmdQueueProperties<cl_queue_properties>(propertiesVector.data(), CL_QUEUE_PROPERTIES) & static_cast<cl_queue_properties>(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) && !this->gpgpuEngine->commandStreamReceiver->isUpdateTagFromWaitEnabled()) {
@@ -338,6 +352,9 @@ void CommandQueue::constructBcsEngine(bool internalUsage) {
         if (bcsEngines[bcsIndex]) {
             bcsQueueEngineType = bcsEngineType;
             bcsEngines[bcsIndex]->osContext->ensureContextInitialized();
+            if (!bcsEngines[bcsIndex]->commandStreamReceiver->ensureEngineResourcesCreated()) {
+                this->engineInitializationFailed = true;
+            }
             bcsEngines[bcsIndex]->commandStreamReceiver->initDirectSubmission();
         }
         bcsInitialized = true;
@@ -366,6 +383,9 @@ void CommandQueue::constructBcsEnginesForSplit() {
             if (bcsEngines[i]) {
                 bcsQueueEngineType = engineType;
                 bcsEngines[i]->commandStreamReceiver->initializeResources();
+                if (!bcsEngines[i]->commandStreamReceiver->ensureEngineResourcesCreated()) {
+                    this->engineInitializationFailed = true;
+                }
                 bcsEngines[i]->commandStreamReceiver->initDirectSubmission();
             }
         }
@@ -1016,6 +1036,106 @@ bool CommandQueue::bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandT
     return false;
 }
 
+bool CommandQueue::isStagingBufferWriteAllowed(cl_bool blocking, size_t size, cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
+    if (DebugManager.flags.EnableStagingBufferForPageableWrites.get() != 1) {
+        return false;
+    }
+
+    // the whole transfer is tracked by events of the last chunks, which is valid only for in-order queues without profiling
+    if (blocking == CL_FALSE || isOOQEnabled() || isProfilingEnabled() || context->getSVMAllocsManager() == nullptr) {
+        return false;
+    }
+
+    // chunks are refilled on CPU after waiting for previous copies, these waits can't depend on user events
+    if (Event::checkUserEventDependencies(numEventsInWaitList, eventWaitList)) {
+        return false;
+    }
+
+    if (size < stagingBufferChunkSize) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(stagingBuffersMutex);
+    if (stagingBuffers.empty()) {
+        size_t ringDepth = 4u;
+        if (DebugManager.flags.StagingBufferRingDepth.get() > 1) {
+            ringDepth = static_cast<size_t>(DebugManager.flags.StagingBufferRingDepth.get());
+        }
+
+        SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, MemoryConstants::pageSize64k,
+                                                                          context->getRootDeviceIndices(), context->getDeviceBitfields());
+        for (size_t i = 0; i < ringDepth; i++) {
+            auto stagingBuffer = context->getSVMAllocsManager()->createHostUnifiedMemoryAllocation(stagingBufferChunkSize, unifiedMemoryProperties);
+            if (stagingBuffer == nullptr) {
+                releaseStagingBuffers();
+                return false;
+            }
+            stagingBuffers.push_back(stagingBuffer);
+        }
+    }
+    return true;
+}
+
+cl_int CommandQueue::enqueueStagingWriteBuffer(Buffer *buffer, size_t offset, size_t size, const void *ptr,
+                                               cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) {
+    // chunk k is copied by GPU while CPU fills chunk k+1, a chunk is refilled only after its previous copy completed
+    std::lock_guard<std::mutex> lock(stagingBuffersMutex);
+    std::vector<cl_event> chunkEvents(stagingBuffers.size(), nullptr);
+    cl_int retVal = CL_SUCCESS;
+    size_t lastChunk = 0;
+
+    for (size_t chunk = 0, chunkOffset = 0; chunkOffset < size; chunk++) {
+        lastChunk = chunk % stagingBuffers.size();
+        auto &chunkEvent = chunkEvents[lastChunk];
+        if (chunkEvent) {
+            retVal = Event::waitForEvents(1, &chunkEvent);
+            castToObjectOrAbort<Event>(chunkEvent)->release();
+            chunkEvent = nullptr;
+            if (retVal != CL_SUCCESS) {
+                break;
+            }
+        }
+
+        auto chunkSize = std::min(stagingBufferChunkSize, size - chunkOffset);
+        memcpy_s(stagingBuffers[lastChunk], stagingBufferChunkSize, ptrOffset(ptr, chunkOffset), chunkSize);
+
+        retVal = enqueueWriteBuffer(buffer, CL_FALSE, offset + chunkOffset, chunkSize, stagingBuffers[lastChunk], nullptr,
+                                    chunk == 0 ? numEventsInWaitList : 0u, chunk == 0 ? eventWaitList : nullptr, &chunkEvent);
+        if (retVal == CL_SUCCESS) {
+            retVal = flush();
+        }
+        if (retVal != CL_SUCCESS) {
+            break;
+        }
+        chunkOffset += chunkSize;
+    }
+
+    for (size_t i = 0; i < chunkEvents.size(); i++) {
+        if (chunkEvents[i] == nullptr) {
+            continue;
+        }
+        auto waitRetVal = Event::waitForEvents(1, &chunkEvents[i]);
+        if (retVal == CL_SUCCESS) {
+            retVal = waitRetVal;
+        }
+        // in-order queue, last chunk completes the whole transfer
+        if (event && i == lastChunk && retVal == CL_SUCCESS) {
+            *event = chunkEvents[i];
+        } else {
+            castToObjectOrAbort<Event>(chunkEvents[i])->release();
+        }
+    }
+
+    return retVal;
+}
+
+void CommandQueue::releaseStagingBuffers() {
+    for (auto stagingBuffer : stagingBuffers) {
+        context->getSVMAllocsManager()->freeSVMAlloc(stagingBuffer, true);
+    }
+    stagingBuffers.clear();
+}
+
 bool CommandQueue::queueDependenciesClearRequired() const {
     return isOOQEnabled() || DebugManager.flags.OmitTimestampPacketDependencies.get();
 }
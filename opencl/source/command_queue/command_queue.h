@@ -24,6 +24,7 @@
 #include "opencl/source/helpers/properties_helper.h"
 
 #include <cstdint>
+#include <mutex>
 #include <optional>
 
 enum InternalMemoryType : uint32_t;
@@ -390,6 +391,10 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     void overrideEngine(aub_stream::EngineType engineType, EngineUsage engineUsage);
     bool bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandType, cl_bool blocking, size_t size, void *ptr,
                               cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    bool isStagingBufferWriteAllowed(cl_bool blocking, size_t size, cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    cl_int enqueueStagingWriteBuffer(Buffer *buffer, size_t offset, size_t size, const void *ptr,
+                                     cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event);
+    void releaseStagingBuffers();
     void providePerformanceHint(TransferProperties &transferProperties);
     bool queueDependenciesClearRequired() const;
     bool blitEnqueueAllowed(const CsrSelectionArgs &args) const;
@@ -434,6 +439,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     bool isCopyOnly = false;
     bool bcsAllowed = false;
     bool bcsInitialized = false;
+    // engine resources created on first use could not be allocated, enqueues return CL_OUT_OF_RESOURCES
+    mutable bool engineInitializationFailed = false;
 
     bool bcsSplitInitialized = false;
     BcsInfoMask splitEngines = EngineHelpers::oddLinkedCopyEnginesMask;
@@ -446,6 +453,11 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     bool isSpecialCommandQueue = false;
     bool requiresCacheFlushAfterWalker = false;
 
+    // host USM chunks used to stream writes from pageable host memory, see enqueueStagingWriteBuffer
+    std::vector<void *> stagingBuffers;
+    std::mutex stagingBuffersMutex;
+    size_t stagingBufferChunkSize = 2 * MemoryConstants::megaByte;
+
     std::unique_ptr<TimestampPacketContainer> deferredTimestampPackets;
     std::unique_ptr<TimestampPacketContainer> deferredMultiRootSyncNodes;
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
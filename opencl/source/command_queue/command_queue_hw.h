@@ -90,6 +90,9 @@ class CommandQueueHw : public CommandQueue {
         for (const EngineControl *engine : bcsEngines) {
             if (engine != nullptr) {
                 engine->osContext->ensureContextInitialized();
+                if (!engine->commandStreamReceiver->ensureEngineResourcesCreated()) {
+                    this->engineInitializationFailed = true;
+                }
                 engine->commandStreamReceiver->initDirectSubmission();
             }
         }
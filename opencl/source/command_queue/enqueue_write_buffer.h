@@ -58,6 +58,10 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
                                                   numEventsInWaitList, eventWaitList, event);
     }
 
+    if (!mapAllocation && isStagingBufferWriteAllowed(blockingWrite, size, numEventsInWaitList, eventWaitList)) {
+        return enqueueStagingWriteBuffer(buffer, offset, size, ptr, numEventsInWaitList, eventWaitList, event);
+    }
+
     auto eBuiltInOps = EBuiltInOps::CopyBufferToBuffer;
     if (forceStateless(buffer->getSize())) {
         eBuiltInOps = EBuiltInOps::CopyBufferToBufferStateless;
@@ -18,6 +18,7 @@
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/image_tiling_helper.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -303,6 +304,12 @@ Image *Image::create(Context *context,
         bool isCpuTransferPreferred = imgInfo.linearStorage && defaultGfxCoreHelper.isCpuImageTransferPreferred(defaultHwInfo);
         bool isCpuTransferPreferredInSystemMemory = imgInfo.linearStorage && allocationInSystemMemory;
 
+        auto tilingMode = ImageTilingHelper::getTilingMode(memory->getDefaultGmm());
+        bool isCpuTilingPreferred = !imgInfo.linearStorage && ImageTilingHelper::isCpuTilingEnabled() &&
+                                    (tilingMode == ImageTilingMode::TileY || tilingMode == ImageTilingMode::Tile4) &&
+                                    !memory->isCompressionEnabled() && !Image::isImage1d(*imageDesc) &&
+                                    !isNV12Image(&image->getImageFormat());
+
         if (isCpuTransferPreferredInSystemMemory) {
             void *pDestinationAddress = memory->getUnderlyingBuffer();
             image->transferData(pDestinationAddress, imgInfo.rowPitch, imgInfo.slicePitch,
@@ -316,6 +323,24 @@ Image *Image::create(Context *context,
                                 copyRegion, copyOrigin);
             context->getMemoryManager()->unlockResource(memory);
 
+        } else if (isCpuTilingPreferred) {
+            TiledImageCopyArgs tilingArgs;
+            tilingArgs.tilingMode = tilingMode;
+            tilingArgs.tiledPtr = allocationInSystemMemory ? memory->getUnderlyingBuffer() : context->getMemoryManager()->lockResource(memory);
+            tilingArgs.tiledRowPitch = imgInfo.rowPitch;
+            tilingArgs.tiledSlicePitch = imgInfo.slicePitch;
+            tilingArgs.linearPtr = const_cast<void *>(hostPtr);
+            tilingArgs.linearRowPitch = hostPtrRowPitch;
+            tilingArgs.linearSlicePitch = hostPtrSlicePitch;
+            tilingArgs.region = {copyRegion[0] * surfaceFormat->surfaceFormat.imageElementSizeInBytes, copyRegion[1], copyRegion[2]};
+            tilingArgs.workerPool = context->getMemoryManager()->getWorkerPool();
+
+            ImageTilingHelper::copyLinearToTiled(tilingArgs);
+
+            if (!allocationInSystemMemory) {
+                context->getMemoryManager()->unlockResource(memory);
+            }
+
         } else {
             auto cmdQ = context->getSpecialQueue(defaultRootDeviceIndex);
             if (isNV12Image(&image->getImageFormat())) {
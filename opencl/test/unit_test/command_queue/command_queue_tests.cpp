@@ -151,6 +151,42 @@ TEST(CommandQueue, WhenConstructingCommandQueueThenQueueFamilyIsNotSelected) {
     EXPECT_FALSE(cmdQ.isQueueFamilySelected());
 }
 
+HWTEST(CommandQueue, givenDeferredEngineResourcesCreationFailureWhenEnqueueingThenOutOfResourcesIsReturned) {
+    auto mockDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    MockContext context(mockDevice.get());
+
+    for (auto &engine : mockDevice->getDevice().getAllEngines()) {
+        auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(engine.commandStreamReceiver);
+        ultCsr->deferEngineResourcesCreation();
+        ultCsr->createEngineResourcesReturnValue = false;
+    }
+
+    {
+        MockCommandQueueHw<FamilyType> cmdQ(&context, mockDevice.get(), nullptr);
+        cmdQ.getGpgpuCommandStreamReceiver();
+        EXPECT_TRUE(cmdQ.engineInitializationFailed);
+        EXPECT_EQ(CL_OUT_OF_RESOURCES, cmdQ.enqueueMarkerWithWaitList(0, nullptr, nullptr));
+    }
+
+    for (auto &engine : mockDevice->getDevice().getAllEngines()) {
+        auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(engine.commandStreamReceiver);
+        ultCsr->createEngineResourcesReturnValue = true;
+        EXPECT_TRUE(ultCsr->ensureEngineResourcesCreated());
+    }
+}
+
+HWTEST(CommandQueue, givenDirectSubmissionInitializationFailureWhenEnqueueingThenEngineInitializationIsNotReportedAsFailed) {
+    VariableBackup<UltHwConfig> backup(&ultHwConfig);
+    auto mockDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    MockContext context(mockDevice.get());
+
+    ultHwConfig.csrFailInitDirectSubmission = true;
+    MockCommandQueueHw<FamilyType> cmdQ(&context, mockDevice.get(), nullptr);
+
+    cmdQ.getGpgpuCommandStreamReceiver();
+    EXPECT_FALSE(cmdQ.engineInitializationFailed);
+}
+
 TEST(CommandQueue, givenEnableTimestampWaitWhenCheckIsTimestampWaitEnabledThenReturnProperValue) {
     DebugManagerStateRestore restorer;
     VariableBackup<UltHwConfig> backup(&ultHwConfig);
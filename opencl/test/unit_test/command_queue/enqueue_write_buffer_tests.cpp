@@ -611,3 +611,97 @@ HWTEST_F(EnqueueWriteBufferHw, givenHostPtrIsFromMappedBufferWhenWriteBufferIsCa
     EXPECT_EQ(CL_SUCCESS, retVal);
     EXPECT_EQ(1u, csr.createAllocationForHostSurfaceCalled);
 }
+
+HWTEST_F(EnqueueWriteBufferHw, givenStagingBufferEnabledWhenBlockingWriteFromPageableMemoryThenDataIsCopiedInChunksThroughStagingBuffers) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.DisableZeroCopyForBuffers.set(1);
+    DebugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
+    DebugManager.flags.EnableStagingBufferForPageableWrites.set(1);
+    DebugManager.flags.StagingBufferChunkSizeInKb.set(4);
+    DebugManager.flags.StagingBufferRingDepth.set(2);
+
+    MockCommandQueueHw<FamilyType> queue(context.get(), device.get(), nullptr);
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+
+    constexpr size_t writeSize = 5 * MemoryConstants::pageSize - 1;
+    cl_int retVal = CL_SUCCESS;
+    auto buffer = clUniquePtr(Buffer::create(context.get(), 0, writeSize, nullptr, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    auto hostPtr = std::make_unique<char[]>(writeSize);
+    cl_event event = nullptr;
+    retVal = queue.enqueueWriteBuffer(buffer.get(), CL_TRUE, 0, writeSize, hostPtr.get(), nullptr, 0, nullptr, &event);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(6u, queue.enqueueWriteBufferCounter);
+    EXPECT_EQ(0u, csr.createAllocationForHostSurfaceCalled);
+    EXPECT_EQ(MemoryConstants::pageSize, queue.stagingBufferChunkSize);
+    ASSERT_EQ(2u, queue.stagingBuffers.size());
+    for (auto stagingBuffer : queue.stagingBuffers) {
+        EXPECT_NE(nullptr, context->getSVMAllocsManager()->getSVMAlloc(stagingBuffer));
+    }
+
+    ASSERT_NE(nullptr, event);
+    auto pEvent = castToObject<Event>(event);
+    EXPECT_EQ(static_cast<cl_command_type>(CL_COMMAND_WRITE_BUFFER), pEvent->getCommandType());
+    EXPECT_TRUE(pEvent->updateStatusAndCheckCompletion());
+    pEvent->release();
+}
+
+HWTEST_F(EnqueueWriteBufferHw, givenStagingBufferEnabledWhenWriteIsNonBlockingOrSmallerThanChunkThenStagingBuffersAreNotUsed) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.DisableZeroCopyForBuffers.set(1);
+    DebugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
+    DebugManager.flags.EnableStagingBufferForPageableWrites.set(1);
+    DebugManager.flags.StagingBufferChunkSizeInKb.set(4);
+
+    MockCommandQueueHw<FamilyType> queue(context.get(), device.get(), nullptr);
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+
+    constexpr size_t writeSize = 2 * MemoryConstants::pageSize;
+    cl_int retVal = CL_SUCCESS;
+    auto buffer = clUniquePtr(Buffer::create(context.get(), 0, writeSize, nullptr, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto hostPtr = std::make_unique<char[]>(writeSize);
+
+    retVal = queue.enqueueWriteBuffer(buffer.get(), CL_FALSE, 0, writeSize, hostPtr.get(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, queue.enqueueWriteBufferCounter);
+    EXPECT_EQ(1u, csr.createAllocationForHostSurfaceCalled);
+
+    retVal = queue.enqueueWriteBuffer(buffer.get(), CL_TRUE, 0, MemoryConstants::pageSize - 1, hostPtr.get(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(2u, queue.enqueueWriteBufferCounter);
+    EXPECT_EQ(2u, csr.createAllocationForHostSurfaceCalled);
+    EXPECT_TRUE(queue.stagingBuffers.empty());
+}
+
+HWTEST_F(EnqueueWriteBufferHw, givenStagingBufferChunkSizeChangedAfterQueueCreationWhenBlockingWriteFromPageableMemoryThenChunkSizeOfRingIsUsed) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.DisableZeroCopyForBuffers.set(1);
+    DebugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
+    DebugManager.flags.EnableStagingBufferForPageableWrites.set(1);
+    DebugManager.flags.StagingBufferChunkSizeInKb.set(4);
+    DebugManager.flags.StagingBufferRingDepth.set(2);
+
+    MockCommandQueueHw<FamilyType> queue(context.get(), device.get(), nullptr);
+    EXPECT_EQ(MemoryConstants::pageSize, queue.stagingBufferChunkSize);
+
+    DebugManager.flags.StagingBufferChunkSizeInKb.set(16);
+
+    constexpr size_t writeSize = 3 * MemoryConstants::pageSize;
+    cl_int retVal = CL_SUCCESS;
+    auto buffer = clUniquePtr(Buffer::create(context.get(), 0, writeSize, nullptr, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto hostPtr = std::make_unique<char[]>(writeSize);
+
+    retVal = queue.enqueueWriteBuffer(buffer.get(), CL_TRUE, 0, writeSize, hostPtr.get(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(4u, queue.enqueueWriteBufferCounter);
+    EXPECT_EQ(MemoryConstants::pageSize, queue.stagingBufferChunkSize);
+    ASSERT_EQ(2u, queue.stagingBuffers.size());
+    for (auto stagingBuffer : queue.stagingBuffers) {
+        EXPECT_EQ(MemoryConstants::pageSize, context->getSVMAllocsManager()->getSVMAlloc(stagingBuffer)->size);
+    }
+}
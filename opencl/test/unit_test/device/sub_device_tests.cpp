@@ -13,6 +13,7 @@
 #include "shared/test/common/helpers/dispatch_flags_helper.h"
 #include "shared/test/common/helpers/ult_hw_config.h"
 #include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
@@ -1077,6 +1078,48 @@ HWTEST_F(EngineInstancedDeviceTests, givenCmdQRoundRobindEngineAssignBitfieldwWe
     }
 }
 
+HWTEST_F(EngineInstancedDeviceTests, givenLeastLoadedCmdQEngineAssignPolicyWhenCreateCommandQueueThenEngineWithFewestPendingTasksAndClientsIsAssigned) {
+    constexpr uint32_t genericDevicesCount = 1;
+    constexpr uint32_t ccsCount = 4;
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CmdQEngineAssignPolicy.set(1);
+
+    if (!createDevices(genericDevicesCount, ccsCount)) {
+        GTEST_SKIP();
+    }
+
+    auto &hwInfo = rootDevice->getHardwareInfo();
+    const auto &gfxCoreHelper = rootDevice->getGfxCoreHelper();
+
+    auto clRootDevice = std::make_unique<ClDevice>(*rootDevice, nullptr);
+    cl_device_id deviceIds[] = {clRootDevice.get()};
+    ClDeviceVector deviceVector{deviceIds, 1};
+    MockContext context(deviceVector);
+
+    const auto &defaultEngine = clRootDevice->getDefaultEngine();
+    const auto engineGroupType = gfxCoreHelper.getEngineGroupType(defaultEngine.getEngineType(), defaultEngine.getEngineUsage(), hwInfo);
+
+    auto defaultEngineGroupIndex = clRootDevice->getDevice().getEngineGroupIndexFromEngineGroupType(engineGroupType);
+    auto &engines = clRootDevice->getDevice().getRegularEngineGroups()[defaultEngineGroupIndex].engines;
+    if (engines.size() != ccsCount) {
+        GTEST_SKIP();
+    }
+
+    TaskCountType pendingTasks[ccsCount] = {3u, 1u, 1u, 2u};
+    for (uint32_t i = 0; i < ccsCount; i++) {
+        auto csr = static_cast<UltCommandStreamReceiver<FamilyType> *>(engines[i].commandStreamReceiver);
+        csr->taskCount = *csr->getTagAddress() + pendingTasks[i];
+        EXPECT_EQ(pendingTasks[i], csr->getNumPendingTasks());
+    }
+    engines[1].commandStreamReceiver->registerClient();
+
+    auto cmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(&context, clRootDevice.get(), nullptr);
+    EXPECT_EQ(engines[2].commandStreamReceiver, &cmdQ->getGpgpuCommandStreamReceiver());
+
+    engines[1].commandStreamReceiver->unregisterClient();
+}
+
 HWTEST_F(EngineInstancedDeviceTests, givenCmdQRoundRobindEngineAssignNTo1wWenCreateMultipleCommandQueuesThenEnginesAreAssignedUsingRoundRobinAndNQueuesShareSameCsr) {
     constexpr uint32_t genericDevicesCount = 1;
     constexpr uint32_t ccsCount = 4;
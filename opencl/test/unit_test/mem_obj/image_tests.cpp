@@ -8,6 +8,7 @@
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/image_tiling_helper.h"
 #include "shared/source/image/image_surface_state.h"
 #include "shared/source/memory_manager/migration_sync_data.h"
 #include "shared/source/os_interface/os_context.h"
@@ -1510,6 +1511,95 @@ TEST(ImageTest, givenClMemCopyHostPointerPassedToImageCreateWhenAllocationIsNotI
     EXPECT_LT(taskCount, taskCountSent);
 }
 
+namespace {
+class MockMemoryManagerWithTiledImages : public MockMemoryManager {
+  public:
+    using MockMemoryManager::MockMemoryManager;
+
+    GraphicsAllocation *allocateGraphicsMemoryForImage(const AllocationData &allocationData) override {
+        auto allocation = MockMemoryManager::allocateGraphicsMemoryForImage(allocationData);
+        if (allocation) {
+            auto &flags = allocation->getDefaultGmm()->gmmResourceInfo->getResourceFlags()->Info;
+            flags.Linear = 0;
+            flags.TiledY = (tilingMode == ImageTilingMode::TileY);
+            flags.Tile4 = (tilingMode == ImageTilingMode::Tile4);
+        }
+        return allocation;
+    }
+
+    ImageTilingMode tilingMode = ImageTilingMode::TileY;
+};
+
+// expected byte offset inside a 128B x 32 rows tile, written out from the layout descriptions rather than bit arithmetic
+size_t getExpectedOffsetInTile(ImageTilingMode tilingMode, size_t x, size_t y) {
+    if (tilingMode == ImageTilingMode::TileY) {
+        const size_t column = x / 16;
+        return column * 512 + y * 16 + x % 16;
+    }
+    const size_t block = (y / 8) * 2 + (x / 64);
+    const size_t cell = ((y % 8) / 4) * 4 + ((x % 64) / 16);
+    return block * 512 + cell * 64 + (y % 4) * 16 + x % 16;
+}
+} // namespace
+
+TEST(ImageTest, givenCpuImageTilingEnabledWhenTiledImageIsCreatedWithCopyHostPtrThenHostDataIsTiledByCpu) {
+    REQUIRE_IMAGES_OR_SKIP(defaultHwInfo);
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCpuImageTiling.set(1);
+    DebugManager.flags.RenderCompressedImagesEnabled.set(0);
+
+    ExecutionEnvironment *executionEnvironment = platform()->peekExecutionEnvironment();
+    auto *memoryManager = new MockMemoryManagerWithTiledImages(*executionEnvironment);
+    executionEnvironment->memoryManager.reset(memoryManager);
+    auto device = std::make_unique<MockClDevice>(MockDevice::create<MockDevice>(executionEnvironment, 0));
+    MockContext context(device.get());
+
+    // 32 RGBA8 pixels give a 128B row pitch in the mocked Gmm, 64 rows span two rows of tiles
+    constexpr size_t width = 32;
+    constexpr size_t height = 64;
+    constexpr size_t rowPitch = width * 4;
+
+    std::vector<uint8_t> hostData(rowPitch * height);
+    for (size_t i = 0; i < hostData.size(); i++) {
+        hostData[i] = static_cast<uint8_t>(i * 7 + (i >> 7));
+    }
+
+    cl_mem_flags flags = CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR;
+    cl_image_desc imageDesc = {};
+    imageDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    imageDesc.image_width = width;
+    imageDesc.image_height = height;
+
+    cl_image_format imageFormat = {};
+    imageFormat.image_channel_data_type = CL_UNSIGNED_INT8;
+    imageFormat.image_channel_order = CL_RGBA;
+    auto surfaceFormat = Image::getSurfaceFormatFromTable(
+        flags, &imageFormat, context.getDevice(0)->getHardwareInfo().capabilityTable.supportsOcl21Features);
+
+    for (auto tilingMode : {ImageTilingMode::TileY, ImageTilingMode::Tile4}) {
+        memoryManager->tilingMode = tilingMode;
+        auto taskCount = device->getGpgpuCommandStreamReceiver().peekLatestFlushedTaskCount();
+
+        cl_int retVal = CL_SUCCESS;
+        std::unique_ptr<Image> image(Image::create(&context, ClMemoryPropertiesHelper::createMemoryProperties(flags, 0, 0, &context.getDevice(0)->getDevice()),
+                                                   flags, 0, surfaceFormat, &imageDesc, hostData.data(), retVal));
+        ASSERT_NE(nullptr, image);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_EQ(taskCount, device->getGpgpuCommandStreamReceiver().peekLatestFlushedTaskCount());
+
+        auto allocation = image->getGraphicsAllocation(context.getDevice(0)->getRootDeviceIndex());
+        ASSERT_EQ(rowPitch, allocation->getDefaultGmm()->gmmResourceInfo->getRenderPitch());
+        auto tiledData = static_cast<uint8_t *>(allocation->getUnderlyingBuffer());
+
+        for (size_t y = 0; y < height; y++) {
+            for (size_t x = 0; x < rowPitch; x++) {
+                auto tiledOffset = (y / 32) * ImageTilingHelper::tileSize + getExpectedOffsetInTile(tilingMode, x, y % 32);
+                ASSERT_EQ(hostData[y * rowPitch + x], tiledData[tiledOffset]) << "x: " << x << " y: " << y;
+            }
+        }
+    }
+}
+
 struct ImageConvertTypeTest
     : public ::testing::Test {
 
@@ -251,6 +251,7 @@ class MockCommandQueueHw : public CommandQueueHw<GfxFamily> {
     using BaseClass::commandQueueProperties;
     using BaseClass::commandStream;
     using BaseClass::deferredTimestampPackets;
+    using BaseClass::engineInitializationFailed;
     using BaseClass::getDevice;
     using BaseClass::gpgpuEngine;
     using BaseClass::isBlitAuxTranslationRequired;
@@ -263,6 +264,8 @@ class MockCommandQueueHw : public CommandQueueHw<GfxFamily> {
     using BaseClass::relaxedOrderingForGpgpuAllowed;
     using BaseClass::requiresCacheFlushAfterWalker;
     using BaseClass::splitBarrierRequired;
+    using BaseClass::stagingBufferChunkSize;
+    using BaseClass::stagingBuffers;
     using BaseClass::throttle;
     using BaseClass::timestampPacketContainer;
 
@@ -65,6 +65,13 @@ struct EncodeDispatchKernelArgs {
     bool isKernelDispatchedFromImmediateCmdList = false;
     bool isRcs = false;
     bool dcFlushEnable = false;
+
+    // outputs, filled by encode() for callers that patch the dispatch afterwards
+    void *outWalkerPtr = nullptr;
+    void *outInlineDataPtr = nullptr;
+    void *outIndirectDataPtr = nullptr;
+    uint32_t outInlineDataSize = 0u;
+    uint32_t outIndirectDataSize = 0u;
 };
 
 enum class MiPredicateType : uint32_t {
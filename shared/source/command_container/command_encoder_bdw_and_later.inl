@@ -189,6 +189,8 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
 
         memcpy_s(ptr, sizeCrossThreadData,
                  args.dispatchInterface->getCrossThreadData(), sizeCrossThreadData);
+        args.outIndirectDataPtr = ptr;
+        args.outIndirectDataSize = sizeCrossThreadData;
 
         if (args.isIndirect) {
             auto crossThreadDataGpuVA = heapIndirect->getGraphicsAllocation()->getGpuAddress() + heapIndirect->getUsed() - sizeThreadData;
@@ -284,6 +286,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
 
     auto buffer = listCmdBufferStream->getSpace(sizeof(cmd));
     *(decltype(cmd) *)buffer = cmd;
+    args.outWalkerPtr = buffer;
 
     PreemptionHelper::applyPreemptionWaCmdsEnd<Family>(listCmdBufferStream, *args.device);
     {
@@ -226,6 +226,8 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             memcpy_s(ptr, sizeCrossThreadData,
                      crossThreadData, sizeCrossThreadData);
         }
+        args.outIndirectDataPtr = ptr;
+        args.outIndirectDataSize = sizeCrossThreadData;
         if (args.isIndirect) {
             auto gpuPtr = heap->getGraphicsAllocation()->getGpuAddress() + static_cast<uint64_t>(heap->getUsed() - sizeThreadData - inlineDataProgrammingOffset);
             uint64_t implicitArgsGpuPtr = 0u;
@@ -357,6 +359,12 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         args.partitionCount = 1;
         auto buffer = listCmdBufferStream->getSpace(sizeof(walkerCmd));
         *(decltype(walkerCmd) *)buffer = walkerCmd;
+
+        args.outWalkerPtr = buffer;
+        if (inlineDataProgrammingOffset > 0) {
+            args.outInlineDataPtr = reinterpret_cast<decltype(walkerCmd) *>(buffer)->getInlineDataPointer();
+            args.outInlineDataSize = inlineDataProgrammingOffset;
+        }
     }
 
     PreemptionHelper::applyPreemptionWaCmdsEnd<Family>(listCmdBufferStream, *args.device);
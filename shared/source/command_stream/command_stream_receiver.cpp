@@ -47,6 +47,7 @@
 #include "shared/source/utilities/tag_allocator.h"
 #include "shared/source/utilities/wait_util.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace AubMemDump {
@@ -73,6 +74,7 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
         this->dispatchMode = (DispatchMode)DebugManager.flags.CsrDispatchMode.get();
     }
     flushStamp.reset(new FlushStampTracker(true));
+    this->completionWatermarkEnabled = DebugManager.flags.EnableCsrCompletionWatermark.get() == 1;
     for (int i = 0; i < IndirectHeap::Type::NUM_TYPES; ++i) {
         indirectHeap[i] = nullptr;
     }
@@ -276,6 +278,9 @@ bool CommandStreamReceiver::initializeResources() {
             if (!osContext->ensureContextInitialized()) {
                 return false;
             }
+            if (!ensureEngineResourcesCreated()) {
+                return false;
+            }
             this->fillReusableAllocationsList();
             this->resourcesInitialized = true;
         }
@@ -428,6 +433,11 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
     std::chrono::high_resolution_clock::time_point waitStartTime, lastHangCheckTime, currentTime;
     int64_t timeDiff = 0;
 
+    const bool pollingTagAddress = (pollAddress == this->tagAddress);
+    if (pollingTagAddress && isTaskCountCompleted(taskCountToWait)) {
+        return WaitStatus::Ready;
+    }
+
     TaskCountType latestSentTaskCount = this->latestFlushedTaskCount;
     if (latestSentTaskCount < taskCountToWait) {
         if (this->flushTagUpdate() != NEO::SubmissionStatus::SUCCESS) {
@@ -467,9 +477,24 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
         partitionAddress = ptrOffset(partitionAddress, this->immWritePostSyncWriteOffset);
     }
 
+    if (pollingTagAddress) {
+        updateCompletionWatermark(taskCountToWait);
+    }
+
     return WaitStatus::Ready;
 }
 
+void CommandStreamReceiver::updateCompletionWatermark(TaskCountType completedTaskCount) {
+    if (!completionWatermarkEnabled) {
+        return;
+    }
+
+    auto currentWatermark = completionWatermark.load();
+    while (currentWatermark < completedTaskCount &&
+           !completionWatermark.compare_exchange_weak(currentWatermark, completedTaskCount)) {
+    }
+}
+
 void CommandStreamReceiver::setTagAllocation(GraphicsAllocation *allocation) {
     this->tagAllocation = allocation;
     UNRECOVERABLE_IF(allocation == nullptr);
@@ -798,6 +823,32 @@ bool CommandStreamReceiver::createWorkPartitionAllocation(const Device &device)
     return true;
 }
 
+bool CommandStreamReceiver::createEngineResources() {
+    if (!createGlobalFenceAllocation()) {
+        return false;
+    }
+
+    createKernelArgsBufferAllocation();
+
+    if (osContext->getPreemptionMode() == PreemptionMode::MidThread && !createPreemptionAllocation()) {
+        return false;
+    }
+    return true;
+}
+
+bool CommandStreamReceiver::ensureEngineResourcesCreated() {
+    if (engineResourcesCreationDeferred) {
+        auto lock = obtainUniqueOwnership();
+        if (engineResourcesCreationDeferred) {
+            if (!createEngineResources()) {
+                return false;
+            }
+            engineResourcesCreationDeferred = false;
+        }
+    }
+    return true;
+}
+
 bool CommandStreamReceiver::createGlobalFenceAllocation() {
     auto &gfxCoreHelper = getGfxCoreHelper();
     auto &hwInfo = peekHwInfo();
@@ -950,7 +1001,32 @@ void CommandStreamReceiver::downloadTagAllocation(TaskCountType taskCountToWait)
     }
 }
 
+TaskCountType CommandStreamReceiver::getNumPendingTasks() {
+    if (tagAddress == nullptr) {
+        return 0;
+    }
+
+    // with tag updated from wait the tag is written only up to the latest flushed task count, tasks submitted
+    // after it are not counted since their completion can't be observed until someone waits for them
+    auto currentTaskCount = isUpdateTagFromWaitEnabled() ? peekLatestFlushedTaskCount() : peekTaskCount();
+
+    // the slowest partition determines how much work is still in flight
+    TaskCountType completedTaskCount = currentTaskCount;
+    auto partitionAddress = tagAddress;
+    for (uint32_t i = 0; i < activePartitions; i++) {
+        completedTaskCount = std::min(completedTaskCount, static_cast<TaskCountType>(*partitionAddress));
+        partitionAddress = ptrOffset(partitionAddress, this->immWritePostSyncWriteOffset);
+    }
+    completedTaskCount = std::clamp(peekCompletionWatermark(), completedTaskCount, currentTaskCount);
+    return currentTaskCount - completedTaskCount;
+}
+
 bool CommandStreamReceiver::testTaskCountReady(volatile TagAddressType *pollAddress, TaskCountType taskCountToWait) {
+    const bool pollingTagAddress = (pollAddress == this->tagAddress);
+    if (pollingTagAddress && isTaskCountCompleted(taskCountToWait)) {
+        return true;
+    }
+
     this->downloadTagAllocation(taskCountToWait);
     for (uint32_t i = 0; i < activePartitions; i++) {
         if (!WaitUtils::waitFunction(pollAddress, taskCountToWait)) {
@@ -959,6 +1035,10 @@ bool CommandStreamReceiver::testTaskCountReady(volatile TagAddressType *pollAddr
 
         pollAddress = ptrOffset(pollAddress, this->immWritePostSyncWriteOffset);
     }
+
+    if (pollingTagAddress) {
+        updateCompletionWatermark(taskCountToWait);
+    }
     return true;
 }
 
@@ -189,6 +189,12 @@ class CommandStreamReceiver {
     virtual WaitStatus waitForCompletionWithTimeout(const WaitParams &params, TaskCountType taskCountToWait);
     WaitStatus baseWaitFunction(volatile TagAddressType *pollAddress, const WaitParams &params, TaskCountType taskCountToWait);
     MOCKABLE_VIRTUAL bool testTaskCountReady(volatile TagAddressType *pollAddress, TaskCountType taskCountToWait);
+    bool isTaskCountCompleted(TaskCountType taskCountToWait) const {
+        return completionWatermarkEnabled && taskCountToWait <= completionWatermark.load();
+    }
+    void updateCompletionWatermark(TaskCountType completedTaskCount);
+    TaskCountType peekCompletionWatermark() const { return completionWatermark.load(); }
+    TaskCountType getNumPendingTasks();
     virtual void downloadAllocations(){};
 
     void setSamplerCacheFlushRequired(SamplerCacheFlushState value) { this->samplerCacheFlushRequired = value; }
@@ -215,7 +221,12 @@ class CommandStreamReceiver {
     MOCKABLE_VIRTUAL bool createPreemptionAllocation();
     MOCKABLE_VIRTUAL bool createPerDssBackedBuffer(Device &device);
     virtual void createKernelArgsBufferAllocation() = 0;
+    MOCKABLE_VIRTUAL bool createEngineResources();
+    bool ensureEngineResourcesCreated();
+    void deferEngineResourcesCreation() { engineResourcesCreationDeferred = true; }
+    bool isEngineResourcesCreationDeferred() const { return engineResourcesCreationDeferred; }
     [[nodiscard]] MOCKABLE_VIRTUAL std::unique_lock<MutexType> obtainUniqueOwnership();
+    [[nodiscard]] std::unique_lock<MutexType> tryObtainUniqueOwnership() { return std::unique_lock<MutexType>(ownershipMutex, std::try_to_lock); }
 
     bool peekTimestampPacketWriteEnabled() const { return timestampPacketWriteEnabled; }
 
@@ -490,6 +501,8 @@ class CommandStreamReceiver {
     // current taskLevel.  Used for determining if a PIPE_CONTROL is needed.
     std::atomic<TaskCountType> taskLevel{0};
     std::atomic<TaskCountType> latestSentTaskCount{0};
+    // highest task count any thread has observed as completed on this CSR
+    std::atomic<TaskCountType> completionWatermark{0};
     std::atomic<TaskCountType> latestFlushedTaskCount{0};
     // taskCount - # of tasks submitted
     std::atomic<TaskCountType> taskCount{0};
@@ -536,6 +549,7 @@ class CommandStreamReceiver {
     bool timestampPacketWriteEnabled = false;
     bool staticWorkPartitioningEnabled = false;
     bool nTo1SubmissionModelEnabled = false;
+    bool completionWatermarkEnabled = false;
     bool lastSystolicPipelineSelectMode = false;
     bool requiresInstructionCacheFlush = false;
 
@@ -550,6 +564,7 @@ class CommandStreamReceiver {
     bool dcFlushSupport = false;
     bool forceSkipResourceCleanupRequired = false;
     volatile bool resourcesInitialized = false;
+    volatile bool engineResourcesCreationDeferred = false;
     bool doubleSbaWa = false;
     bool dshSupported = false;
 };
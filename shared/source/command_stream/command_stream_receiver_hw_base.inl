@@ -1474,6 +1474,10 @@ inline void CommandStreamReceiverHw<GfxFamily>::stopDirectSubmission() {
 
 template <typename GfxFamily>
 inline bool CommandStreamReceiverHw<GfxFamily>::initDirectSubmission() {
+    if (!this->ensureEngineResourcesCreated()) {
+        return false;
+    }
+
     bool ret = true;
 
     bool submitOnInit = false;
@@ -85,6 +85,7 @@ DECLARE_DEBUG_VARIABLE(bool, WaitForMemoryRelease, false, "Wait for memory relea
 DECLARE_DEBUG_VARIABLE(std::string, ForceDeviceId, std::string("unk"), "Override device id in AUB/TBX mode")
 DECLARE_DEBUG_VARIABLE(std::string, FilterDeviceId, std::string("unk"), "Device id filter, adapter matching device id will be opened; ignored when unk")
 DECLARE_DEBUG_VARIABLE(std::string, FilterBdfPath, std::string("unk"), "Linux-only, BDF path filter, only matching paths will be opened; ignored when unk")
+DECLARE_DEBUG_VARIABLE(std::string, DeviceQueryCacheDir, std::string("unk"), "Linux-only, directory in which results of topology and hwconfig table queries are cached between processes, keyed also by GuC firmware identity; ignored when unk")
 DECLARE_DEBUG_VARIABLE(std::string, LoadBinarySipFromFile, std::string("unk"), "Select binary file to load SIP kernel raw binary; when file named *_header.* exists, it is used as header")
 DECLARE_DEBUG_VARIABLE(std::string, InjectInternalBuildOptions, std::string("unk"), "Append provided string to internal build options for user modules; ignored when unk")
 DECLARE_DEBUG_VARIABLE(std::string, InjectApiBuildOptions, std::string("unk"), "Append provided string to api build options for user modules; ignored when unk")
@@ -103,6 +104,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideGpuAddressSpace, -1, "Set GPU address sp
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideMaxWorkgroupSize, -1, "Set max workgroup size; ignore when -1")
 DECLARE_DEBUG_VARIABLE(int32_t, DoCpuCopyOnReadBuffer, -1, "Override CPU copy behavior for buffer reads; values = -1: default, 0: do not use CPU copy, 1: triggers CPU copy path for Read Buffer calls, only supported for some basic use cases (no blocked user events in dependencies tree)")
 DECLARE_DEBUG_VARIABLE(int32_t, DoCpuCopyOnWriteBuffer, -1, "Override CPU copy behavior for buffer writes; values = -1: default, 0: do not use CPU copy, 1: triggers CPU copy path for Write Buffer calls, only supported for some basic use cases (no blocked user events in dependencies tree)")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableStagingBufferForPageableWrites, -1, "-1: default, 0: disabled, 1: enabled. Blocking buffer writes from non-USM host memory go through a ring of host USM staging chunks, CPU copy of next chunk overlaps GPU copy of previous one")
+DECLARE_DEBUG_VARIABLE(int32_t, StagingBufferChunkSizeInKb, -1, "-1: default (2048), >0: size in KB of single staging chunk used for writes from non-USM host memory")
+DECLARE_DEBUG_VARIABLE(int32_t, StagingBufferRingDepth, -1, "-1: default (4), >1: number of staging chunks in flight for writes from non-USM host memory")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnEnqueue, -1, "-1: default, -2: always, x: pause on enqueue number x and ask for user confirmation before and after execution, counted from 0")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnBlitCopy, -1, "-1: default, -2: always, x: pause on blit enqueue number x and ask for user confirmation before and after execution, counted from 0. Note that single blit enqueue may have multiple copy instructions")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnGpuMode, -1, "-1: default (before and after), 0: before only, 1: after only")
@@ -236,9 +240,11 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableMultipleRegularContextForBcs, -1, "-1: def
 DECLARE_DEBUG_VARIABLE(int32_t, AppendAubStreamContextFlags, -1, "-1: default, >0: Append flags passed during HardwareContext creation.")
 DECLARE_DEBUG_VARIABLE(int32_t, DisableScratchPages, -1, "-1: default, 0: do not disable scratch pages during VM creations, 1: disable scratch pages during VM creations")
 DECLARE_DEBUG_VARIABLE(int32_t, OptimizeIoqBarriersHandling, -1, "-1: default, 0: disable, 1: enable. If enabled, dont dispatch stalling commands for IOQ. Instead, inherit TimestampPackets from previous enqueue.")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCsrCompletionWatermark, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, each CSR caches the highest completed task count observed by any thread and answers completion queries from it before reading the tag memory")
 DECLARE_DEBUG_VARIABLE(int32_t, ExitOnSubmissionNumber, -1, "Call exit(0) on X submission. >=0: submission count (start from 0)")
 DECLARE_DEBUG_VARIABLE(int32_t, ExitOnSubmissionMode, 0, "Exit on X submission mode. 0: Any context type, 1: Compute context only, 2: Copy context only ")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceInOrderImmediateCmdListExecution, -1, "-1: default, 0: disabled, 1: all Immediate Command Lists are switched to in-order execution")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableInOrderCounterBasedEvents, -1, "-1: default (disabled), 0: disabled, 1: events from pools created with ZEX_EVENT_POOL_FLAG_COUNTER_BASED signaled from in-order Immediate Command Lists are tracked as (counter allocation, value) pairs instead of event packets")
 DECLARE_DEBUG_VARIABLE(int64_t, OverrideEventSynchronizeTimeout, -1, "-1: default - user provided timeout value,  >0: timeout in nanoseconds")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceTlbFlush, -1, "-1: default,  0: Tlb flush disabled, 1: Tlb Flush enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DebugSetMemoryDiagnosticsDelay, -1, "-1: default, >=0: delay time in minutes necessary for completion of Memory diagnostics")
@@ -270,6 +276,7 @@ DECLARE_DEBUG_VARIABLE(bool, ResidencyDebugEnable, false, "enables debug message
 DECLARE_DEBUG_VARIABLE(bool, EventsDebugEnable, false, "enables debug messages for events, virtual events, blocked enqueues, events trees etc.")
 DECLARE_DEBUG_VARIABLE(bool, EventsTrackerEnable, false, "enables event graphs dumping")
 DECLARE_DEBUG_VARIABLE(bool, PrintLWSSizes, false, "prints driver chosen local workgroup sizes")
+DECLARE_DEBUG_VARIABLE(bool, PrintCommandListBarrierStatistics, false, "prints number of appended and programmed barriers when a regular command list is closed")
 DECLARE_DEBUG_VARIABLE(bool, PrintDispatchParameters, false, "prints dispatch parameters of kernels passed to clEnqueueNDRangeKernel")
 DECLARE_DEBUG_VARIABLE(bool, PrintProgramBinaryProcessingTime, false, "prints execution time of Program::processGenBinary() method during program building")
 DECLARE_DEBUG_VARIABLE(bool, PrintRelocations, false, "prints relocations debug information")
@@ -277,7 +284,11 @@ DECLARE_DEBUG_VARIABLE(bool, PrintTimestampPacketContents, false, "prints all ti
 DECLARE_DEBUG_VARIABLE(bool, PrintGlobalTimestampInNs, false, "prints host and device timestamp in nanoseconds")
 DECLARE_DEBUG_VARIABLE(bool, WddmResidencyLogger, false, "gather Wddm residency statistics to file")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOCreateDestroyResult, false, "tracks the result of creation and destruction of BOs")
+DECLARE_DEBUG_VARIABLE(bool, PrintUserptrBoCacheStatistics, false, "Print userptr BO cache hits, misses, evictions and invalidations at memory manager cleanup")
+DECLARE_DEBUG_VARIABLE(bool, PrintNumaPlacementStatistics, false, "Print number of host allocations bound to device NUMA node, to requested NUMA node and failed bindings at memory manager cleanup")
+DECLARE_DEBUG_VARIABLE(bool, PrintMemoryPressureReclaimStatistics, false, "Print bytes reclaimed and invocations of each memory pressure shrinker at memory manager destruction")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOBindingResult, false, "tracks the result of binding and unbinding of BOs")
+DECLARE_DEBUG_VARIABLE(bool, PrintVmBindBatchingStatistics, false, "prints number of BOs, bind operations and ioctls of each batched VM_BIND/VM_UNBIND submission")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOPrefetchingResult, false, "tracks the result of prefetching BOs")
 DECLARE_DEBUG_VARIABLE(bool, PrintTagAllocationAddress, false, "Print tag allocation address for each engine")
 DECLARE_DEBUG_VARIABLE(bool, ProvideVerboseImplicitFlush, false, "provides verbose messages about implicit flush mechanism")
@@ -320,6 +331,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, ResolveDependenciesViaPipeControls, -1, "-1: def
 DECLARE_DEBUG_VARIABLE(int32_t, MakeIndirectAllocationsResidentAsPack, -1, "-1: default, 0:disabled, 1: enabled. If enabled, driver handles all indirect allocations as one pack instead of making them resident individually.")
 DECLARE_DEBUG_VARIABLE(int32_t, DetectIndirectAccessInKernel, -1, "-1: default, 0:disabled, 1: enabled. If enabled and indirect accesses are not detected in kernel, indirect allocations will not be allowed even if set by API.")
 DECLARE_DEBUG_VARIABLE(int32_t, MakeEachAllocationResident, -1, "-1: default, 0: disabled, 1: bind every allocation at creation time, 2: bind all created allocations in flush")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableVmBindBatching, -1, "-1: default (disabled), 0: disabled, 1: enabled - BOs made resident or evicted together are bound or unbound in one batch, requires array VM_BIND support in the kernel driver")
 DECLARE_DEBUG_VARIABLE(int32_t, AssignBCSAtEnqueue, -1, "-1: default, 0:disabled, 1: enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferCmdQGpgpuInitialization, -1, "-1: default, 0:disabled, 1: enabled.")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferCmdQBcsInitialization, -1, "-1: default, 0:disabled, 1: enabled.")
@@ -366,7 +378,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRelaxedOrdering, -1, "-1: defaul
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRelaxedOrderingForBcs, -1, "-1: default, 0 - disable, 1 - enable. If set, enable RelaxedOrdering feature for BCS engine")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRelaxedOrderingQueueSizeLimit, -1, "-1: default, >0: Max gpu queue size. If limit is reached, scheduler wont consume new work")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRelaxedOrderingMinNumberOfClients, -1, "-1: default, >0: Enables RelaxedOrdering mode only if specified number of clients is assigned to given CSR.")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRelaxedOrderingAdaptiveQueueSize, -1, "-1: default, 0 - disable, 1 - enable. If set, scheduler queue size follows number of tasks scheduled since last queue stall and shrinks back after stall")
 DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintBuffers, false, "Print address of submitted command buffers")
+DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintRelaxedOrderingStatistics, false, "Print RelaxedOrdering scheduler statistics when direct submission is destroyed")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, USMEvictAfterMigration, false, "Evict USM allocation after implicit migration to GPU")
@@ -399,6 +413,19 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelAdvancedVme, -1, "-1: default, 0: dis
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterOperationsSupport, -1, "-1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterForEnqueueOperations, -1, "Use Blitter engine for enqueue operations. -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterForEnqueueImageOperations, -1, "Use Blitter engine for read/write/copy image operations. -1: default, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCpuImageTiling, -1, "-1: default, 0: disabled, 1: enabled. Tile/detile TileY and Tile4 images on CPU when their memory can be locked, instead of dispatching GPU copy")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuImageTilingMaxThreads, -1, "-1: default (4), >0: Max number of CPU threads used for single image tiling/detiling copy")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUserptrBoCache, -1, "-1: default, 0: disabled, 1: enabled. Keep userptr BOs of released host pointer fragments for reuse by later allocations of the same ranges")
+DECLARE_DEBUG_VARIABLE(int32_t, UserptrBoCacheMaxEntries, -1, "-1: default (256), >=0: Max number of userptr BOs kept in cache, least recently released are destroyed first")
+DECLARE_DEBUG_VARIABLE(int32_t, EnablePersistentLockMappings, -1, "-1: default, 0: disabled, 1: enabled. Keep CPU mappings of local memory BOs after unlock and reuse them on next lock")
+DECLARE_DEBUG_VARIABLE(int32_t, PersistentLockMappingsBudgetInMb, -1, "-1: default (256), >=0: Max size in MB of unlocked CPU mappings kept alive, least recently unlocked are unmapped first")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelBoCreationThresholdInMb, -1, "-1: default (disabled), >=0: buffer objects of multi-handle local memory allocations not smaller than given size are created in parallel on the memory manager worker pool, the allocation call returns once all of them are created")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostMemoryNumaPlacement, -1, "-1: default, 0: disabled, 1: enabled. Back host USM, command and staging buffers with dedicated userptr mappings bound to the NUMA node of the device PCI root, such allocations are not created from mmaped buffer objects")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostTransparentHugePages, -1, "-1: default, 0: disabled, 1: enabled. Advise transparent huge pages for userptr host allocations not smaller than 2MB, host USM backed by mmaped BO on discrete devices is not affected")
+DECLARE_DEBUG_VARIABLE(int32_t, HostHugeTlbPageSizeInMb, -1, "-1: default (disabled), >0: back userptr host allocations not smaller than given hugetlbfs page size (2 or 1024) with huge pages, regular pages are used when the pool is exhausted, host USM backed by mmaped BO on discrete devices is not affected")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableMemoryPressureReclaim, -1, "-1: default, 0: disabled, 1: enabled. When allocation fails, release idle driver caches in priority order and retry the allocation")
+DECLARE_DEBUG_VARIABLE(int32_t, LocalMemoryPressureWatermarkPercent, -1, "-1: default (disabled), 1-100: release idle driver caches when local memory usage of a root device exceeds given percent of its capacity")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelRootDeviceInitialization, -1, "-1: default (disabled), >1: maximal number of threads querying and initializing OS interfaces of root devices concurrently")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalker, -1, "-1: platform behavior, 0: disabled, 1: enabled. Adds dedicated cache flush command after WALKER command when surfaces used by kernel require to flush the cache")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalMemory, -1, "-1: default behavior, 0: disabled, 1: enabled, Allows allocating graphics memory in Local Memory")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableStatelessToStatefulBufferOffsetOpt, -1, "-1: don't override, 0: disable, 1: enable, Enables buffer-offset improvement of the stateless to stateful optimization")
@@ -439,6 +466,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideNotifyEnableForTagUpdatePostSync, -1, "-
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCmdQRoundRobindEngineAssign, -1, "-1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, CmdQRoundRobindEngineAssignBitfield, -1, "-1: default, >0: bitfield with supported engines")
 DECLARE_DEBUG_VARIABLE(int32_t, CmdQRoundRobindEngineAssignNTo1, -1, "-1: default, >0: assign same engine to N queues")
+DECLARE_DEBUG_VARIABLE(int32_t, CmdQEngineAssignPolicy, -1, "-1: default (round robin), 0: round robin, 1: least loaded engine (fewest pending tasks, then fewest clients) for queues whose engine is chosen by the driver, with UpdateTaskCountFromWait only tasks up to the latest tag update are counted as pending, 2: as 1 and also for Level Zero compute queue groups, ignoring the requested queue index")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCopyEngineSelector, -1, "Do not choose only main copy engine, -1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCmdQRoundRobindBcsEngineAssign, -1, "-1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCmdQRoundRobindBcsEngineAssignLimit, -1, "-1: default, >=0: round robin limit")
@@ -481,6 +509,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalD2HCpuCopyThreshold, -1, "Override d
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally copy memory through locked ptr. -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalForceCopyThroughLock, -1, "Force copy through lock pointer on zeAppendMemoryCopy for all cases -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Experimentally enable pool allocator for clCreateBuffer under 4KB.")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableEventPoolSlabAllocator, -1, "Carve small L0 event pools from per-context slabs (at most 16 MB per context) instead of dedicated allocations. -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCommandListBarrierElision, -1, "Skip barriers appended to a regular command list when no command was programmed since the previous barrier. -1: default (disabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLockWaitlistSizeThreshold, -1, "If less than given value, driver will wait for Waitlist on host, instead of sending appendBarrier. If 0, always use barrier.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableSourceLevelDebugger, false, "Experimentally enable source level debugger.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableL0DebuggerForOpenCL, false, "Experimentally enable debugging OCL with L0 Debug API. When enabled - Level Zero debugging is disabled.")
@@ -499,6 +529,8 @@ DECLARE_DEBUG_VARIABLE(bool, ForceDefaultThreadArbitrationPolicyIfNotSpecified,
 DECLARE_DEBUG_VARIABLE(bool, ForceAllResourcesUncached, false, "When set, all memory operations for all resources are forced to UC. This overrides all caching-related debug variables and globally disables all caches")
 DECLARE_DEBUG_VARIABLE(bool, EnableCpuCacheForResources, true, "When true, driver will set gmm flag cacheable related to caching on cpu, for resources where it is allowed")
 DECLARE_DEBUG_VARIABLE(bool, EnableDebuggerMmapMemoryAccess, false, "Mmap used to access memory by debug api, valid only on Linux OS")
+DECLARE_DEBUG_VARIABLE(bool, EnableDebuggerGpuMemoryCache, false, "Keep VM fds open and cache pages read by debug api until resume, attention, write or unbind, valid only on Linux OS")
+DECLARE_DEBUG_VARIABLE(bool, EnableDebuggerStateSaveAreaSnapshot, false, "Keep state save area read on attention and serve register reads of stopped threads from it until resume")
 DECLARE_DEBUG_VARIABLE(bool, ForceDefaultGrfCompilationMode, false, "Adds build option -cl-intel-128-GRF-per-thread to force kernel compilation in Default-GRF mode")
 DECLARE_DEBUG_VARIABLE(bool, ForceLargeGrfCompilationMode, false, "Adds build option -cl-intel-256-GRF-per-thread to force kernel compilation in Large-GRF mode")
 DECLARE_DEBUG_VARIABLE(bool, EnableConcurrentSharedCrossP2PDeviceAccess, false, "Enables the concurrent use between host and peer devices of shared-allocations ")
@@ -539,6 +571,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, UpdateTaskCountFromWait, -1, " Do not update tas
 DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampWaitForQueues, -1, "Wait on queues using timestamps, -1: default(disabled), 0: disabled, 1: enabled where UpdateTaskCountFromWait enabled, 2: enabled on gpgpu engine with direct submission, 3: enabled on any direct submission, 4: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampWaitForEvents, -1, "Wait on events using timestamps, -1: default(disabled), 0: disabled, 1: enabled where UpdateTaskCountFromWait enabled, 2: enabled on gpgpu engine with direct submission, 3: enabled on any direct submission, 4: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DeferOsContextInitialization, -1, "-1: default, 0: create all contexts immediately, 1: defer, if possible")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferEngineResourcesCreation, -1, "-1: default (disabled), 0: disabled, 1: create global fence, kernel args buffer and preemption allocations of engines with deferred OS context initialization on first use")
 DECLARE_DEBUG_VARIABLE(int32_t, UsmInitialPlacement, -1, "-1: default, 0: optimize for first CPU access, 1: optimize for first GPU access")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceHostPointerImport, -1, "-1: default, 0: disable, 1: enable, Forces the driver to import every host pointer coming into driver, WARNING this is not spec compliant.")
 DECLARE_DEBUG_VARIABLE(int32_t, ProgramExtendedPipeControlPriorToNonPipelinedStateCommand, -1, "-1: default, 0: disable, 1: enable, Program additional extended version of PIPE CONTROL command before non pipelined state command")
@@ -381,13 +381,10 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
         return false;
     }
 
-    if (!commandStreamReceiver->createGlobalFenceAllocation()) {
-        return false;
-    }
-
-    commandStreamReceiver->createKernelArgsBufferAllocation();
-
-    if (preemptionMode == PreemptionMode::MidThread && !commandStreamReceiver->createPreemptionAllocation()) {
+    // engines without an initialized OS context get the rest of their resources when first targeted
+    if (DebugManager.flags.DeferEngineResourcesCreation.get() == 1 && !osContext->isImmediateContextInitializationEnabled(isDefaultEngine)) {
+        commandStreamReceiver->deferEngineResourcesCreation();
+    } else if (!commandStreamReceiver->createEngineResources()) {
         return false;
     }
 
@@ -651,6 +648,10 @@ EngineControl &Device::getNextEngineForCommandQueue() {
     const auto defaultEngineGroupIndex = this->getEngineGroupIndexFromEngineGroupType(engineGroupType);
     auto &engineGroup = this->getRegularEngineGroups()[defaultEngineGroupIndex];
 
+    if (DebugManager.flags.CmdQEngineAssignPolicy.get() >= 1) {
+        return this->getLeastLoadedEngine(engineGroup.engines);
+    }
+
     auto engineIndex = 0u;
     do {
         engineIndex = (this->regularCommandQueuesCreatedWithinDeviceCount++ / this->queuesPerEngineCount) % engineGroup.engines.size();
@@ -658,6 +659,41 @@ EngineControl &Device::getNextEngineForCommandQueue() {
     return engineGroup.engines[engineIndex];
 }
 
+EngineControl &Device::getLeastLoadedEngine(EnginesT &engines) {
+    this->initializeEngineRoundRobinControls();
+
+    // start from the round robin position, so that idle engines are still assigned in turns
+    auto numEngines = engines.size();
+    auto startIndex = this->regularCommandQueuesCreatedWithinDeviceCount++ % numEngines;
+
+    EngineControl *selectedEngine = nullptr;
+    TaskCountType selectedPendingTasks = 0;
+    uint32_t selectedNumClients = 0;
+    for (size_t i = 0; i < numEngines; i++) {
+        auto engineIndex = (startIndex + i) % numEngines;
+        if (engineIndex < this->availableEnginesForCommandQueueusRoundRobin.size() &&
+            !this->availableEnginesForCommandQueueusRoundRobin.test(engineIndex)) {
+            continue;
+        }
+
+        auto csr = engines[engineIndex].commandStreamReceiver;
+        auto pendingTasks = csr->getNumPendingTasks();
+        auto numClients = csr->getNumClients();
+        if (selectedEngine == nullptr ||
+            pendingTasks < selectedPendingTasks ||
+            (pendingTasks == selectedPendingTasks && numClients < selectedNumClients)) {
+            selectedEngine = &engines[engineIndex];
+            selectedPendingTasks = pendingTasks;
+            selectedNumClients = numClients;
+        }
+    }
+
+    if (selectedEngine == nullptr) {
+        selectedEngine = &engines[startIndex];
+    }
+    return *selectedEngine;
+}
+
 EngineControl *Device::getInternalCopyEngine() {
     if (!getHardwareInfo().capabilityTable.blitterOperationsSupported) {
         return nullptr;
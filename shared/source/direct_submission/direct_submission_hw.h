@@ -60,6 +60,13 @@ struct HardwareInfo;
 class OsContext;
 class MemoryOperationsHandler;
 
+struct RelaxedOrderingStatistics {
+    uint64_t scheduledTasks = 0;   // tasks handed over to the GPU scheduler, each may be reordered
+    uint64_t queueStalls = 0;      // scheduler drains forced by stalling commands
+    uint64_t queueSizeUpdates = 0; // queue size limit reprogramming
+    uint32_t peakQueueSize = 0;
+};
+
 struct DirectSubmissionInputParams : NonCopyableClass {
     DirectSubmissionInputParams(const CommandStreamReceiver &commandStreamReceiver);
     OsContext &osContext;
@@ -96,6 +103,10 @@ class DirectSubmissionHw {
         return relaxedOrderingEnabled;
     }
 
+    const RelaxedOrderingStatistics &getRelaxedOrderingStatistics() const {
+        return relaxedOrderingStatistics;
+    }
+
   protected:
     static constexpr size_t prefetchSize = 8 * MemoryConstants::cacheLineSize;
     static constexpr size_t prefetchNoops = prefetchSize / sizeof(uint32_t);
@@ -189,6 +200,7 @@ class DirectSubmissionHw {
 
     LinearStream ringCommandStream;
     std::unique_ptr<DirectSubmissionDiagnosticsCollector> diagnostic;
+    RelaxedOrderingStatistics relaxedOrderingStatistics;
 
     uint64_t semaphoreGpuVa = 0u;
     uint64_t gpuVaForMiFlush = 0u;
@@ -219,6 +231,7 @@ class DirectSubmissionHw {
     uint32_t activeTiles = 1u;
     uint32_t immWritePostSyncOffset = 0u;
     uint32_t currentRelaxedOrderingQueueSize = 0;
+    uint32_t relaxedOrderingTasksSinceQueueStall = 0;
     DirectSubmissionSfenceMode sfenceMode = DirectSubmissionSfenceMode::BeforeAndAfterSemaphore;
     volatile uint32_t reserved = 0u;
     uint32_t dispatchErrorCode = 0;
@@ -238,5 +251,6 @@ class DirectSubmissionHw {
     bool relaxedOrderingEnabled = false;
     bool relaxedOrderingInitialized = false;
     bool relaxedOrderingSchedulerRequired = false;
+    bool relaxedOrderingAdaptiveQueueSize = false;
 };
 } // namespace NEO
@@ -97,6 +97,7 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(const DirectSubmis
     if (EngineHelpers::isBcs(this->osContext.getEngineType()) && relaxedOrderingEnabled) {
         relaxedOrderingEnabled = (DebugManager.flags.DirectSubmissionRelaxedOrderingForBcs.get() != 0);
     }
+    relaxedOrderingAdaptiveQueueSize = RelaxedOrderingHelper::isAdaptiveQueueSizeEnabled();
 }
 
 template <typename GfxFamily, typename Dispatcher>
@@ -301,7 +302,12 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchRelaxedOrderingScheduler
 }
 
 template <typename GfxFamily, typename Dispatcher>
-DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() = default;
+DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() {
+    PRINT_DEBUG_STRING(DebugManager.flags.DirectSubmissionPrintRelaxedOrderingStatistics.get() && this->relaxedOrderingEnabled, stdout,
+                       "RelaxedOrdering statistics - scheduled tasks: %" PRIu64 ", queue stalls: %" PRIu64 ", queue size updates: %" PRIu64 ", peak queue size: %u\n",
+                       relaxedOrderingStatistics.scheduledTasks, relaxedOrderingStatistics.queueStalls, relaxedOrderingStatistics.queueSizeUpdates,
+                       relaxedOrderingStatistics.peakQueueSize);
+}
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
@@ -681,6 +687,8 @@ inline size_t DirectSubmissionHw<GfxFamily, Dispatcher>::getSizeDispatch(bool re
 template <typename GfxFamily, typename Dispatcher>
 void DirectSubmissionHw<GfxFamily, Dispatcher>::updateRelaxedOrderingQueueSize(uint32_t newSize) {
     this->currentRelaxedOrderingQueueSize = newSize;
+    relaxedOrderingStatistics.queueSizeUpdates++;
+    relaxedOrderingStatistics.peakQueueSize = std::max(relaxedOrderingStatistics.peakQueueSize, newSize);
 
     EncodeStoreMemory<GfxFamily>::programStoreDataImm(this->ringCommandStream, this->relaxedOrderingQueueSizeLimitValueVa,
                                                       this->currentRelaxedOrderingQueueSize, 0, false, false);
@@ -745,10 +753,16 @@ void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBu
     if (this->relaxedOrderingEnabled && batchBuffer.hasRelaxedOrderingDependencies) {
         dispatchTaskStoreSection(batchBuffer.taskStartAddress);
 
-        uint32_t expectedQueueSize = batchBuffer.numCsrClients * RelaxedOrderingHelper::queueSizeMultiplier;
-        expectedQueueSize = std::min(expectedQueueSize, RelaxedOrderingHelper::maxQueueSize);
+        relaxedOrderingStatistics.scheduledTasks++;
+        relaxedOrderingTasksSinceQueueStall++;
+
+        uint32_t expectedQueueSize = RelaxedOrderingHelper::getExpectedQueueSize(batchBuffer.numCsrClients, relaxedOrderingTasksSinceQueueStall, this->relaxedOrderingAdaptiveQueueSize);
+
+        // adaptive mode may also shrink the queue back, scheduler is drained after each stall so lowering the limit is safe
+        bool queueSizeChangeRequired = this->relaxedOrderingAdaptiveQueueSize ? (expectedQueueSize != this->currentRelaxedOrderingQueueSize)
+                                                                              : (expectedQueueSize > this->currentRelaxedOrderingQueueSize);
 
-        if (expectedQueueSize > this->currentRelaxedOrderingQueueSize && DebugManager.flags.DirectSubmissionRelaxedOrderingQueueSizeLimit.get() == -1) {
+        if (queueSizeChangeRequired && DebugManager.flags.DirectSubmissionRelaxedOrderingQueueSizeLimit.get() == -1) {
             updateRelaxedOrderingQueueSize(expectedQueueSize);
         }
     }
@@ -781,6 +795,8 @@ void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchRelaxedOrderingQueueStal
                                                                                       CS_GPR_R1, 0, CompareOperation::Equal, false);
 
     relaxedOrderingSchedulerRequired = false;
+    relaxedOrderingTasksSinceQueueStall = 0;
+    relaxedOrderingStatistics.queueStalls++;
 }
 
 template <typename GfxFamily, typename Dispatcher>
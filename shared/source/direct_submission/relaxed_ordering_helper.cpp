@@ -26,5 +26,9 @@ bool isRelaxedOrderingDispatchAllowed(const CommandStreamReceiver &csr, uint32_t
     return (csr.directSubmissionRelaxedOrderingEnabled() && csr.getNumClients() >= minimalNumberOfClients);
 }
 
+bool isAdaptiveQueueSizeEnabled() {
+    return (DebugManager.flags.DirectSubmissionRelaxedOrderingAdaptiveQueueSize.get() == 1);
+}
+
 } // namespace RelaxedOrderingHelper
 } // namespace NEO
\ No newline at end of file
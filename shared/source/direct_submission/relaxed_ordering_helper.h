@@ -10,15 +10,27 @@
 #include "shared/source/command_container/command_encoder.h"
 #include "shared/source/command_container/encode_alu_helper.h"
 
+#include <algorithm>
+
 namespace NEO {
 class CommandStreamReceiver;
 
 namespace RelaxedOrderingHelper {
 bool isRelaxedOrderingDispatchAllowed(const CommandStreamReceiver &csr, uint32_t numWaitEvents);
+bool isAdaptiveQueueSizeEnabled();
 
 static constexpr uint32_t queueSizeMultiplier = 4;
 static constexpr uint32_t maxQueueSize = 16;
 
+inline uint32_t getExpectedQueueSize(uint32_t numCsrClients, uint32_t tasksSinceQueueStall, bool adaptive) {
+    uint32_t expectedQueueSize = numCsrClients * queueSizeMultiplier;
+    if (adaptive) {
+        // keep room for every task scheduled since the last drain, so independent submissions don't throttle each other
+        expectedQueueSize = std::max(expectedQueueSize, tasksSinceQueueStall);
+    }
+    return std::min(expectedQueueSize, maxQueueSize);
+}
+
 template <typename GfxFamily>
 void encodeRegistersBeforeDependencyCheckers(LinearStream &cmdStream) {
     // Indirect BB_START operates only on GPR_0
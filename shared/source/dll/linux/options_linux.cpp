@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,6 +20,8 @@ const char *dxcoreDllName = "/usr/lib/wsl/lib/libdxcore.so";
 const char *sysFsPciPathPrefix = "/sys/bus/pci/devices/";
 const char *pciDevicesDirectory = "/dev/dri/by-path";
 const char *sysFsProcPathPrefix = "/proc";
+const char *debugFsDriPathPrefix = "/sys/kernel/debug/dri/";
+const char *firmwarePathPrefix = "/lib/firmware/";
 
 // Metrics Library name
 const char *metricsLibraryDllName = "libigdml.so.1";
@@ -114,6 +114,10 @@ bool RootDeviceEnvironment::initAilConfiguration() {
         return true;
     }
 
+    // AIL configuration is a per product singleton, while root devices may be initialized concurrently
+    static std::mutex ailConfigurationMutex;
+    std::lock_guard<std::mutex> lock(ailConfigurationMutex);
+
     auto result = ailConfiguration->initProcessExecutableName();
     if (result != true) {
         return false;
@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/image_tiling_helper.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/gmm_helper/gmm.h"
+#include "shared/source/gmm_helper/resource_info.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/worker_pool.h"
+
+#include <algorithm>
+#include <cstring>
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <immintrin.h>
+#endif
+
+namespace NEO {
+namespace ImageTilingHelper {
+
+namespace {
+constexpr uint32_t defaultMaxThreads = 4;
+
+struct TilingWorkItem {
+    const TiledImageCopyArgs *args = nullptr;
+    size_t rowBegin = 0;
+    size_t rowEnd = 0;
+};
+
+inline size_t getTileYOffsetInTile(size_t x, size_t y) {
+    // 16B wide columns, 32 rows each
+    return ((x / chunkSize) * chunkSize * tileHeight) + (y * chunkSize) + (x % chunkSize);
+}
+
+inline size_t getTile4OffsetInTile(size_t x, size_t y) {
+    // 64B cells (16B x 4 rows), 4 cells across make 256B rows of a 512B block (64B x 8 rows),
+    // blocks are placed 2 across and 4 down: x[3:0] y[1:0] x[5:4] y[2] x[6] y[4:3]
+    return (x & 0xF) |
+           ((y & 0x3) << 4) |
+           (((x >> 4) & 0x3) << 6) |
+           (((y >> 2) & 0x1) << 8) |
+           (((x >> 6) & 0x1) << 9) |
+           (((y >> 3) & 0x3) << 10);
+}
+
+template <bool toTiled>
+inline void copyChunk(void *tiled, void *linear) {
+    if constexpr (toTiled) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(tiled), _mm_loadu_si128(reinterpret_cast<const __m128i *>(linear)));
+    } else {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(linear), _mm_loadu_si128(reinterpret_cast<const __m128i *>(tiled)));
+    }
+}
+
+template <bool toTiled>
+void copyRows(const TilingWorkItem &workItem) {
+    auto &args = *workItem.args;
+    const size_t xBegin = args.origin[0];
+    const size_t xEnd = xBegin + args.region[0];
+
+    for (size_t row = workItem.rowBegin; row < workItem.rowEnd; row++) {
+        const size_t y = args.origin[1] + (row % args.region[1]);
+        const size_t slice = args.origin[2] + (row / args.region[1]);
+
+        auto tiledSlice = ptrOffset(args.tiledPtr, slice * args.tiledSlicePitch);
+        auto linearRow = ptrOffset(args.linearPtr, slice * args.linearSlicePitch + y * args.linearRowPitch);
+
+        // every 16B chunk is contiguous in both layouts, only chunk placement differs
+        size_t x = xBegin;
+        while (x < xEnd) {
+            const size_t chunkEnd = std::min(alignDown(x, chunkSize) + chunkSize, xEnd);
+            const size_t bytes = chunkEnd - x;
+
+            auto tiled = ptrOffset(tiledSlice, getTiledOffset(args.tilingMode, x, y, args.tiledRowPitch));
+            auto linear = ptrOffset(linearRow, x);
+
+            if (bytes == chunkSize) {
+                copyChunk<toTiled>(tiled, linear);
+            } else if constexpr (toTiled) {
+                memcpy(tiled, linear, bytes);
+            } else {
+                memcpy(linear, tiled, bytes);
+            }
+            x = chunkEnd;
+        }
+    }
+}
+
+template <bool toTiled>
+void copyImage(const TiledImageCopyArgs &args) {
+    UNRECOVERABLE_IF(args.tilingMode == ImageTilingMode::Unsupported);
+
+    const size_t totalRows = args.region[1] * args.region[2];
+    if (totalRows == 0 || args.region[0] == 0) {
+        return;
+    }
+
+    const uint32_t numThreads = getNumWorkerThreads(args);
+    const size_t rowsPerThread = (totalRows + numThreads - 1) / numThreads;
+
+    auto copyPart = [&](size_t partIndex) {
+        TilingWorkItem workItem;
+        workItem.args = &args;
+        workItem.rowBegin = std::min(partIndex * rowsPerThread, totalRows);
+        workItem.rowEnd = std::min((partIndex + 1) * rowsPerThread, totalRows);
+        copyRows<toTiled>(workItem);
+    };
+
+    if (numThreads > 1) {
+        args.workerPool->parallelFor(numThreads, copyPart);
+    } else {
+        copyPart(0);
+    }
+}
+} // namespace
+
+bool isCpuTilingEnabled() {
+    return (DebugManager.flags.EnableCpuImageTiling.get() == 1);
+}
+
+ImageTilingMode getTilingMode(Gmm *gmm) {
+    if (!gmm) {
+        return ImageTilingMode::Linear;
+    }
+
+    auto &resInfo = gmm->gmmResourceInfo->getResourceFlags()->Info;
+    if (resInfo.Linear) {
+        return ImageTilingMode::Linear;
+    }
+    if (resInfo.Tile4) {
+        return ImageTilingMode::Tile4;
+    }
+    if (resInfo.TiledY && !resInfo.TiledYf && !resInfo.TiledYs) {
+        return ImageTilingMode::TileY;
+    }
+    return ImageTilingMode::Unsupported;
+}
+
+size_t getTiledOffset(ImageTilingMode tilingMode, size_t xInBytes, size_t y, size_t tiledRowPitch) {
+    if (tilingMode == ImageTilingMode::Linear) {
+        return (y * tiledRowPitch) + xInBytes;
+    }
+    DEBUG_BREAK_IF(tiledRowPitch % tileWidthInBytes != 0);
+
+    const size_t tileBase = ((y / tileHeight) * tiledRowPitch * tileHeight) + ((xInBytes / tileWidthInBytes) * tileSize);
+    const size_t xInTile = xInBytes % tileWidthInBytes;
+    const size_t yInTile = y % tileHeight;
+
+    if (tilingMode == ImageTilingMode::Tile4) {
+        return tileBase + getTile4OffsetInTile(xInTile, yInTile);
+    }
+    return tileBase + getTileYOffsetInTile(xInTile, yInTile);
+}
+
+uint32_t getNumWorkerThreads(const TiledImageCopyArgs &args) {
+    uint32_t maxThreads = defaultMaxThreads;
+    if (DebugManager.flags.CpuImageTilingMaxThreads.get() != -1) {
+        maxThreads = static_cast<uint32_t>(std::max(DebugManager.flags.CpuImageTilingMaxThreads.get(), 1));
+    }
+    // calling thread takes part in the copy
+    maxThreads = args.workerPool ? std::min(maxThreads, args.workerPool->getMaxWorkers() + 1) : 1u;
+
+    // small frames are copied inline, handing rows over to workers would cost more than the copy itself
+    const size_t totalRows = args.region[1] * args.region[2];
+    const size_t totalBytes = args.region[0] * totalRows;
+    size_t numThreads = std::max(totalBytes / minBytesPerThread, static_cast<size_t>(1u));
+    numThreads = std::min({numThreads, static_cast<size_t>(maxThreads), std::max(totalRows, static_cast<size_t>(1u))});
+
+    return static_cast<uint32_t>(numThreads);
+}
+
+void copyLinearToTiled(const TiledImageCopyArgs &args) {
+    copyImage<true>(args);
+}
+
+void copyTiledToLinear(const TiledImageCopyArgs &args) {
+    copyImage<false>(args);
+}
+
+} // namespace ImageTilingHelper
+} // namespace NEO
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+class Gmm;
+class WorkerPool;
+
+enum class ImageTilingMode : uint32_t {
+    Linear = 0,
+    TileY,
+    Tile4,
+    Unsupported
+};
+
+struct TiledImageCopyArgs {
+    void *tiledPtr = nullptr;
+    size_t tiledRowPitch = 0;
+    size_t tiledSlicePitch = 0;
+    void *linearPtr = nullptr;
+    size_t linearRowPitch = 0;
+    size_t linearSlicePitch = 0;
+    std::array<size_t, 3> origin = {}; // x in bytes, row, slice - applies to both sides
+    std::array<size_t, 3> region = {}; // width in bytes, rows, slices
+    ImageTilingMode tilingMode = ImageTilingMode::Linear;
+    WorkerPool *workerPool = nullptr; // rows are copied on the calling thread only when not set
+};
+
+namespace ImageTilingHelper {
+// TileY and Tile4 share the 4KB tile footprint, they differ only in how 16B chunks are ordered inside the tile
+static constexpr size_t tileWidthInBytes = 128;
+static constexpr size_t tileHeight = 32;
+static constexpr size_t tileSize = tileWidthInBytes * tileHeight;
+static constexpr size_t chunkSize = 16;
+static constexpr size_t minBytesPerThread = 1 * 1024 * 1024;
+
+bool isCpuTilingEnabled();
+ImageTilingMode getTilingMode(Gmm *gmm);
+size_t getTiledOffset(ImageTilingMode tilingMode, size_t xInBytes, size_t y, size_t tiledRowPitch);
+uint32_t getNumWorkerThreads(const TiledImageCopyArgs &args);
+
+void copyLinearToTiled(const TiledImageCopyArgs &args);
+void copyTiledToLinear(const TiledImageCopyArgs &args);
+} // namespace ImageTilingHelper
+} // namespace NEO
@@ -46,16 +46,27 @@ void InternalAllocationStorage::cleanAllocationList(TaskCountType waitTaskCount,
     }
 }
 
-void InternalAllocationStorage::freeAllocationsList(TaskCountType waitTaskCount, AllocationsList &allocationsList) {
+size_t InternalAllocationStorage::trimAllocationsForReuse() {
+    // release only what the GPU is done with, waiting here could stall the allocating thread
+    auto completedTaskCount = commandStreamReceiver.peekTaskCount();
+    if (!commandStreamReceiver.testTaskCountReady(commandStreamReceiver.getTagAddress(), completedTaskCount)) {
+        completedTaskCount = commandStreamReceiver.peekCompletionWatermark();
+    }
+    return freeAllocationsList(completedTaskCount, allocationLists[REUSABLE_ALLOCATION]);
+}
+
+size_t InternalAllocationStorage::freeAllocationsList(TaskCountType waitTaskCount, AllocationsList &allocationsList) {
     auto memoryManager = commandStreamReceiver.getMemoryManager();
     auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
 
+    size_t freedSize = 0;
     GraphicsAllocation *curr = allocationsList.detachNodes();
 
     IDList<GraphicsAllocation, false, true> allocationsLeft;
     while (curr != nullptr) {
         auto *next = curr->next;
         if (curr->hostPtrTaskCountAssignment == 0 && curr->getTaskCount(commandStreamReceiver.getOsContext().getContextId()) <= waitTaskCount) {
+            freedSize += curr->getUnderlyingBufferSize();
             memoryManager->freeGraphicsMemory(curr);
         } else {
             allocationsLeft.pushTailOne(*curr);
@@ -66,6 +77,7 @@ void InternalAllocationStorage::freeAllocationsList(TaskCountType waitTaskCount,
     if (allocationsLeft.peekIsEmpty() == false) {
         allocationsList.splice(*allocationsLeft.detachNodes());
     }
+    return freedSize;
 }
 
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainReusableAllocation(size_t requiredSize, AllocationType allocationType) {
@@ -33,14 +33,17 @@
 #include "shared/source/memory_manager/host_ptr_manager.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/local_memory_usage.h"
+#include "shared/source/memory_manager/memory_pressure_manager.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/memory_manager/prefetch_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
+#include "shared/source/utilities/worker_pool.h"
 
 #include <algorithm>
+#include <thread>
 
 namespace NEO {
 uint32_t MemoryManager::maxOsContextCount = 0u;
@@ -79,9 +82,15 @@ MemoryManager::MemoryManager(ExecutionEnvironment &executionEnvironment) : execu
     if (DebugManager.flags.EnableMultiStorageResources.get() != -1) {
         supportsMultiStorageResources = !!DebugManager.flags.EnableMultiStorageResources.get();
     }
+
+    memoryPressureManager = std::make_unique<MemoryPressureManager>();
+    memoryPressureManager->registerShrinker("CSR reusable allocations", MemoryPressureManager::ReusableAllocations, [this](uint32_t rootDeviceIndex) {
+        return trimReusableAllocations(rootDeviceIndex);
+    });
 }
 
 MemoryManager::~MemoryManager() {
+    memoryPressureManager->printStatistics();
     for (auto &engineContainer : allRegisteredEngines) {
         for (auto &engine : engineContainer) {
             engine.osContext->decRefInternal();
@@ -94,6 +103,18 @@ MemoryManager::~MemoryManager() {
     }
 }
 
+WorkerPool *MemoryManager::getWorkerPool() {
+    // most processes never split work across threads, so the pool is created on first request only;
+    // its threads are spawned on first use and the thread calling into the pool works as well
+    std::call_once(workerPoolCreatedFlag, [this]() {
+        if (!workerPool) {
+            auto numCpus = std::thread::hardware_concurrency();
+            workerPool = std::make_unique<WorkerPool>(numCpus > 1 ? numCpus - 1 : 0u);
+        }
+    });
+    return workerPool.get();
+}
+
 bool MemoryManager::isLimitedGPU(uint32_t rootDeviceIndex) {
     return peek32bit() && !peekExecutionEnvironment().rootDeviceEnvironments[rootDeviceIndex]->isFullRangeSvm();
 }
@@ -519,6 +540,7 @@ bool MemoryManager::getAllocationData(AllocationData &allocationData, const Allo
     allocationData.osContext = properties.osContext;
     allocationData.rootDeviceIndex = properties.rootDeviceIndex;
     allocationData.useMmapObject = properties.useMmapObject;
+    allocationData.numaNode = properties.numaNode;
 
     helper.setExtraAllocationData(allocationData, properties, rootDeviceEnvironment);
     allocationData.flags.useSystemMemory |= properties.flags.forceSystemMemory;
@@ -581,14 +603,57 @@ GraphicsAllocation *MemoryManager::allocateGraphicsMemoryInPreferredPool(const A
         allocation = nullptr;
     }
     if (!allocation) {
+        // every retry follows a reclaim that released memory, so it ends once the caches run dry
+        if (MemoryPressureManager::isReclaimOnFailureEnabled() && memoryPressureManager->reclaim(properties.rootDeviceIndex, allocationData.size) > 0) {
+            return allocateGraphicsMemoryInPreferredPool(properties, hostPtr);
+        }
         return nullptr;
     }
 
+    if (allocation->isAllocatedInLocalMemoryPool()) {
+        reclaimAboveLocalMemoryWatermark(properties.rootDeviceIndex);
+    }
+
     fileLoggerInstance().logAllocation(allocation);
     registerAllocationInOs(allocation);
     return allocation;
 }
 
+size_t MemoryManager::trimReusableAllocations(uint32_t rootDeviceIndex) {
+    size_t bytesReclaimed = 0;
+    for (auto &engine : getRegisteredEngines(rootDeviceIndex)) {
+        // CSRs owned by other threads are skipped instead of waited on. The ownership mutex is recursive, so a CSR
+        // owned by the allocating thread itself is trimmed too, which is safe because reusable lists are not
+        // iterated across allocations and only allocations completed by the GPU are released
+        auto csr = engine.commandStreamReceiver;
+        auto lock = csr->tryObtainUniqueOwnership();
+        if (!lock.owns_lock()) {
+            continue;
+        }
+        bytesReclaimed += csr->getInternalAllocationStorage()->trimAllocationsForReuse();
+    }
+    return bytesReclaimed;
+}
+
+void MemoryManager::reclaimAboveLocalMemoryWatermark(uint32_t rootDeviceIndex) {
+    auto watermarkPercent = MemoryPressureManager::getLocalMemoryWatermarkPercent();
+    if (watermarkPercent == 0) {
+        return;
+    }
+
+    auto banksCount = GfxCoreHelper::getSubDevicesCount(executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo());
+    uint64_t occupiedSize = 0;
+    for (uint32_t bank = 0; bank < banksCount; bank++) {
+        occupiedSize += internalLocalMemoryUsageBankSelector[rootDeviceIndex]->getOccupiedMemorySizeForBank(bank);
+        occupiedSize += externalLocalMemoryUsageBankSelector[rootDeviceIndex]->getOccupiedMemorySizeForBank(bank);
+    }
+
+    auto watermark = getLocalMemorySize(rootDeviceIndex, static_cast<uint32_t>(maxNBitValue(banksCount))) * watermarkPercent / 100;
+    if (occupiedSize > watermark) {
+        memoryPressureManager->reclaim(rootDeviceIndex, static_cast<size_t>(occupiedSize - watermark));
+    }
+}
+
 GraphicsAllocation *MemoryManager::allocateInternalGraphicsMemoryWithHostCopy(uint32_t rootDeviceIndex,
                                                                               DeviceBitfield bitField,
                                                                               const void *ptr,
@@ -37,11 +37,13 @@ enum class DriverModelType;
 struct AllocationProperties;
 class LocalMemoryUsageBankSelector;
 class DeferredDeleter;
+class MemoryPressureManager;
 class ExecutionEnvironment;
 class Gmm;
 class HostPtrManager;
 class OsContext;
 class PrefetchManager;
+class WorkerPool;
 
 enum AllocationUsage {
     TEMPORARY_ALLOCATION,
@@ -180,6 +182,12 @@ class MemoryManager {
         return prefetchManager.get();
     }
 
+    MemoryPressureManager *getMemoryPressureManager() const {
+        return memoryPressureManager.get();
+    }
+
+    WorkerPool *getWorkerPool();
+
     void waitForDeletions();
     MOCKABLE_VIRTUAL void waitForEnginesCompletion(GraphicsAllocation &graphicsAllocation);
     MOCKABLE_VIRTUAL bool allocInUse(GraphicsAllocation &graphicsAllocation);
@@ -237,6 +245,7 @@ class MemoryManager {
 
     static uint32_t maxOsContextCount;
     virtual void commonCleanup(){};
+    virtual void invalidateHostPtrCache(const void *ptr, size_t size) {}
     virtual bool isCpuCopyRequired(const void *ptr) { return false; }
     virtual bool isWCMemory(const void *ptr) { return false; }
 
@@ -312,6 +321,8 @@ class MemoryManager {
     virtual void unlockResourceImpl(GraphicsAllocation &graphicsAllocation) = 0;
     virtual void freeAssociatedResourceImpl(GraphicsAllocation &graphicsAllocation) { return unlockResourceImpl(graphicsAllocation); };
     virtual void registerAllocationInOs(GraphicsAllocation *allocation) {}
+    size_t trimReusableAllocations(uint32_t rootDeviceIndex);
+    void reclaimAboveLocalMemoryWatermark(uint32_t rootDeviceIndex);
     bool isAllocationTypeToCapture(AllocationType type) const;
     void zeroCpuMemoryIfRequested(const AllocationData &allocationData, void *cpuPtr, size_t size);
     void updateLatestContextIdForRootDevice(uint32_t rootDeviceIndex);
@@ -337,6 +348,9 @@ class MemoryManager {
     void *reservedMemory = nullptr;
     std::unique_ptr<PageFaultManager> pageFaultManager;
     std::unique_ptr<PrefetchManager> prefetchManager;
+    std::unique_ptr<MemoryPressureManager> memoryPressureManager;
+    std::unique_ptr<WorkerPool> workerPool;
+    std::once_flag workerPoolCreatedFlag;
     OSMemory::ReservedCpuAddressRange reservedCpuAddressRange;
     HeapAssigner heapAssigner;
     AlignmentSelector alignmentSelector = {};
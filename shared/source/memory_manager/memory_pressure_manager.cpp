@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/memory_pressure_manager.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+bool MemoryPressureManager::isReclaimOnFailureEnabled() {
+    return DebugManager.flags.EnableMemoryPressureReclaim.get() == 1;
+}
+
+uint32_t MemoryPressureManager::getLocalMemoryWatermarkPercent() {
+    auto watermarkPercent = DebugManager.flags.LocalMemoryPressureWatermarkPercent.get();
+    if (watermarkPercent <= 0 || watermarkPercent > 100) {
+        return 0u;
+    }
+    return static_cast<uint32_t>(watermarkPercent);
+}
+
+uint32_t MemoryPressureManager::registerShrinker(const char *name, uint32_t priority, ShrinkFunction shrinkFunction) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto position = std::upper_bound(shrinkers.begin(), shrinkers.end(), priority, [](uint32_t priority, const Shrinker &shrinker) {
+        return priority < shrinker.priority;
+    });
+
+    auto shrinkerId = nextShrinkerId++;
+    Shrinker shrinker{shrinkerId, priority, std::move(shrinkFunction), {}};
+    shrinker.statistics.name = name;
+    shrinkers.insert(position, std::move(shrinker));
+    return shrinkerId;
+}
+
+void MemoryPressureManager::unregisterShrinker(uint32_t shrinkerId) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto shrinker = std::find_if(shrinkers.begin(), shrinkers.end(), [shrinkerId](const Shrinker &shrinker) {
+        return shrinker.id == shrinkerId;
+    });
+    if (shrinker != shrinkers.end()) {
+        shrinkers.erase(shrinker);
+    }
+}
+
+size_t MemoryPressureManager::reclaim(uint32_t rootDeviceIndex, size_t bytesRequested) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    size_t bytesReclaimed = 0;
+    for (auto &shrinker : shrinkers) {
+        if (bytesReclaimed >= bytesRequested) {
+            break;
+        }
+        auto shrinkerReclaimed = shrinker.shrinkFunction(rootDeviceIndex);
+        shrinker.statistics.invocations++;
+        shrinker.statistics.reclaimedBytes += shrinkerReclaimed;
+        bytesReclaimed += shrinkerReclaimed;
+    }
+    return bytesReclaimed;
+}
+
+size_t MemoryPressureManager::getNumShrinkers() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return shrinkers.size();
+}
+
+std::vector<MemoryPressureManager::ShrinkerStatistics> MemoryPressureManager::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::vector<ShrinkerStatistics> statistics;
+    for (auto &shrinker : shrinkers) {
+        statistics.push_back(shrinker.statistics);
+    }
+    return statistics;
+}
+
+void MemoryPressureManager::printStatistics() const {
+    for (auto &statistics : getStatistics()) {
+        PRINT_DEBUG_STRING(DebugManager.flags.PrintMemoryPressureReclaimStatistics.get(), stdout, "Memory pressure shrinker %s: reclaimed bytes: %llu, invocations: %llu\n",
+                           statistics.name.c_str(), static_cast<unsigned long long>(statistics.reclaimedBytes), static_cast<unsigned long long>(statistics.invocations));
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace NEO {
+
+// Caches retaining idle memory register here as shrinkers. When an allocation fails or local memory
+// usage crosses the watermark, shrinkers are asked to release memory in priority order until enough is reclaimed.
+// Shrink functions must not allocate and must not block on locks that may be held while allocating.
+class MemoryPressureManager : NonCopyableOrMovableClass {
+  public:
+    using ShrinkFunction = std::function<size_t(uint32_t rootDeviceIndex)>;
+
+    enum ShrinkerPriority : uint32_t {
+        CachedAllocations = 0,
+        ReusableAllocations = 1,
+    };
+
+    struct ShrinkerStatistics {
+        std::string name;
+        uint64_t reclaimedBytes = 0;
+        uint64_t invocations = 0;
+    };
+
+    static bool isReclaimOnFailureEnabled();
+    static uint32_t getLocalMemoryWatermarkPercent();
+
+    uint32_t registerShrinker(const char *name, uint32_t priority, ShrinkFunction shrinkFunction);
+    void unregisterShrinker(uint32_t shrinkerId);
+    size_t reclaim(uint32_t rootDeviceIndex, size_t bytesRequested);
+
+    size_t getNumShrinkers() const;
+    std::vector<ShrinkerStatistics> getStatistics() const;
+    void printStatistics() const;
+
+  protected:
+    struct Shrinker {
+        uint32_t id;
+        uint32_t priority;
+        ShrinkFunction shrinkFunction;
+        ShrinkerStatistics statistics;
+    };
+
+    // ordered by priority, shrinkers of equal priority keep registration order
+    std::vector<Shrinker> shrinkers;
+    uint32_t nextShrinkerId = 0;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
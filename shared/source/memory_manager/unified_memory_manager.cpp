@@ -18,6 +18,7 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/compression_selector.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/memory_pressure_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
@@ -64,14 +65,34 @@ void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemory
     return nullptr;
 }
 
-void SVMAllocsManager::SvmAllocationCache::trim(SVMAllocsManager *svmAllocsManager) {
+size_t SVMAllocsManager::SvmAllocationCache::trim(SVMAllocsManager *svmAllocsManager) {
     std::lock_guard<std::mutex> lock(this->mtx);
+    size_t trimmedSize = 0;
     for (auto &cachedAllocationInfo : this->allocations) {
         SvmAllocationData *svmData = svmAllocsManager->getSVMAlloc(cachedAllocationInfo.allocation);
         DEBUG_BREAK_IF(nullptr == svmData);
         svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, FreePolicyType::POLICY_NONE, svmData);
+        trimmedSize += cachedAllocationInfo.allocationSize;
     }
     this->allocations.clear();
+    return trimmedSize;
+}
+
+size_t SVMAllocsManager::SvmAllocationCache::trim(SVMAllocsManager *svmAllocsManager, uint32_t rootDeviceIndex) {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    size_t trimmedSize = 0;
+    for (auto allocationIter = allocations.begin(); allocationIter != allocations.end();) {
+        SvmAllocationData *svmData = svmAllocsManager->getSVMAlloc(allocationIter->allocation);
+        DEBUG_BREAK_IF(nullptr == svmData);
+        if (rootDeviceIndex > svmData->maxRootDeviceIndex || svmData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex) == nullptr) {
+            ++allocationIter;
+            continue;
+        }
+        svmAllocsManager->freeSVMAllocImpl(allocationIter->allocation, FreePolicyType::POLICY_NONE, svmData);
+        trimmedSize += allocationIter->allocationSize;
+        allocationIter = allocations.erase(allocationIter);
+    }
+    return trimmedSize;
 }
 
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
@@ -174,7 +195,11 @@ SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager, bool multiOsCon
     }
 }
 
-SVMAllocsManager::~SVMAllocsManager() = default;
+SVMAllocsManager::~SVMAllocsManager() {
+    if (this->usmDeviceAllocationsCacheEnabled) {
+        memoryManager->getMemoryPressureManager()->unregisterShrinker(this->usmDeviceAllocationsCacheShrinkerId);
+    }
+}
 
 void *SVMAllocsManager::createSVMAlloc(size_t size, const SvmAllocationProperties svmProperties,
                                        const RootDeviceIndicesContainer &rootDeviceIndices,
@@ -218,6 +243,7 @@ void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
     unifiedMemoryProperties.flags.isUSMHostAllocation = true;
     unifiedMemoryProperties.flags.isUSMDeviceAllocation = false;
     unifiedMemoryProperties.cacheRegion = MemoryPropertiesHelper::getCacheRegion(memoryProperties.allocationFlags);
+    unifiedMemoryProperties.numaNode = memoryProperties.numaNode;
 
     auto maxRootDeviceIndex = *std::max_element(rootDeviceIndicesVector.begin(), rootDeviceIndicesVector.end(), std::less<uint32_t const>());
     SvmAllocationData allocData(maxRootDeviceIndex);
@@ -656,6 +682,9 @@ void SVMAllocsManager::freeZeroCopySvmAllocation(SvmAllocationData *svmData) {
 
 void SVMAllocsManager::initUsmDeviceAllocationsCache() {
     this->usmDeviceAllocationsCache.allocations.reserve(128u);
+    this->usmDeviceAllocationsCacheShrinkerId = memoryManager->getMemoryPressureManager()->registerShrinker("USM device allocation cache", MemoryPressureManager::CachedAllocations, [this](uint32_t rootDeviceIndex) {
+        return this->usmDeviceAllocationsCache.trim(this, rootDeviceIndex);
+    });
 }
 
 void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData) {
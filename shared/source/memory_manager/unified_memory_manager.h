@@ -133,6 +133,7 @@ class SVMAllocsManager {
         const RootDeviceIndicesContainer &rootDeviceIndices;
         const std::map<uint32_t, DeviceBitfield> &subdeviceBitfields;
         AllocationType requestedAllocationType = AllocationType::UNKNOWN;
+        int32_t numaNode = -1;
     };
 
     struct SvmCacheAllocationInfo {
@@ -150,7 +151,8 @@ class SVMAllocsManager {
     struct SvmAllocationCache {
         void insert(size_t size, void *);
         void *get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager);
-        void trim(SVMAllocsManager *svmAllocsManager);
+        size_t trim(SVMAllocsManager *svmAllocsManager);
+        size_t trim(SVMAllocsManager *svmAllocsManager, uint32_t rootDeviceIndex);
         std::vector<SvmCacheAllocationInfo> allocations;
         std::mutex mtx;
     };
@@ -234,5 +236,6 @@ class SVMAllocsManager {
     bool multiOsContextSupport;
     SvmAllocationCache usmDeviceAllocationsCache;
     bool usmDeviceAllocationsCacheEnabled = false;
+    uint32_t usmDeviceAllocationsCacheShrinkerId = 0;
 };
 } // namespace NEO
@@ -19,10 +19,13 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/aub_memory_operations_handler.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/os_interface/os_thread.h"
 #include "shared/source/os_interface/product_helper.h"
 
 #include "hw_device_id.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 bool DeviceFactory::prepareDeviceEnvironmentsForProductFamilyOverride(ExecutionEnvironment &executionEnvironment) {
@@ -136,8 +139,8 @@ bool DeviceFactory::isHwModeSelected() {
     }
 }
 
-static bool initHwDeviceIdResources(ExecutionEnvironment &executionEnvironment,
-                                    std::unique_ptr<NEO::HwDeviceId> &&hwDeviceId, uint32_t rootDeviceIndex) {
+static bool initOsInterfaceResources(ExecutionEnvironment &executionEnvironment,
+                                     std::unique_ptr<NEO::HwDeviceId> &&hwDeviceId, uint32_t rootDeviceIndex) {
     if (!executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initOsInterface(std::move(hwDeviceId), rootDeviceIndex)) {
         return false;
     }
@@ -152,11 +155,46 @@ static bool initHwDeviceIdResources(ExecutionEnvironment &executionEnvironment,
             static_cast<unsigned short>(DebugManager.flags.OverrideRevision.get());
     }
 
+    return true;
+}
+
+static bool initHwDeviceIdResources(ExecutionEnvironment &executionEnvironment,
+                                    std::unique_ptr<NEO::HwDeviceId> &&hwDeviceId, uint32_t rootDeviceIndex) {
+    if (!initOsInterfaceResources(executionEnvironment, std::move(hwDeviceId), rootDeviceIndex)) {
+        return false;
+    }
+
     executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initGmm();
 
     return true;
 }
 
+namespace {
+struct OsInterfaceInitArgs {
+    ExecutionEnvironment *executionEnvironment;
+    std::vector<std::unique_ptr<HwDeviceId>> *hwDeviceIds;
+    std::vector<uint8_t> *results;
+    uint32_t firstRootDeviceIndex;
+    uint32_t stride;
+};
+
+void *initOsInterfacesWorker(void *arg) {
+    auto &args = *reinterpret_cast<OsInterfaceInitArgs *>(arg);
+    for (auto rootDeviceIndex = args.firstRootDeviceIndex; rootDeviceIndex < args.hwDeviceIds->size(); rootDeviceIndex += args.stride) {
+        (*args.results)[rootDeviceIndex] = initOsInterfaceResources(*args.executionEnvironment, std::move((*args.hwDeviceIds)[rootDeviceIndex]), rootDeviceIndex);
+    }
+    return nullptr;
+}
+} // namespace
+
+uint32_t DeviceFactory::getRootDeviceInitializationThreadsCount(size_t numRootDevices) {
+    auto maxThreads = DebugManager.flags.ParallelRootDeviceInitialization.get();
+    if (maxThreads <= 1 || numRootDevices < 2) {
+        return 1u;
+    }
+    return static_cast<uint32_t>(std::min(static_cast<size_t>(maxThreads), numRootDevices));
+}
+
 bool DeviceFactory::prepareDeviceEnvironments(ExecutionEnvironment &executionEnvironment) {
     using HwDeviceIds = std::vector<std::unique_ptr<HwDeviceId>>;
 
@@ -167,14 +205,41 @@ bool DeviceFactory::prepareDeviceEnvironments(ExecutionEnvironment &executionEnv
 
     executionEnvironment.prepareRootDeviceEnvironments(static_cast<uint32_t>(hwDeviceIds.size()));
 
-    uint32_t rootDeviceIndex = 0u;
+    auto threadsCount = getRootDeviceInitializationThreadsCount(hwDeviceIds.size());
+    if (threadsCount > 1) {
+        // device queries run concurrently, each thread owns a strided subset of root devices
+        std::vector<uint8_t> results(hwDeviceIds.size(), false);
+        std::vector<OsInterfaceInitArgs> initArgs;
+        for (auto threadId = 0u; threadId < threadsCount; threadId++) {
+            initArgs.push_back({&executionEnvironment, &hwDeviceIds, &results, threadId, threadsCount});
+        }
 
-    for (auto &hwDeviceId : hwDeviceIds) {
-        if (initHwDeviceIdResources(executionEnvironment, std::move(hwDeviceId), rootDeviceIndex) == false) {
-            return false;
+        std::vector<std::unique_ptr<Thread>> workers;
+        for (auto threadId = 1u; threadId < threadsCount; threadId++) {
+            workers.push_back(Thread::create(initOsInterfacesWorker, &initArgs[threadId]));
+        }
+        initOsInterfacesWorker(&initArgs[0]);
+        for (auto &worker : workers) {
+            worker->join();
         }
 
-        rootDeviceIndex++;
+        // gmm client contexts are created in root device order, as in serial initialization
+        for (uint32_t rootDeviceIndex = 0u; rootDeviceIndex < hwDeviceIds.size(); rootDeviceIndex++) {
+            if (!results[rootDeviceIndex]) {
+                return false;
+            }
+            executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initGmm();
+        }
+    } else {
+        uint32_t rootDeviceIndex = 0u;
+
+        for (auto &hwDeviceId : hwDeviceIds) {
+            if (initHwDeviceIdResources(executionEnvironment, std::move(hwDeviceId), rootDeviceIndex) == false) {
+                return false;
+            }
+
+            rootDeviceIndex++;
+        }
     }
 
     executionEnvironment.sortNeoDevices();
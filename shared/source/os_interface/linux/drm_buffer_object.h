@@ -142,6 +142,8 @@ class BufferObject {
     void setAddress(uint64_t address);
     void *peekLockedAddress() const { return lockedAddress; }
     void setLockedAddress(void *cpuAddress) { this->lockedAddress = cpuAddress; }
+    uint64_t peekLockMmapOffset() const { return lockMmapOffset; }
+    void setLockMmapOffset(uint64_t offset) { this->lockMmapOffset = offset; }
     void setUnmapSize(uint64_t unmapSize) { this->unmapSize = unmapSize; }
     uint64_t peekUnmapSize() const { return unmapSize; }
     bool peekIsReusableAllocation() const { return this->isReused; }
@@ -235,6 +237,7 @@ class BufferObject {
     void printBOBindingResult(OsContext *osContext, uint32_t vmHandleId, bool bind, int retVal);
 
     void *lockedAddress; // CPU side virtual address
+    uint64_t lockMmapOffset = 0u;
 
     uint64_t unmapSize = 0;
     uint64_t patIndex = CommonConstants::unsupportedPatIndex;
@@ -41,10 +41,14 @@
 #include "shared/source/os_interface/linux/i915_prelim.h"
 #include "shared/source/os_interface/linux/memory_info.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/worker_pool.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
+#include <linux/mempolicy.h>
 #include <memory>
 #include <sys/ioctl.h>
 
@@ -81,7 +85,8 @@ void DrmMemoryManager::initialize(gemCloseWorkerMode mode) {
             initialized = false;
             return;
         }
-        localMemAllocs.emplace_back();
+        localMemAllocs.push_back(std::make_unique<RegisteredAllocations>());
+        deviceNumaNodes.push_back(DebugManager.flags.EnableHostMemoryNumaPlacement.get() == 1 ? getDrm(rootDeviceIndex).getNumaNode() : -1);
         disableGemCloseWorker &= getDrm(rootDeviceIndex).isVmBindAvailable();
     }
 
@@ -97,6 +102,21 @@ void DrmMemoryManager::initialize(gemCloseWorkerMode mode) {
         gemCloseWorker.reset(new DrmGemCloseWorker(*this));
     }
 
+    if (DebugManager.flags.EnableUserptrBoCache.get() == 1) {
+        auto maxEntries = DrmUserptrCache::defaultMaxEntries;
+        if (DebugManager.flags.UserptrBoCacheMaxEntries.get() != -1) {
+            maxEntries = static_cast<size_t>(DebugManager.flags.UserptrBoCacheMaxEntries.get());
+        }
+        userptrCache = std::make_unique<DrmUserptrCache>(maxEntries);
+    }
+
+    if (DebugManager.flags.EnablePersistentLockMappings.get() == 1) {
+        persistentMappingsBudget = 256 * MemoryConstants::megaByte;
+        if (DebugManager.flags.PersistentLockMappingsBudgetInMb.get() != -1) {
+            persistentMappingsBudget = static_cast<size_t>(DebugManager.flags.PersistentLockMappingsBudgetInMb.get()) * MemoryConstants::megaByte;
+        }
+    }
+
     for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < gfxPartitions.size(); ++rootDeviceIndex) {
         if (forcePinEnabled || validateHostPtrMemory) {
             auto cpuAddrBo = alignedMallocWrapper(MemoryConstants::pageSize, MemoryConstants::pageSize);
@@ -138,6 +158,7 @@ void DrmMemoryManager::createDeviceSpecificMemResources(uint32_t rootDeviceIndex
 }
 
 DrmMemoryManager::~DrmMemoryManager() {
+    releaseUserptrCache();
     for (auto &memoryForPinBB : memoryForPinBBs) {
         if (memoryForPinBB) {
             MemoryManager::alignedFreeWrapper(memoryForPinBB);
@@ -160,6 +181,14 @@ void DrmMemoryManager::releaseBufferObject(uint32_t rootDeviceIndex) {
 }
 
 void DrmMemoryManager::commonCleanup() {
+    releaseUserptrCache();
+    releaseAllPersistentMappings();
+
+    auto numaStatistics = getNumaPlacementStatistics();
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintNumaPlacementStatistics.get(), stdout, "NUMA placement on device node: %llu, on requested node: %llu, failed: %llu\n",
+                       static_cast<unsigned long long>(numaStatistics.placedOnDeviceNode), static_cast<unsigned long long>(numaStatistics.placedOnRequestedNode),
+                       static_cast<unsigned long long>(numaStatistics.failed));
+
     if (gemCloseWorker) {
         gemCloseWorker->close(true);
     }
@@ -371,14 +400,30 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignmentImpl(const A
 }
 
 DrmAllocation *DrmMemoryManager::createAllocWithAlignmentFromUserptr(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSVMSize, uint64_t gpuAddress) {
-    auto res = alignedMallocWrapper(size, alignment);
+    size_t mappedSize = 0;
+    auto res = allocateHugeTlbMemory(size, alignment, mappedSize);
+    if (!res && getPreferredNumaNode(allocationData) >= 0) {
+        // malloc heap pages can be shared with other allocations and already placed, placed memory gets its own mapping
+        res = allocateNumaPlacedMemory(size, alignment, mappedSize);
+    }
     if (!res) {
-        return nullptr;
+        res = alignedMallocWrapper(size, alignment);
+        if (!res) {
+            return nullptr;
+        }
+        adviseHugePages(res, size);
+    } else {
+        // policy is set before first touch, so pages are allocated on the preferred node when they are faulted in
+        applyNumaPlacement(allocationData, res, size);
     }
 
     std::unique_ptr<BufferObject, BufferObject::Deleter> bo(allocUserptr(reinterpret_cast<uintptr_t>(res), size, allocationData.rootDeviceIndex));
     if (!bo) {
-        alignedFreeWrapper(res);
+        if (mappedSize) {
+            this->munmapFunction(res, mappedSize);
+        } else {
+            alignedFreeWrapper(res);
+        }
         return nullptr;
     }
 
@@ -389,10 +434,19 @@ DrmAllocation *DrmMemoryManager::createAllocWithAlignmentFromUserptr(const Alloc
     auto gmmHelper = getGmmHelper(allocationData.rootDeviceIndex);
     auto canonizedGpuAddress = gmmHelper->canonize(bo->peekAddress());
     auto allocation = std::make_unique<DrmAllocation>(allocationData.rootDeviceIndex, allocationData.type, bo.get(), res, canonizedGpuAddress, size, MemoryPool::System4KBPages);
-    allocation->setDriverAllocatedCpuPtr(res);
+    if (mappedSize) {
+        allocation->registerMemoryToUnmap(res, mappedSize, this->munmapFunction);
+    } else {
+        allocation->setDriverAllocatedCpuPtr(res);
+    }
     allocation->setReservedAddressRange(reinterpret_cast<void *>(gpuAddress), alignedSVMSize);
     if (!allocation->setCacheRegion(&this->getDrm(allocationData.rootDeviceIndex), static_cast<CacheRegion>(allocationData.cacheRegion))) {
-        alignedFreeWrapper(res);
+        // memory registered to unmap is released only when allocation is freed by memory manager
+        if (mappedSize) {
+            this->munmapFunction(res, mappedSize);
+        } else {
+            alignedFreeWrapper(res);
+        }
         return nullptr;
     }
 
@@ -401,6 +455,108 @@ DrmAllocation *DrmMemoryManager::createAllocWithAlignmentFromUserptr(const Alloc
     return allocation.release();
 }
 
+void *DrmMemoryManager::allocateHugeTlbMemory(size_t size, size_t alignment, size_t &mappedSize) {
+    auto pageSizeInMb = DebugManager.flags.HostHugeTlbPageSizeInMb.get();
+    if (pageSizeInMb <= 0) {
+        return nullptr;
+    }
+
+    const size_t hugePageSize = static_cast<size_t>(pageSizeInMb) * MemoryConstants::megaByte;
+    if (!Math::isPow2(hugePageSize) || size < hugePageSize || alignment > hugePageSize) {
+        return nullptr;
+    }
+
+    auto alignedSize = alignUp(size, hugePageSize);
+    auto hugePageSizeFlag = static_cast<int>(Math::log2(static_cast<uint64_t>(hugePageSize))) << MAP_HUGE_SHIFT;
+    auto ptr = this->mmapFunction(nullptr, alignedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | hugePageSizeFlag, -1, 0);
+    if (ptr == MAP_FAILED) {
+        // hugetlbfs pool of this page size is not reserved or exhausted
+        return nullptr;
+    }
+
+    mappedSize = alignedSize;
+    return ptr;
+}
+
+void *DrmMemoryManager::allocateNumaPlacedMemory(size_t size, size_t alignment, size_t &mappedSize) {
+    auto alignedSize = alignUp(size, MemoryConstants::pageSize);
+    alignment = std::max(alignment, MemoryConstants::pageSize);
+    auto totalSize = alignedSize + alignment - MemoryConstants::pageSize;
+    auto basePtr = this->mmapFunction(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (basePtr == MAP_FAILED) {
+        return nullptr;
+    }
+
+    auto ptr = alignUp(basePtr, alignment);
+    auto headSize = ptrDiff(ptr, basePtr);
+    if (headSize > 0) {
+        this->munmapFunction(basePtr, headSize);
+    }
+    auto tailSize = totalSize - headSize - alignedSize;
+    if (tailSize > 0) {
+        this->munmapFunction(ptrOffset(ptr, alignedSize), tailSize);
+    }
+
+    mappedSize = alignedSize;
+    return ptr;
+}
+
+void DrmMemoryManager::adviseHugePages(void *ptr, size_t size) {
+    if (DebugManager.flags.EnableHostTransparentHugePages.get() != 1 || size < MemoryConstants::pageSize2Mb) {
+        return;
+    }
+
+    // i915 maps physically contiguous userptr pages with 64KB/2MB GTT entries, so both CPU and GPU benefit
+    this->madviseFunction(ptr, size, MADV_HUGEPAGE);
+}
+
+int DrmMemoryManager::getPreferredNumaNode(const AllocationData &allocationData) const {
+    if (allocationData.numaNode >= 0) {
+        return allocationData.numaNode;
+    }
+
+    auto placeOnDeviceNode = allocationData.flags.isUSMHostAllocation ||
+                             allocationData.type == AllocationType::COMMAND_BUFFER ||
+                             allocationData.type == AllocationType::RING_BUFFER ||
+                             allocationData.type == AllocationType::INTERNAL_HOST_MEMORY;
+    return placeOnDeviceNode ? deviceNumaNodes[allocationData.rootDeviceIndex] : -1;
+}
+
+void DrmMemoryManager::applyNumaPlacement(const AllocationData &allocationData, void *ptr, size_t size) {
+    auto numaNode = getPreferredNumaNode(allocationData);
+    if (numaNode < 0) {
+        return;
+    }
+
+    // kernel ignores the last bit of the node mask
+    constexpr unsigned long nodeMaskBits = sizeof(unsigned long) * 8;
+    if (static_cast<unsigned long>(numaNode) >= nodeMaskBits - 1) {
+        numaPlacementFailed++;
+        return;
+    }
+
+    // preferred policy falls back to other nodes when the node is full, already touched pages are migrated
+    unsigned long nodeMask = 1ul << numaNode;
+    if (SysCalls::mbind(ptr, size, MPOL_PREFERRED, &nodeMask, nodeMaskBits, MPOL_MF_MOVE) != 0) {
+        numaPlacementFailed++;
+        return;
+    }
+
+    if (allocationData.numaNode >= 0) {
+        numaPlacedOnRequestedNode++;
+    } else {
+        numaPlacedOnDeviceNode++;
+    }
+}
+
+DrmMemoryManager::NumaPlacementStatistics DrmMemoryManager::getNumaPlacementStatistics() const {
+    NumaPlacementStatistics statistics;
+    statistics.placedOnDeviceNode = numaPlacedOnDeviceNode.load();
+    statistics.placedOnRequestedNode = numaPlacedOnRequestedNode.load();
+    statistics.failed = numaPlacementFailed.load();
+    return statistics;
+}
+
 void DrmMemoryManager::obtainGpuAddress(const AllocationData &allocationData, BufferObject *bo, uint64_t gpuAddress) {
     if ((isLimitedRange(allocationData.rootDeviceIndex) || allocationData.type == AllocationType::SVM_CPU) &&
         !allocationData.flags.isUSMHostAllocation) {
@@ -1121,6 +1277,7 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation,
     }
 
     if (drmAlloc->getMmapPtr()) {
+        invalidateHostPtrCache(drmAlloc->getMmapPtr(), drmAlloc->getMmapSize());
         this->munmapFunction(drmAlloc->getMmapPtr(), drmAlloc->getMmapSize());
     }
 
@@ -1133,6 +1290,7 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation,
     } else {
         auto &bos = static_cast<DrmAllocation *>(gfxAllocation)->getBOs();
         for (auto bo : bos) {
+            releasePersistentMapping(bo);
             unreference(bo, bo && bo->peekIsReusableAllocation() ? false : true);
         }
         if (isImported == false) {
@@ -1141,6 +1299,9 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation,
     }
 
     releaseGpuRange(gfxAllocation->getReservedAddressPtr(), gfxAllocation->getReservedAddressSize(), gfxAllocation->getRootDeviceIndex());
+    if (gfxAllocation->getDriverAllocatedCpuPtr()) {
+        invalidateHostPtrCache(gfxAllocation->getDriverAllocatedCpuPtr(), gfxAllocation->getUnderlyingBufferSize());
+    }
     alignedFreeWrapper(gfxAllocation->getDriverAllocatedCpuPtr());
 
     drmAlloc->freeRegisteredBOBindExtHandles(&getDrm(drmAlloc->getRootDeviceIndex()));
@@ -1200,6 +1361,8 @@ AllocationStatus DrmMemoryManager::populateOsHandles(OsHandleStorage &handleStor
     BufferObject *allocatedBos[maxFragmentsCount];
     uint32_t numberOfBosAllocated = 0;
     uint32_t indexesOfAllocatedBos[maxFragmentsCount];
+    uint32_t numberOfBosReused = 0;
+    uint32_t indexesOfReusedBos[maxFragmentsCount];
 
     for (unsigned int i = 0; i < maxFragmentsCount; i++) {
         // If there is no fragment it means it already exists.
@@ -1209,10 +1372,22 @@ AllocationStatus DrmMemoryManager::populateOsHandles(OsHandleStorage &handleStor
             handleStorage.fragmentStorageData[i].osHandleStorage = osHandle;
             handleStorage.fragmentStorageData[i].residency = new ResidencyData(maxOsContextCount);
 
+            if (userptrCache) {
+                // cached BOs were validated when created, no need to validate them again
+                osHandle->bo = userptrCache->acquire(rootDeviceIndex, reinterpret_cast<uintptr_t>(handleStorage.fragmentStorageData[i].cpuPtr),
+                                                     handleStorage.fragmentStorageData[i].fragmentSize);
+                if (osHandle->bo) {
+                    indexesOfReusedBos[numberOfBosReused] = i;
+                    numberOfBosReused++;
+                    continue;
+                }
+            }
+
             osHandle->bo = allocUserptr((uintptr_t)handleStorage.fragmentStorageData[i].cpuPtr,
                                         handleStorage.fragmentStorageData[i].fragmentSize, rootDeviceIndex);
             if (!osHandle->bo) {
                 handleStorage.fragmentStorageData[i].freeTheFragment = true;
+                returnUserptrsToCache(handleStorage, indexesOfReusedBos, numberOfBosReused, rootDeviceIndex);
                 return AllocationStatus::Error;
             }
 
@@ -1227,10 +1402,19 @@ AllocationStatus DrmMemoryManager::populateOsHandles(OsHandleStorage &handleStor
 
         if (result == EFAULT) {
             for (uint32_t i = 0; i < numberOfBosAllocated; i++) {
-                handleStorage.fragmentStorageData[indexesOfAllocatedBos[i]].freeTheFragment = true;
+                auto &fragment = handleStorage.fragmentStorageData[indexesOfAllocatedBos[i]];
+                if (userptrCache) {
+                    // BOs of invalid host pointers must not reach the cache in cleanOsHandles
+                    [[maybe_unused]] auto refCount = unreference(allocatedBos[i], true);
+                    DEBUG_BREAK_IF(refCount != 1u);
+                    static_cast<OsHandleLinux *>(fragment.osHandleStorage)->bo = nullptr;
+                }
+                fragment.freeTheFragment = true;
             }
+            returnUserptrsToCache(handleStorage, indexesOfReusedBos, numberOfBosReused, rootDeviceIndex);
             return AllocationStatus::InvalidHostPointer;
         } else if (result != 0) {
+            returnUserptrsToCache(handleStorage, indexesOfReusedBos, numberOfBosReused, rootDeviceIndex);
             return AllocationStatus::Error;
         }
     }
@@ -1238,18 +1422,73 @@ AllocationStatus DrmMemoryManager::populateOsHandles(OsHandleStorage &handleStor
     for (uint32_t i = 0; i < numberOfBosAllocated; i++) {
         hostPtrManager->storeFragment(rootDeviceIndex, handleStorage.fragmentStorageData[indexesOfAllocatedBos[i]]);
     }
+    for (uint32_t i = 0; i < numberOfBosReused; i++) {
+        hostPtrManager->storeFragment(rootDeviceIndex, handleStorage.fragmentStorageData[indexesOfReusedBos[i]]);
+    }
     return AllocationStatus::Success;
 }
 
+void DrmMemoryManager::returnUserptrsToCache(OsHandleStorage &handleStorage, const uint32_t *fragmentIndexes, uint32_t numFragments, uint32_t rootDeviceIndex) {
+    std::vector<BufferObject *> bosToDestroy;
+    for (uint32_t i = 0; i < numFragments; i++) {
+        auto &fragment = handleStorage.fragmentStorageData[fragmentIndexes[i]];
+        auto osHandle = static_cast<OsHandleLinux *>(fragment.osHandleStorage);
+        userptrCache->release(rootDeviceIndex, reinterpret_cast<uintptr_t>(fragment.cpuPtr), fragment.fragmentSize, osHandle->bo, bosToDestroy);
+        osHandle->bo = nullptr;
+        fragment.freeTheFragment = true;
+    }
+    destroyUserptrBufferObjects(bosToDestroy);
+}
+
+void DrmMemoryManager::destroyUserptrBufferObjects(std::vector<BufferObject *> &bos) {
+    for (auto bo : bos) {
+        bo->wait(-1);
+        [[maybe_unused]] auto refCount = unreference(bo, true);
+        DEBUG_BREAK_IF(refCount != 1u);
+    }
+    bos.clear();
+}
+
+void DrmMemoryManager::invalidateHostPtrCache(const void *ptr, size_t size) {
+    if (!userptrCache) {
+        return;
+    }
+    std::vector<BufferObject *> bosToDestroy;
+    userptrCache->invalidateRange(reinterpret_cast<uintptr_t>(ptr), size, bosToDestroy);
+    destroyUserptrBufferObjects(bosToDestroy);
+}
+
+void DrmMemoryManager::releaseUserptrCache() {
+    if (!userptrCache) {
+        return;
+    }
+    std::vector<BufferObject *> bosToDestroy;
+    userptrCache->releaseAll(bosToDestroy);
+    destroyUserptrBufferObjects(bosToDestroy);
+
+    auto statistics = userptrCache->getStatistics();
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintUserptrBoCacheStatistics.get(), stdout, "Userptr BO cache hits: %llu, misses: %llu, evictions: %llu, invalidations: %llu\n",
+                       static_cast<unsigned long long>(statistics.hits), static_cast<unsigned long long>(statistics.misses),
+                       static_cast<unsigned long long>(statistics.evictions), static_cast<unsigned long long>(statistics.invalidations));
+    userptrCache.reset();
+}
+
 void DrmMemoryManager::cleanOsHandles(OsHandleStorage &handleStorage, uint32_t rootDeviceIndex) {
     for (unsigned int i = 0; i < maxFragmentsCount; i++) {
         if (handleStorage.fragmentStorageData[i].freeTheFragment) {
             auto osHandle = static_cast<OsHandleLinux *>(handleStorage.fragmentStorageData[i].osHandleStorage);
             if (osHandle->bo) {
                 BufferObject *search = osHandle->bo;
-                search->wait(-1);
-                [[maybe_unused]] auto refCount = unreference(search, true);
-                DEBUG_BREAK_IF(refCount != 1u);
+                if (userptrCache) {
+                    std::vector<BufferObject *> bosToDestroy;
+                    userptrCache->release(rootDeviceIndex, reinterpret_cast<uintptr_t>(handleStorage.fragmentStorageData[i].cpuPtr),
+                                          handleStorage.fragmentStorageData[i].fragmentSize, search, bosToDestroy);
+                    destroyUserptrBufferObjects(bosToDestroy);
+                } else {
+                    search->wait(-1);
+                    [[maybe_unused]] auto refCount = unreference(search, true);
+                    DEBUG_BREAK_IF(refCount != 1u);
+                }
             }
             delete handleStorage.fragmentStorageData[i].osHandleStorage;
             handleStorage.fragmentStorageData[i].osHandleStorage = nullptr;
@@ -1282,6 +1521,10 @@ void *DrmMemoryManager::lockResourceImpl(GraphicsAllocation &graphicsAllocation)
     auto bo = static_cast<DrmAllocation &>(graphicsAllocation).getBO();
 
     if (graphicsAllocation.getAllocationType() == AllocationType::WRITE_COMBINED) {
+        if (acquirePersistentMapping(bo)) {
+            // unaligned prefix was already unmapped when this mapping was created
+            return bo->peekLockedAddress();
+        }
         auto addr = lockBufferObject(bo);
         auto alignedAddr = alignUp(addr, MemoryConstants::pageSize64k);
         auto notUsedSize = ptrDiff(alignedAddr, addr);
@@ -1296,7 +1539,89 @@ void *DrmMemoryManager::lockResourceImpl(GraphicsAllocation &graphicsAllocation)
 }
 
 void DrmMemoryManager::unlockResourceImpl(GraphicsAllocation &graphicsAllocation) {
-    return unlockBufferObject(static_cast<DrmAllocation &>(graphicsAllocation).getBO());
+    auto bo = static_cast<DrmAllocation &>(graphicsAllocation).getBO();
+    if (storePersistentMapping(graphicsAllocation, bo)) {
+        return;
+    }
+    return unlockBufferObject(bo);
+}
+
+bool DrmMemoryManager::storePersistentMapping(GraphicsAllocation &graphicsAllocation, BufferObject *bo) {
+    if (persistentMappingsBudget == 0 || bo == nullptr || bo->peekLockedAddress() == nullptr ||
+        !graphicsAllocation.isAllocatedInLocalMemoryPool() || bo->peekSize() > persistentMappingsBudget) {
+        return false;
+    }
+
+    // evicted BOs are detached from their mapping under the lock, so a concurrent
+    // lockBufferObject creates a new mapping instead of reusing the one being unmapped
+    struct EvictedMapping {
+        void *address;
+        size_t size;
+        uint32_t rootDeviceIndex;
+    };
+    std::vector<EvictedMapping> mappingsToUnmap;
+    {
+        std::lock_guard<std::mutex> lock(persistentMappingsMtx);
+        if (persistentMappingPositions.find(bo) != persistentMappingPositions.end()) {
+            return true;
+        }
+        persistentMappings.push_front(bo);
+        persistentMappingPositions[bo] = persistentMappings.begin();
+        persistentMappingsSize += bo->peekSize();
+
+        while (persistentMappingsSize > persistentMappingsBudget) {
+            auto boToUnmap = persistentMappings.back();
+            persistentMappings.pop_back();
+            persistentMappingPositions.erase(boToUnmap);
+            persistentMappingsSize -= boToUnmap->peekSize();
+            mappingsToUnmap.push_back({boToUnmap->peekLockedAddress(), boToUnmap->peekSize(), this->getRootDeviceIndex(boToUnmap->peekDrm())});
+            boToUnmap->setLockedAddress(nullptr);
+        }
+    }
+
+    for (auto &mapping : mappingsToUnmap) {
+        releaseReservedCpuAddressRange(mapping.address, mapping.size, mapping.rootDeviceIndex);
+        [[maybe_unused]] auto ret = munmapFunction(mapping.address, mapping.size);
+        DEBUG_BREAK_IF(ret != 0);
+    }
+    return true;
+}
+
+bool DrmMemoryManager::acquirePersistentMapping(BufferObject *bo) {
+    if (persistentMappingsBudget == 0 || bo == nullptr) {
+        return false;
+    }
+
+    // mapping in use is not accounted in budget and can't be evicted until it is unlocked again
+    std::lock_guard<std::mutex> lock(persistentMappingsMtx);
+    auto it = persistentMappingPositions.find(bo);
+    if (it == persistentMappingPositions.end()) {
+        return false;
+    }
+    persistentMappings.erase(it->second);
+    persistentMappingPositions.erase(it);
+    persistentMappingsSize -= bo->peekSize();
+    return true;
+}
+
+void DrmMemoryManager::releasePersistentMapping(BufferObject *bo) {
+    if (acquirePersistentMapping(bo)) {
+        unlockBufferObject(bo);
+    }
+}
+
+void DrmMemoryManager::releaseAllPersistentMappings() {
+    std::list<BufferObject *> bosToUnmap;
+    {
+        std::lock_guard<std::mutex> lock(persistentMappingsMtx);
+        bosToUnmap.swap(persistentMappings);
+        persistentMappingPositions.clear();
+        persistentMappingsSize = 0;
+    }
+
+    for (auto bo : bosToUnmap) {
+        unlockBufferObject(bo);
+    }
 }
 
 int DrmMemoryManager::obtainFdFromHandle(int boHandle, uint32_t rootDeviceIndex) {
@@ -1365,16 +1690,41 @@ void DrmMemoryManager::freeGpuAddress(AddressRange addressRange, uint32_t rootDe
     releaseGpuRange(reinterpret_cast<void *>(addressRange.address), addressRange.size, rootDeviceIndex);
 }
 
-std::unique_lock<std::mutex> DrmMemoryManager::acquireAllocLock() {
-    return std::unique_lock<std::mutex>(this->allocMutex);
+void DrmMemoryManager::RegisteredAllocations::add(GraphicsAllocation *allocation) {
+    positions[allocation] = allocations.size();
+    allocations.push_back(allocation);
+}
+
+void DrmMemoryManager::RegisteredAllocations::remove(GraphicsAllocation *allocation) {
+    auto position = positions.find(allocation);
+    if (position == positions.end()) {
+        return;
+    }
+
+    auto index = position->second;
+    positions.erase(position);
+
+    if (index != allocations.size() - 1) {
+        allocations[index] = allocations.back();
+        positions[allocations[index]] = index;
+    }
+    allocations.pop_back();
+}
+
+DrmMemoryManager::AllocLock DrmMemoryManager::acquireAllocLock(uint32_t rootDeviceIndex) {
+    // always locked in this order, registration paths take a single lock at a time
+    AllocLock allocLock;
+    allocLock.sysMemLock = std::unique_lock<std::mutex>(this->sysMemAllocs.mtx);
+    allocLock.localMemLock = std::unique_lock<std::mutex>(this->localMemAllocs[rootDeviceIndex]->mtx);
+    return allocLock;
 }
 
 std::vector<GraphicsAllocation *> &DrmMemoryManager::getSysMemAllocs() {
-    return this->sysMemAllocs;
+    return this->sysMemAllocs.allocations;
 }
 
 std::vector<GraphicsAllocation *> &DrmMemoryManager::getLocalMemAllocs(uint32_t rootDeviceIndex) {
-    return this->localMemAllocs[rootDeviceIndex];
+    return this->localMemAllocs[rootDeviceIndex]->allocations;
 }
 
 bool DrmMemoryManager::makeAllocationResident(GraphicsAllocation *allocation) {
@@ -1395,8 +1745,8 @@ AllocationStatus DrmMemoryManager::registerSysMemAlloc(GraphicsAllocation *alloc
     if (!makeAllocationResident(allocation)) {
         return AllocationStatus::Error;
     }
-    std::lock_guard<std::mutex> lock(this->allocMutex);
-    this->sysMemAllocs.push_back(allocation);
+    std::lock_guard<std::mutex> lock(this->sysMemAllocs.mtx);
+    this->sysMemAllocs.add(allocation);
     return AllocationStatus::Success;
 }
 
@@ -1404,19 +1754,19 @@ AllocationStatus DrmMemoryManager::registerLocalMemAlloc(GraphicsAllocation *all
     if (!makeAllocationResident(allocation)) {
         return AllocationStatus::Error;
     }
-    std::lock_guard<std::mutex> lock(this->allocMutex);
-    this->localMemAllocs[rootDeviceIndex].push_back(allocation);
+    std::lock_guard<std::mutex> lock(this->localMemAllocs[rootDeviceIndex]->mtx);
+    this->localMemAllocs[rootDeviceIndex]->add(allocation);
     return AllocationStatus::Success;
 }
 
 void DrmMemoryManager::unregisterAllocation(GraphicsAllocation *allocation) {
-    std::lock_guard<std::mutex> lock(this->allocMutex);
-    sysMemAllocs.erase(std::remove(sysMemAllocs.begin(), sysMemAllocs.end(), allocation),
-                       sysMemAllocs.end());
-    localMemAllocs[allocation->getRootDeviceIndex()].erase(std::remove(localMemAllocs[allocation->getRootDeviceIndex()].begin(),
-                                                                       localMemAllocs[allocation->getRootDeviceIndex()].end(),
-                                                                       allocation),
-                                                           localMemAllocs[allocation->getRootDeviceIndex()].end());
+    {
+        std::lock_guard<std::mutex> lock(this->sysMemAllocs.mtx);
+        sysMemAllocs.remove(allocation);
+    }
+    auto &localAllocs = *localMemAllocs[allocation->getRootDeviceIndex()];
+    std::lock_guard<std::mutex> lock(localAllocs.mtx);
+    localAllocs.remove(allocation);
 }
 
 void DrmMemoryManager::registerAllocationInOs(GraphicsAllocation *allocation) {
@@ -1480,12 +1830,15 @@ bool DrmMemoryManager::copyMemoryToAllocationBanks(GraphicsAllocation *graphicsA
         if (!handleMask.test(handleId)) {
             continue;
         }
-        auto ptr = lockBufferObject(drmAllocation->getBOs()[handleId]);
+        auto bo = drmAllocation->getBOs()[handleId];
+        auto ptr = lockBufferObject(bo);
         if (!ptr) {
             return false;
         }
         memcpy_s(ptrOffset(ptr, destinationOffset), graphicsAllocation->getUnderlyingBufferSize() - destinationOffset, memoryToCopy, sizeToCopy);
-        this->unlockBufferObject(drmAllocation->getBOs()[handleId]);
+        if (!storePersistentMapping(*graphicsAllocation, bo)) {
+            this->unlockBufferObject(bo);
+        }
     }
     return true;
 }
@@ -1855,6 +2208,32 @@ bool DrmMemoryManager::createDrmChunkedAllocation(Drm *drm, DrmAllocation *alloc
     return true;
 }
 
+namespace {
+struct BoCreationArgs {
+    Gmm *gmm;
+    uint64_t boAddress;
+    size_t boSize;
+    uint32_t memoryBanks;
+    uint32_t boIndex;
+    BufferObject *bo;
+};
+} // namespace
+
+bool DrmMemoryManager::isParallelBoCreationAllowed(DrmAllocation *allocation, uint32_t handles) const {
+    auto thresholdInMb = DebugManager.flags.ParallelBoCreationThresholdInMb.get();
+    if (thresholdInMb < 0 || handles < 2) {
+        return false;
+    }
+
+    // paired handles need the handle of the previous buffer object at creation
+    auto &drm = getDrm(allocation->getRootDeviceIndex());
+    if (AllocationType::BUFFER == allocation->getAllocationType() && handles == 2 && drm.getSetPairAvailable()) {
+        return false;
+    }
+
+    return allocation->getUnderlyingBufferSize() >= static_cast<size_t>(thresholdInMb) * MemoryConstants::megaByte;
+}
+
 bool DrmMemoryManager::createDrmAllocation(Drm *drm, DrmAllocation *allocation, uint64_t gpuAddress, size_t maxOsContextCount) {
     BufferObjects bos{};
     auto &storageInfo = allocation->storageInfo;
@@ -1896,6 +2275,11 @@ bool DrmMemoryManager::createDrmAllocation(Drm *drm, DrmAllocation *allocation,
         return createDrmChunkedAllocation(drm, allocation, gpuAddress, boTotalChunkSize, maxOsContextCount);
     }
 
+    // handles are independent when not paired, their creation is split across worker threads;
+    // the allocation is still returned only once all of its buffer objects exist
+    const bool parallelCreation = isParallelBoCreationAllowed(allocation, handles);
+    std::vector<BoCreationArgs> creationArgs;
+
     for (auto handleId = 0u; handleId < handles; handleId++, currentBank++) {
         if (currentBank == banksCnt) {
             currentBank = 0;
@@ -1914,6 +2298,13 @@ bool DrmMemoryManager::createDrmAllocation(Drm *drm, DrmAllocation *allocation,
         }
         auto gmm = allocation->getGmm(handleId);
         auto boSize = alignUp(gmm->gmmResourceInfo->getSizeAllocation(), MemoryConstants::pageSize64k);
+        if (parallelCreation) {
+            creationArgs.push_back({gmm, boAddress, boSize, memoryBanks, currentBank + iterationOffset, nullptr});
+            if (storageInfo.multiStorage) {
+                boAddress += boSize;
+            }
+            continue;
+        }
         bos[handleId] = createBufferObjectInMemoryRegion(allocation->getRootDeviceIndex(), gmm, allocation->getAllocationType(), boAddress, boSize, memoryBanks, maxOsContextCount, pairHandle);
         if (nullptr == bos[handleId]) {
             return false;
@@ -1930,6 +2321,30 @@ bool DrmMemoryManager::createDrmAllocation(Drm *drm, DrmAllocation *allocation,
         }
     }
 
+    if (parallelCreation) {
+        getWorkerPool()->parallelFor(handles, [&](size_t handleId) {
+            auto &args = creationArgs[handleId];
+            args.bo = createBufferObjectInMemoryRegion(allocation->getRootDeviceIndex(), args.gmm, allocation->getAllocationType(),
+                                                       args.boAddress, args.boSize, args.memoryBanks, maxOsContextCount, -1);
+        });
+
+        bool success = std::all_of(creationArgs.begin(), creationArgs.end(), [](const BoCreationArgs &args) { return args.bo != nullptr; });
+        for (auto &args : creationArgs) {
+            if (!success && args.bo) {
+                // the allocation is dropped by the caller, buffer objects created by other workers are released here
+                unreference(args.bo, true);
+                args.bo = nullptr;
+            }
+            allocation->getBufferObjectToModify(args.boIndex) = args.bo;
+        }
+        if (!success) {
+            return false;
+        }
+        for (auto handleId = 0u; handleId < handles; handleId++) {
+            bos[handleId] = creationArgs[handleId].bo;
+        }
+    }
+
     if (storageInfo.colouringPolicy == ColouringPolicy::MappingBased) {
         auto size = alignUp(allocation->getUnderlyingBufferSize(), storageInfo.colouringGranularity);
         auto chunks = static_cast<uint32_t>(size / storageInfo.colouringGranularity);
@@ -2024,7 +2439,8 @@ void DrmMemoryManager::waitOnCompletionFence(GraphicsAllocation *allocation) {
 
 DrmAllocation *DrmMemoryManager::createAllocWithAlignment(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSize, uint64_t gpuAddress) {
     auto &drm = this->getDrm(allocationData.rootDeviceIndex);
-    bool useBooMmap = drm.getMemoryInfo() && allocationData.useMmapObject;
+    // pages of mmaped objects are allocated by the kernel driver and do not follow a memory policy, placed memory uses userptr
+    bool useBooMmap = drm.getMemoryInfo() && allocationData.useMmapObject && getPreferredNumaNode(allocationData) < 0;
 
     if (DebugManager.flags.EnableBOMmapCreate.get() != -1) {
         useBooMmap = DebugManager.flags.EnableBOMmapCreate.get();
@@ -2110,14 +2526,24 @@ void *DrmMemoryManager::lockBufferObject(BufferObject *bo) {
         return nullptr;
     }
 
+    if (acquirePersistentMapping(bo)) {
+        return bo->peekLockedAddress();
+    }
+
     auto drm = bo->peekDrm();
     auto rootDeviceIndex = this->getRootDeviceIndex(drm);
 
     auto ioctlHelper = drm->getIoctlHelper();
     uint64_t mmapOffsetWc = ioctlHelper->getDrmParamValue(DrmParam::MmapOffsetWc);
-    uint64_t offset = 0;
-    if (!retrieveMmapOffsetForBufferObject(rootDeviceIndex, *bo, mmapOffsetWc, offset)) {
-        return nullptr;
+    uint64_t offset = bo->peekLockMmapOffset();
+    if (offset == 0u) {
+        if (!retrieveMmapOffsetForBufferObject(rootDeviceIndex, *bo, mmapOffsetWc, offset)) {
+            return nullptr;
+        }
+        if (persistentMappingsBudget > 0) {
+            // fake offset stays valid for the whole BO lifetime
+            bo->setLockMmapOffset(offset);
+        }
     }
 
     auto addr = mmapFunction(nullptr, bo->peekSize(), PROT_WRITE | PROT_READ, MAP_SHARED, drm->getFileDescriptor(), static_cast<off_t>(offset));
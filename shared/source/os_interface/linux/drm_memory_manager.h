@@ -8,9 +8,13 @@
 #pragma once
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
+#include "shared/source/os_interface/linux/drm_userptr_cache.h"
 
+#include <atomic>
 #include <limits>
+#include <list>
 #include <map>
+#include <unordered_map>
 #include <sys/mman.h>
 #include <unistd.h>
 
@@ -52,6 +56,7 @@ class DrmMemoryManager : public MemoryManager {
     AllocationStatus populateOsHandles(OsHandleStorage &handleStorage, uint32_t rootDeviceIndex) override;
     void cleanOsHandles(OsHandleStorage &handleStorage, uint32_t rootDeviceIndex) override;
     void commonCleanup() override;
+    void invalidateHostPtrCache(const void *ptr, size_t size) override;
 
     // drm/i915 ioctl wrappers
     MOCKABLE_VIRTUAL uint32_t unreference(BufferObject *bo, bool synchronousDestroy);
@@ -61,6 +66,14 @@ class DrmMemoryManager : public MemoryManager {
     bool isValidateHostMemoryEnabled() const {
         return validateHostPtrMemory;
     }
+    DrmUserptrCache *peekUserptrCache() const { return userptrCache.get(); }
+
+    struct NumaPlacementStatistics {
+        uint64_t placedOnDeviceNode = 0;
+        uint64_t placedOnRequestedNode = 0;
+        uint64_t failed = 0;
+    };
+    NumaPlacementStatistics getNumaPlacementStatistics() const;
 
     DrmGemCloseWorker *peekGemCloseWorker() const { return this->gemCloseWorker.get(); }
     bool copyMemoryToAllocation(GraphicsAllocation *graphicsAllocation, size_t destinationOffset, const void *memoryToCopy, size_t sizeToCopy) override;
@@ -78,7 +91,11 @@ class DrmMemoryManager : public MemoryManager {
     bool setMemAdvise(GraphicsAllocation *gfxAllocation, MemAdviseFlags flags, uint32_t rootDeviceIndex) override;
     bool setMemPrefetch(GraphicsAllocation *gfxAllocation, SubDeviceIdsVec &subDeviceIds, uint32_t rootDeviceIndex) override;
 
-    [[nodiscard]] std::unique_lock<std::mutex> acquireAllocLock();
+    struct AllocLock {
+        std::unique_lock<std::mutex> sysMemLock;
+        std::unique_lock<std::mutex> localMemLock;
+    };
+    [[nodiscard]] AllocLock acquireAllocLock(uint32_t rootDeviceIndex);
     std::vector<GraphicsAllocation *> &getSysMemAllocs();
     std::vector<GraphicsAllocation *> &getLocalMemAllocs(uint32_t rootDeviceIndex);
     AllocationStatus registerSysMemAlloc(GraphicsAllocation *allocation) override;
@@ -101,6 +118,9 @@ class DrmMemoryManager : public MemoryManager {
     void eraseSharedBufferObject(BufferObject *bo);
     void pushSharedBufferObject(BufferObject *bo);
     BufferObject *allocUserptr(uintptr_t address, size_t size, uint32_t rootDeviceIndex);
+    void returnUserptrsToCache(OsHandleStorage &handleStorage, const uint32_t *fragmentIndexes, uint32_t numFragments, uint32_t rootDeviceIndex);
+    void destroyUserptrBufferObjects(std::vector<BufferObject *> &bos);
+    void releaseUserptrCache();
     bool setDomainCpu(GraphicsAllocation &graphicsAllocation, bool writeEnable);
     uint64_t acquireGpuRange(size_t &size, uint32_t rootDeviceIndex, HeapIndex heapIndex);
     uint64_t acquireGpuRangeWithCustomAlignment(size_t &size, uint32_t rootDeviceIndex, HeapIndex heapIndex, size_t alignment);
@@ -109,6 +129,11 @@ class DrmMemoryManager : public MemoryManager {
     uint32_t getDefaultDrmContextId(uint32_t rootDeviceIndex) const;
     OsContextLinux *getDefaultOsContext(uint32_t rootDeviceIndex) const;
     size_t getUserptrAlignment();
+    int getPreferredNumaNode(const AllocationData &allocationData) const;
+    void applyNumaPlacement(const AllocationData &allocationData, void *ptr, size_t size);
+    void *allocateHugeTlbMemory(size_t size, size_t alignment, size_t &mappedSize);
+    void *allocateNumaPlacedMemory(size_t size, size_t alignment, size_t &mappedSize);
+    void adviseHugePages(void *ptr, size_t size);
 
     GraphicsAllocation *createGraphicsAllocation(OsHandleStorage &handleStorage, const AllocationData &allocationData) override;
     GraphicsAllocation *allocateGraphicsMemoryForNonSvmHostPtr(const AllocationData &allocationData) override;
@@ -133,12 +158,17 @@ class DrmMemoryManager : public MemoryManager {
     void *lockResourceImpl(GraphicsAllocation &graphicsAllocation) override;
     MOCKABLE_VIRTUAL void *lockBufferObject(BufferObject *bo);
     MOCKABLE_VIRTUAL void unlockBufferObject(BufferObject *bo);
+    bool storePersistentMapping(GraphicsAllocation &graphicsAllocation, BufferObject *bo);
+    bool acquirePersistentMapping(BufferObject *bo);
+    void releasePersistentMapping(BufferObject *bo);
+    void releaseAllPersistentMappings();
     void unlockResourceImpl(GraphicsAllocation &graphicsAllocation) override;
     GraphicsAllocation *allocate32BitGraphicsMemoryImpl(const AllocationData &allocationData, bool useLocalMemory) override;
     void cleanupBeforeReturn(const AllocationData &allocationData, GfxPartition *gfxPartition, DrmAllocation *drmAllocation, GraphicsAllocation *graphicsAllocation, uint64_t &gpuAddress, size_t &sizeAllocated);
     GraphicsAllocation *allocateGraphicsMemoryInDevicePool(const AllocationData &allocationData, AllocationStatus &status) override;
     bool createDrmChunkedAllocation(Drm *drm, DrmAllocation *allocation, uint64_t boAddress, size_t boSize, size_t maxOsContextCount);
     bool createDrmAllocation(Drm *drm, DrmAllocation *allocation, uint64_t gpuAddress, size_t maxOsContextCount);
+    bool isParallelBoCreationAllowed(DrmAllocation *allocation, uint32_t handles) const;
     void registerAllocationInOs(GraphicsAllocation *allocation) override;
     void waitOnCompletionFence(GraphicsAllocation *allocation);
     bool allocationTypeForCompletionFence(AllocationType allocationType);
@@ -158,16 +188,41 @@ class DrmMemoryManager : public MemoryManager {
     bool forcePinEnabled = false;
     const bool validateHostPtrMemory;
     std::unique_ptr<DrmGemCloseWorker> gemCloseWorker;
+    std::unique_ptr<DrmUserptrCache> userptrCache;
+
+    // NUMA node of each root device PCI root, -1 when unknown or placement is disabled
+    std::vector<int> deviceNumaNodes;
+    std::atomic<uint64_t> numaPlacedOnDeviceNode{0};
+    std::atomic<uint64_t> numaPlacedOnRequestedNode{0};
+    std::atomic<uint64_t> numaPlacementFailed{0};
+
+    // CPU mappings of unlocked local memory BOs are kept for next lock, least recently unlocked are unmapped first
+    std::list<BufferObject *> persistentMappings;
+    std::unordered_map<BufferObject *, std::list<BufferObject *>::iterator> persistentMappingPositions;
+    size_t persistentMappingsSize = 0;
+    size_t persistentMappingsBudget = 0;
+    std::mutex persistentMappingsMtx;
     decltype(&mmap) mmapFunction = mmap;
     decltype(&munmap) munmapFunction = munmap;
+    decltype(&madvise) madviseFunction = madvise;
     decltype(&lseek) lseekFunction = lseek;
     decltype(&close) closeFunction = close;
     std::vector<BufferObject *> sharingBufferObjects;
     std::mutex mtx;
 
     std::map<int, BufferObjectHandleWrapper> sharedBoHandles;
-    std::vector<std::vector<GraphicsAllocation *>> localMemAllocs;
-    std::vector<GraphicsAllocation *> sysMemAllocs;
-    std::mutex allocMutex;
+
+    // each registry has its own lock so that allocations on different root devices do not contend,
+    // removal swaps with the last element to avoid scanning the whole list
+    struct RegisteredAllocations {
+        void add(GraphicsAllocation *allocation);
+        void remove(GraphicsAllocation *allocation);
+
+        std::vector<GraphicsAllocation *> allocations;
+        std::unordered_map<GraphicsAllocation *, size_t> positions;
+        std::mutex mtx;
+    };
+    std::vector<std::unique_ptr<RegisteredAllocations>> localMemAllocs;
+    RegisteredAllocations sysMemAllocs;
 };
 } // namespace NEO
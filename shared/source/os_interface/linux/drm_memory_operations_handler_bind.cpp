@@ -17,6 +17,7 @@
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
+#include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/os_context.h"
 
 namespace NEO {
@@ -43,6 +44,8 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsConte
     auto deviceBitfield = osContext->getDeviceBitfield();
 
     std::lock_guard<std::mutex> lock(mutex);
+    auto batchBinds = isVmBindBatchingEnabled();
+    std::vector<BufferObject *> bufferObjectsToBind;
     auto devicesDone = 0u;
     for (auto drmIterator = 0u; devicesDone < deviceBitfield.count(); drmIterator++) {
         if (!deviceBitfield.test(drmIterator)) {
@@ -59,16 +62,34 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsConte
             }
 
             if (!bo->bindInfo[bo->getOsContextId(osContext)][drmIterator]) {
-                int result = drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, true);
+                // residency of host pointer fragments is tracked per fragment and set by the bind itself, so they are not batched
+                bool batchAllocation = batchBinds && !drmAllocation->fragmentsStorage.fragmentCount;
+                int result = drmAllocation->makeBOsResident(osContext, drmIterator, batchAllocation ? &bufferObjectsToBind : nullptr, true);
                 if (result) {
                     return MemoryOperationsStatus::OUT_OF_MEMORY;
                 }
             }
 
-            if (!evictable) {
+            if (!evictable && !batchBinds) {
                 drmAllocation->updateResidencyTaskCount(GraphicsAllocation::objectAlwaysResident, osContext->getContextId());
             }
         }
+
+        if (batchBinds) {
+            if (!bufferObjectsToBind.empty()) {
+                int result = bufferObjectsToBind[0]->peekDrm()->changeBufferObjectsBinding(osContext, drmIterator, bufferObjectsToBind, true);
+                if (result) {
+                    return MemoryOperationsStatus::OUT_OF_MEMORY;
+                }
+                bufferObjectsToBind.clear();
+            }
+
+            if (!evictable) {
+                for (auto gfxAllocation = gfxAllocations.begin(); gfxAllocation != gfxAllocations.end(); gfxAllocation++) {
+                    (*gfxAllocation)->updateResidencyTaskCount(GraphicsAllocation::objectAlwaysResident, osContext->getContextId());
+                }
+            }
+        }
     }
 
     return MemoryOperationsStatus::SUCCESS;
@@ -128,7 +149,7 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::mergeWithResidencyContain
     if (DebugManager.flags.MakeEachAllocationResident.get() == 2) {
         auto memoryManager = static_cast<DrmMemoryManager *>(this->rootDeviceEnvironment.executionEnvironment.memoryManager.get());
 
-        auto allocLock = memoryManager->acquireAllocLock();
+        auto allocLock = memoryManager->acquireAllocLock(this->rootDeviceIndex);
         this->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(memoryManager->getSysMemAllocs()), true);
         this->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(memoryManager->getLocalMemAllocs(this->rootDeviceIndex)), true);
     }
@@ -153,7 +174,7 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocations(bo
         evictLock.lock();
     }
 
-    auto allocLock = memoryManager->acquireAllocLock();
+    auto allocLock = memoryManager->acquireAllocLock(this->rootDeviceIndex);
 
     for (const auto status : {
              this->evictUnusedAllocationsImpl(memoryManager->getSysMemAllocs(), waitForCompletion),
@@ -205,12 +226,19 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImp
             }
         }
 
-        for (auto &allocationToEvict : evictCandidates) {
-            for (const auto &engine : engines) {
-                if (engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
-                    DeviceBitfield deviceBitfield;
-                    deviceBitfield.set(subdeviceIndex);
-                    this->evictImpl(engine.osContext, *allocationToEvict, deviceBitfield);
+        if (isVmBindBatchingEnabled()) {
+            if (this->evictBatched(engines, evictCandidates, subdeviceIndex)) {
+                evictCandidates.clear();
+                return MemoryOperationsStatus::FAILED;
+            }
+        } else {
+            for (auto &allocationToEvict : evictCandidates) {
+                for (const auto &engine : engines) {
+                    if (engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
+                        DeviceBitfield deviceBitfield;
+                        deviceBitfield.set(subdeviceIndex);
+                        this->evictImpl(engine.osContext, *allocationToEvict, deviceBitfield);
+                    }
                 }
             }
         }
@@ -220,4 +248,55 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImp
     return MemoryOperationsStatus::SUCCESS;
 }
 
+bool DrmMemoryOperationsHandlerBind::isVmBindBatchingEnabled() {
+    return DebugManager.flags.EnableVmBindBatching.get() == 1;
+}
+
+int DrmMemoryOperationsHandlerBind::evictBatched(const EngineControlContainer &engines, std::vector<GraphicsAllocation *> &allocationsToEvict, uint32_t subdeviceIndex) {
+    DeviceBitfield deviceBitfield;
+    deviceBitfield.set(subdeviceIndex);
+
+    int retVal = 0;
+    std::vector<BufferObject *> bufferObjectsToUnbind;
+    std::vector<std::pair<DrmAllocation *, std::vector<BufferObject *>>> allocationsToUnbind;
+    for (const auto &engine : engines) {
+        if (!engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
+            continue;
+        }
+
+        for (auto &allocationToEvict : allocationsToEvict) {
+            auto drmAllocation = static_cast<DrmAllocation *>(allocationToEvict);
+            // residency of host pointer fragments is tracked per fragment
+            if (drmAllocation->fragmentsStorage.fragmentCount) {
+                int result = this->evictImpl(engine.osContext, *drmAllocation, deviceBitfield);
+                retVal = retVal ? retVal : result;
+                continue;
+            }
+            std::vector<BufferObject *> allocationBufferObjects;
+            drmAllocation->bindBOs(engine.osContext, subdeviceIndex, &allocationBufferObjects, false);
+            bufferObjectsToUnbind.insert(bufferObjectsToUnbind.end(), allocationBufferObjects.begin(), allocationBufferObjects.end());
+            allocationsToUnbind.push_back({drmAllocation, std::move(allocationBufferObjects)});
+        }
+
+        if (!bufferObjectsToUnbind.empty()) {
+            int result = bufferObjectsToUnbind[0]->peekDrm()->changeBufferObjectsBinding(engine.osContext, subdeviceIndex, bufferObjectsToUnbind, false);
+            retVal = retVal ? retVal : result;
+        }
+
+        // an allocation stops being resident only once all of its BOs are unbound, which a failed batch may leave undone
+        for (auto &allocationToUnbind : allocationsToUnbind) {
+            bool unbound = true;
+            for (auto bo : allocationToUnbind.second) {
+                unbound &= !bo->bindInfo[bo->getOsContextId(engine.osContext)][subdeviceIndex];
+            }
+            if (unbound) {
+                allocationToUnbind.first->updateResidencyTaskCount(GraphicsAllocation::objectNotResident, engine.osContext->getContextId());
+            }
+        }
+        bufferObjectsToUnbind.clear();
+        allocationsToUnbind.clear();
+    }
+    return retVal;
+}
+
 } // namespace NEO
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "shared/source/helpers/common_types.h"
 #include "shared/source/helpers/device_bitfield.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 
@@ -30,6 +31,8 @@ class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
   protected:
     MOCKABLE_VIRTUAL int evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield);
     MemoryOperationsStatus evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion);
+    int evictBatched(const EngineControlContainer &engines, std::vector<GraphicsAllocation *> &allocationsToEvict, uint32_t subdeviceIndex);
+    static bool isVmBindBatchingEnabled();
     const RootDeviceEnvironment &rootDeviceEnvironment;
 };
 } // namespace NEO
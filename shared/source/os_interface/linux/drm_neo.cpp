@@ -20,6 +20,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/neo_driver_version.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/driver_info.h"
 #include "shared/source/os_interface/linux/cache_info.h"
@@ -28,6 +29,7 @@
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler_bind.h"
+#include "shared/source/os_interface/linux/drm_query_cache.h"
 #include "shared/source/os_interface/linux/drm_wrappers.h"
 #include "shared/source/os_interface/linux/engine_info.h"
 #include "shared/source/os_interface/linux/hw_device_id.h"
@@ -44,7 +46,9 @@
 #include "shared/source/utilities/api_intercept.h"
 #include "shared/source/utilities/directory.h"
 
+#include <algorithm>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <fcntl.h>
 #include <fstream>
@@ -201,6 +205,24 @@ std::string Drm::getSysFsPciPath() {
     return {};
 }
 
+int Drm::getNumaNode() {
+    const std::string fileName = std::string(Os::sysFsPciPathPrefix) + hwDeviceId->getPciPath() + "/numa_node";
+    int fd = SysCalls::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+
+    char numaNode[16] = {};
+    ssize_t bytesRead = SysCalls::pread(fd, numaNode, sizeof(numaNode) - 1, 0);
+    NEO::SysCalls::close(fd);
+    if (bytesRead <= 0) {
+        return -1;
+    }
+
+    // -1 is reported when platform has no NUMA affinity for the device
+    return std::atoi(numaNode);
+}
+
 bool Drm::readSysFsAsString(const std::string &relativeFilePath, std::string &readString) {
 
     auto devicePath = getSysFsPciPath();
@@ -443,6 +465,7 @@ int Drm::setupHardwareInfo(const DeviceDescriptor *device, bool setupFeatureTabl
     setupIoctlHelper(productFamily);
     ioctlHelper->setupIpVersion();
     rootDeviceEnvironment.initReleaseHelper();
+    initQueryCache();
 
     Drm::QueryTopologyData topologyData = {};
 
@@ -488,9 +511,90 @@ int Drm::setupHardwareInfo(const DeviceDescriptor *device, bool setupFeatureTabl
 
     setupCacheInfo(*hwInfo);
 
+    if (queryCache && queryCache->isDirty()) {
+        queryCache->save();
+    }
+
     return 0;
 }
 
+void Drm::initQueryCache() {
+    auto cacheDir = DebugManager.flags.DeviceQueryCacheDir.get();
+    if (cacheDir == "unk") {
+        return;
+    }
+
+    // results of capability queries depend on the device, the KMD and on how this driver build issues them
+    std::string kernelRelease;
+    std::ifstream ifs("/proc/sys/kernel/osrelease", std::ifstream::in);
+    if (!ifs.fail()) {
+        ifs >> kernelRelease;
+    }
+    std::string prelimVersion;
+    getPrelimVersion(prelimVersion);
+
+    auto drmVersion = getDrmVersion(getFileDescriptor());
+
+    // firmware can be updated without any change to the KMD, don't cache when it cannot be identified
+    auto firmwareIdentity = getFirmwareIdentity(drmVersion);
+    if (firmwareIdentity.empty()) {
+        return;
+    }
+
+    auto hwInfo = rootDeviceEnvironment.getHardwareInfo();
+    std::stringstream key;
+    key << getPciPath() << "|" << hwInfo->platform.usDeviceID << "|" << hwInfo->platform.usRevId << "|"
+        << drmVersion << "|" << kernelRelease << "|" << prelimVersion << "|" << driverVersion << "|" << firmwareIdentity;
+
+    queryCache = std::make_unique<DrmQueryCache>(cacheDir, key.str());
+    queryCache->load();
+}
+
+std::string Drm::getFirmwareIdentity(const std::string &drmVersion) {
+    auto sysFsPciPath = getSysFsPciPath();
+    auto cardPos = sysFsPciPath.rfind("card");
+    if (cardPos != std::string::npos) {
+        auto debugFsPath = std::string(Os::debugFsDriPathPrefix) + sysFsPciPath.substr(cardPos + strlen("card"));
+        for (auto gucInfoPath : {"/gt0/uc/guc_info", "/gt/uc/guc_info"}) {
+            std::ifstream gucInfo(debugFsPath + gucInfoPath, std::ifstream::in);
+            if (gucInfo.fail()) {
+                continue;
+            }
+            std::string firmwareIdentity;
+            std::string line;
+            while (std::getline(gucInfo, line)) {
+                if (line.find("GuC firmware") != std::string::npos || line.find("version") != std::string::npos) {
+                    firmwareIdentity += line;
+                }
+            }
+            if (!firmwareIdentity.empty()) {
+                return firmwareIdentity;
+            }
+        }
+    }
+
+    // debugfs is usually accessible only by root, fall back to the modification time of installed firmware blobs
+    auto firmwarePath = std::string(Os::firmwarePathPrefix) + drmVersion;
+    struct stat firmwareStat = {};
+    if (SysCalls::stat(firmwarePath, &firmwareStat) != 0) {
+        return {};
+    }
+    return firmwarePath + "@" + std::to_string(firmwareStat.st_mtime);
+}
+
+std::vector<uint8_t> Drm::queryWithCache(uint32_t queryId, uint32_t queryItemFlags) {
+    std::vector<uint8_t> data;
+    if (queryCache && queryCache->find(queryId, queryItemFlags, data)) {
+        return data;
+    }
+
+    data = query(queryId, queryItemFlags);
+    if (queryCache && !data.empty()) {
+        queryCache->store(queryId, queryItemFlags, data);
+    }
+    return data;
+}
+
 void appendHwDeviceId(std::vector<std::unique_ptr<HwDeviceId>> &hwDeviceIds, int fileDescriptor, const char *pciPath, const char *devNodePath) {
     if (fileDescriptor >= 0) {
         if (Drm::isDrmSupported(fileDescriptor)) {
@@ -998,7 +1102,7 @@ int Drm::waitUserFence(uint32_t ctxId, uint64_t address, uint64_t value, ValueWi
 
 bool Drm::querySystemInfo() {
     auto request = ioctlHelper->getDrmParamValue(DrmParam::QueryHwconfigTable);
-    auto deviceBlobQuery = this->query(request, 0);
+    auto deviceBlobQuery = this->queryWithCache(request, 0);
     if (deviceBlobQuery.empty()) {
         PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stdout, "%s", "INFO: System Info query failed!\n");
         return false;
@@ -1068,7 +1172,7 @@ bool Drm::queryTopology(const HardwareInfo &hwInfo, QueryTopologyData &topologyD
             uint32_t flags = classInstance->engineClass;
             flags |= (classInstance->engineInstance << 8);
 
-            auto dataQuery = this->query(request, flags);
+            auto dataQuery = this->queryWithCache(request, flags);
             if (dataQuery.empty()) {
                 success = false;
                 break;
@@ -1105,7 +1209,7 @@ bool Drm::queryTopology(const HardwareInfo &hwInfo, QueryTopologyData &topologyD
     // fallback to DRM_I915_QUERY_TOPOLOGY_INFO
 
     request = ioctlHelper->getDrmParamValue(DrmParam::QueryTopologyInfo);
-    auto dataQuery = this->query(request, 0);
+    auto dataQuery = this->queryWithCache(request, 0);
     if (dataQuery.empty()) {
         return false;
     }
@@ -1351,17 +1455,17 @@ uint64_t Drm::getPatIndex(Gmm *gmm, AllocationType allocationType, CacheRegion c
     return patIndex;
 }
 
-int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleId, BufferObject *bo, bool bind) {
-    auto vmId = drm->getVirtualMemoryAddressSpace(vmHandleId);
-    auto ioctlHelper = drm->getIoctlHelper();
-
-    uint64_t flags = 0u;
-
+uint32_t getVmIdForBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleId) {
     if (drm->isPerContextVMRequired()) {
         auto osContextLinux = static_cast<const OsContextLinux *>(osContext);
         UNRECOVERABLE_IF(osContextLinux->getDrmVmIds().size() <= vmHandleId);
-        vmId = osContextLinux->getDrmVmIds()[vmHandleId];
+        return osContextLinux->getDrmVmIds()[vmHandleId];
     }
+    return drm->getVirtualMemoryAddressSpace(vmHandleId);
+}
+
+std::unique_ptr<uint8_t[]> prepareBufferObjectBinding(Drm *drm, OsContext *osContext, BufferObject *bo, bool bind, uint64_t &flags) {
+    auto ioctlHelper = drm->getIoctlHelper();
 
     std::unique_ptr<uint8_t[]> extensions;
     if (bind) {
@@ -1378,6 +1482,15 @@ int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleI
         }
         flags |= ioctlHelper->getFlagsForVmBind(bindCapture, bindImmediate, bindMakeResident);
     }
+    return extensions;
+}
+
+int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleId, BufferObject *bo, bool bind) {
+    auto vmId = getVmIdForBinding(drm, osContext, vmHandleId);
+    auto ioctlHelper = drm->getIoctlHelper();
+
+    uint64_t flags = 0u;
+    auto extensions = prepareBufferObjectBinding(drm, osContext, bo, bind, flags);
 
     auto &bindAddresses = bo->getColourAddresses();
     auto bindIterations = bindAddresses.size();
@@ -1468,6 +1581,115 @@ int changeBufferObjectBinding(Drm *drm, OsContext *osContext, uint32_t vmHandleI
     return ret;
 }
 
+int changeBufferObjectsBindingBatched(Drm *drm, OsContext *osContext, uint32_t vmHandleId, const std::vector<BufferObject *> &bufferObjects, bool bind, bool &submitted) {
+    submitted = false;
+    auto vmId = getVmIdForBinding(drm, osContext, vmHandleId);
+    auto ioctlHelper = drm->getIoctlHelper();
+
+    size_t numOperations = 0;
+    for (auto bo : bufferObjects) {
+        numOperations += std::max(bo->getColourAddresses().size(), static_cast<size_t>(1u));
+    }
+
+    std::vector<VmBindParams> vmBinds(numOperations);
+    std::vector<std::unique_ptr<uint8_t[]>> extensions(bufferObjects.size());
+    auto vmBindExtSetPats = std::make_unique<VmBindExtSetPatT[]>(numOperations);
+    bool userFenceRequired = false;
+
+    size_t operationIndex = 0;
+    for (size_t bufferObjectIndex = 0; bufferObjectIndex < bufferObjects.size(); bufferObjectIndex++) {
+        auto bo = bufferObjects[bufferObjectIndex];
+        uint64_t flags = 0u;
+        extensions[bufferObjectIndex] = prepareBufferObjectBinding(drm, osContext, bo, bind, flags);
+        userFenceRequired |= !drm->hasPageFaultSupport() || bo->isExplicitResidencyRequired();
+
+        auto &bindAddresses = bo->getColourAddresses();
+        auto bindIterations = std::max(bindAddresses.size(), static_cast<size_t>(1u));
+        for (size_t i = 0; i < bindIterations; i++, operationIndex++) {
+            auto &vmBind = vmBinds[operationIndex];
+            vmBind.vmId = static_cast<uint32_t>(vmId);
+            vmBind.flags = flags;
+            vmBind.handle = bind ? bo->peekHandle() : 0u;
+            vmBind.length = bo->peekSize();
+            vmBind.offset = 0;
+            vmBind.start = bo->peekAddress();
+
+            if (bo->getColourWithBind()) {
+                vmBind.length = bo->getColourChunk();
+                vmBind.offset = bo->getColourChunk() * i;
+                vmBind.start = bindAddresses[i];
+            }
+
+            if (drm->isVmBindPatIndexProgrammingSupported()) {
+                UNRECOVERABLE_IF(bo->peekPatIndex() == CommonConstants::unsupportedPatIndex);
+                ioctlHelper->fillVmBindExtSetPat(vmBindExtSetPats[operationIndex], bo->peekPatIndex(), castToUint64(extensions[bufferObjectIndex].get()));
+                vmBind.extensions = castToUint64(vmBindExtSetPats[operationIndex]);
+            } else {
+                vmBind.extensions = castToUint64(extensions[bufferObjectIndex].get());
+            }
+        }
+    }
+
+    std::unique_lock<std::mutex> lock;
+
+    auto getNextFence = [&](uint64_t &address, uint64_t &value) {
+        if (drm->isPerContextVMRequired()) {
+            auto osContextLinux = static_cast<OsContextLinux *>(osContext);
+            address = castToUint64(osContextLinux->getFenceAddr(vmHandleId));
+            value = osContextLinux->getNextFenceVal(vmHandleId);
+        } else {
+            address = castToUint64(drm->getFenceAddr(vmHandleId));
+            value = drm->getNextFenceVal(vmHandleId);
+        }
+    };
+    auto incrementFence = [&]() {
+        if (drm->isPerContextVMRequired()) {
+            auto osContextLinux = static_cast<OsContextLinux *>(osContext);
+            osContextLinux->incFenceVal(vmHandleId);
+        } else {
+            drm->incFenceVal(vmHandleId);
+        }
+    };
+
+    // the user fence of a bind ioctl is signaled once all operations of its array are done, a single fence covers the whole batch
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    bool incrementFenceValue = false;
+    if (ioctlHelper->isWaitBeforeBindRequired(bind) && drm->useVMBindImmediate()) {
+        lock = drm->lockBindFenceMutex();
+
+        if (userFenceRequired) {
+            auto &lastVmBind = vmBinds.back();
+            uint64_t address = 0;
+            uint64_t value = 0;
+            getNextFence(address, value);
+
+            incrementFenceValue = true;
+            ioctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, address, value, lastVmBind.extensions);
+            lastVmBind.extensions = castToUint64(vmBindExtUserFence);
+        }
+    }
+
+    // the array is submitted as a whole, either all operations were submitted or none of them
+    size_t numOperationsDone = 0;
+    auto ret = ioctlHelper->vmBindBatch(vmBinds, bind, numOperationsDone);
+    submitted = (numOperationsDone == numOperations);
+    if (submitted) {
+        if (incrementFenceValue) {
+            incrementFence();
+        }
+        if (bind) {
+            for (auto bo : bufferObjects) {
+                drm->setNewResourceBoundToVM(bo, vmHandleId);
+            }
+        }
+    }
+
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintVmBindBatchingStatistics.get(), stdout,
+                       "%s batch: BOs: %zu, operations: %zu, ioctls: 1 (%zu without batching), result: %d\n",
+                       bind ? "VM_BIND" : "VM_UNBIND", bufferObjects.size(), numOperations, numOperations, ret);
+    return ret;
+}
+
 int Drm::bindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObject *bo) {
     auto ret = changeBufferObjectBinding(this, osContext, vmHandleId, bo, true);
     if (ret != 0) {
@@ -1481,6 +1703,44 @@ int Drm::unbindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObj
     return changeBufferObjectBinding(this, osContext, vmHandleId, bo, false);
 }
 
+int Drm::changeBufferObjectsBinding(OsContext *osContext, uint32_t vmHandleId, const std::vector<BufferObject *> &bufferObjects, bool bind) {
+    std::vector<BufferObject *> pendingBufferObjects;
+    pendingBufferObjects.reserve(bufferObjects.size());
+    for (auto bo : bufferObjects) {
+        if (bo->bindInfo[bo->getOsContextId(osContext)][vmHandleId] != bind) {
+            pendingBufferObjects.push_back(bo);
+        }
+    }
+    std::sort(pendingBufferObjects.begin(), pendingBufferObjects.end());
+    pendingBufferObjects.erase(std::unique(pendingBufferObjects.begin(), pendingBufferObjects.end()), pendingBufferObjects.end());
+    if (pendingBufferObjects.empty()) {
+        return 0;
+    }
+
+    // without an array bind interface operations are not guaranteed to complete in order,
+    // so every buffer object is bound separately with its own user fence
+    if (ioctlHelper->isVmBindBatchSupported()) {
+        bool submitted = false;
+        auto ret = changeBufferObjectsBindingBatched(this, osContext, vmHandleId, pendingBufferObjects, bind, submitted);
+        if (submitted) {
+            for (auto bo : pendingBufferObjects) {
+                bo->bindInfo[bo->getOsContextId(osContext)][vmHandleId] = bind;
+            }
+            // all operations were submitted, a failure comes from waiting on their completion and is not retried
+            return ret;
+        }
+    }
+
+    // binding one by one retries after evicting unused allocations
+    for (auto bo : pendingBufferObjects) {
+        auto ret = bind ? bo->bind(osContext, vmHandleId) : bo->unbind(osContext, vmHandleId);
+        if (ret) {
+            return ret;
+        }
+    }
+    return 0;
+}
+
 int Drm::createDrmVirtualMemory(uint32_t &drmVmId) {
     GemVmControl ctl{};
 
@@ -43,6 +43,7 @@ enum class SubmissionStatus : uint32_t;
 class BufferObject;
 class CompilerProductHelper;
 class DeviceFactory;
+class DrmQueryCache;
 class MemoryInfo;
 class OsContext;
 class OsContextLinux;
@@ -129,6 +130,7 @@ class Drm : public DriverModel {
     uint32_t getVirtualMemoryAddressSpace(uint32_t vmId) const;
     MOCKABLE_VIRTUAL int bindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObject *bo);
     MOCKABLE_VIRTUAL int unbindBufferObject(OsContext *osContext, uint32_t vmHandleId, BufferObject *bo);
+    int changeBufferObjectsBinding(OsContext *osContext, uint32_t vmHandleId, const std::vector<BufferObject *> &bufferObjects, bool bind);
     int setupHardwareInfo(const DeviceDescriptor *, bool);
     void setupSystemInfo(HardwareInfo *hwInfo, SystemInfo *sysInfo);
     void setupCacheInfo(const HardwareInfo &hwInfo);
@@ -259,6 +261,7 @@ class Drm : public DriverModel {
     void cleanup() override;
     bool readSysFsAsString(const std::string &relativeFilePath, std::string &readString);
     MOCKABLE_VIRTUAL std::string getSysFsPciPath();
+    MOCKABLE_VIRTUAL int getNumaNode();
     std::unique_ptr<HwDeviceIdDrm> &getHwDeviceId() { return hwDeviceId; }
     std::vector<uint8_t> query(uint32_t queryId, uint32_t queryItemFlags);
 
@@ -275,6 +278,9 @@ class Drm : public DriverModel {
     static std::string getDrmVersion(int fileDescriptor);
     bool queryDeviceIdAndRevision();
     bool queryI915DeviceIdAndRevision();
+    void initQueryCache();
+    MOCKABLE_VIRTUAL std::string getFirmwareIdentity(const std::string &drmVersion);
+    std::vector<uint8_t> queryWithCache(uint32_t queryId, uint32_t queryItemFlags);
 
 #pragma pack(1)
     struct PCIConfig {
@@ -328,6 +334,7 @@ class Drm : public DriverModel {
     std::unique_ptr<CacheInfo> cacheInfo;
     std::unique_ptr<EngineInfo> engineInfo;
     std::unique_ptr<MemoryInfo> memoryInfo;
+    std::unique_ptr<DrmQueryCache> queryCache;
 
     std::once_flag checkBindOnce;
     std::once_flag checkSetPairOnce;
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_query_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/os_interface/linux/os_inc.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+#include "shared/source/os_interface/sys_calls_common.h"
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace NEO {
+
+DrmQueryCache::DrmQueryCache(const std::string &cacheDir, const std::string &key) {
+    keyHash = Hash::hash(key.c_str(), key.size());
+
+    std::stringstream stream;
+    stream << cacheDir << PATH_SEPARATOR << std::setfill('0') << std::setw(sizeof(keyHash) * 2) << std::hex << keyHash << ".drmquery";
+    filePath = stream.str();
+}
+
+bool DrmQueryCache::load() {
+    size_t fileSize = 0;
+    auto fileData = loadDataFromFile(filePath.c_str(), fileSize);
+    if (!fileData) {
+        return false;
+    }
+    if (!deserialize(fileData.get(), fileSize)) {
+        PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "Ignoring invalid device query cache %s\n", filePath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool DrmQueryCache::save() {
+    auto fileData = serialize();
+
+    // other processes may read the cache concurrently, publish the complete file with a rename
+    auto tmpFilePath = filePath + "." + std::to_string(SysCalls::getProcessId());
+    if (writeDataToFile(tmpFilePath.c_str(), fileData.data(), fileData.size()) != fileData.size()) {
+        SysCalls::unlink(tmpFilePath);
+        return false;
+    }
+    if (SysCalls::rename(tmpFilePath.c_str(), filePath.c_str()) != 0) {
+        SysCalls::unlink(tmpFilePath);
+        return false;
+    }
+
+    dirty = false;
+    return true;
+}
+
+std::vector<char> DrmQueryCache::serialize() const {
+    std::vector<char> fileData(sizeof(FileHeader));
+    FileHeader header = {fileMagic, fileVersion, keyHash, static_cast<uint32_t>(entries.size()), 0u};
+    memcpy(fileData.data(), &header, sizeof(FileHeader));
+
+    for (auto &[query, data] : entries) {
+        EntryHeader entryHeader = {query.first, query.second, data.size()};
+        auto entryHeaderBytes = reinterpret_cast<const char *>(&entryHeader);
+        fileData.insert(fileData.end(), entryHeaderBytes, entryHeaderBytes + sizeof(EntryHeader));
+        fileData.insert(fileData.end(), data.begin(), data.end());
+    }
+    return fileData;
+}
+
+bool DrmQueryCache::deserialize(const char *fileData, size_t fileSize) {
+    if (fileSize < sizeof(FileHeader)) {
+        return false;
+    }
+
+    FileHeader header = {};
+    memcpy(&header, fileData, sizeof(FileHeader));
+    if (header.magic != fileMagic || header.version != fileVersion || header.keyHash != keyHash) {
+        return false;
+    }
+
+    decltype(entries) loadedEntries;
+    size_t offset = sizeof(FileHeader);
+    for (auto entryIndex = 0u; entryIndex < header.numEntries; entryIndex++) {
+        EntryHeader entryHeader = {};
+        if (fileSize - offset < sizeof(EntryHeader)) {
+            return false;
+        }
+        memcpy(&entryHeader, fileData + offset, sizeof(EntryHeader));
+        offset += sizeof(EntryHeader);
+
+        // truncated file written by a process killed in the middle of save
+        if (fileSize - offset < entryHeader.size) {
+            return false;
+        }
+        auto entryData = reinterpret_cast<const uint8_t *>(fileData + offset);
+        loadedEntries[{entryHeader.queryId, entryHeader.queryItemFlags}] = std::vector<uint8_t>(entryData, entryData + entryHeader.size);
+        offset += static_cast<size_t>(entryHeader.size);
+    }
+
+    entries = std::move(loadedEntries);
+    dirty = false;
+    return true;
+}
+
+bool DrmQueryCache::find(uint32_t queryId, uint32_t queryItemFlags, std::vector<uint8_t> &data) const {
+    auto entry = entries.find({queryId, queryItemFlags});
+    if (entry == entries.end()) {
+        return false;
+    }
+    data = entry->second;
+    return true;
+}
+
+void DrmQueryCache::store(uint32_t queryId, uint32_t queryItemFlags, const std::vector<uint8_t> &data) {
+    entries[{queryId, queryItemFlags}] = data;
+    dirty = true;
+}
+
+} // namespace NEO
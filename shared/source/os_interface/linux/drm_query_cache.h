@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+
+// Persists results of KMD queries describing fixed device capabilities (topology, hwconfig table)
+// so that later processes on the same device, kernel and driver build skip those ioctls.
+// The cache file name is derived from the key, a file of another key or format version is never read.
+class DrmQueryCache {
+  public:
+    static constexpr uint32_t fileMagic = 0x4e44514bu;
+    static constexpr uint32_t fileVersion = 1u;
+
+    DrmQueryCache(const std::string &cacheDir, const std::string &key);
+
+    bool load();
+    bool save();
+    std::vector<char> serialize() const;
+    bool deserialize(const char *fileData, size_t fileSize);
+    bool find(uint32_t queryId, uint32_t queryItemFlags, std::vector<uint8_t> &data) const;
+    void store(uint32_t queryId, uint32_t queryItemFlags, const std::vector<uint8_t> &data);
+
+    const std::string &getFilePath() const { return filePath; }
+    size_t getNumEntries() const { return entries.size(); }
+    bool isDirty() const { return dirty; }
+
+  protected:
+    struct FileHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t keyHash;
+        uint32_t numEntries;
+        uint32_t reserved;
+    };
+
+    struct EntryHeader {
+        uint32_t queryId;
+        uint32_t queryItemFlags;
+        uint64_t size;
+    };
+
+    std::map<std::pair<uint32_t, uint32_t>, std::vector<uint8_t>> entries;
+    std::string filePath;
+    uint64_t keyHash = 0;
+    bool dirty = false;
+};
+} // namespace NEO
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_userptr_cache.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+BufferObject *DrmUserptrCache::acquire(uint32_t rootDeviceIndex, uintptr_t address, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    auto it = entries.find({address, size, rootDeviceIndex});
+    if (it == entries.end()) {
+        statistics.misses++;
+        return nullptr;
+    }
+
+    statistics.hits++;
+    auto bo = it->second.bo;
+    lru.erase(it->second.lruPosition);
+    entries.erase(it);
+    return bo;
+}
+
+void DrmUserptrCache::release(uint32_t rootDeviceIndex, uintptr_t address, size_t size, BufferObject *bo, std::vector<BufferObject *> &bosToDestroy) {
+    DEBUG_BREAK_IF(bo == nullptr);
+    std::lock_guard<std::mutex> lock(mtx);
+
+    EntryKey key = {address, size, rootDeviceIndex};
+    if (maxEntries == 0 || entries.find(key) != entries.end()) {
+        bosToDestroy.push_back(bo);
+        return;
+    }
+
+    lru.push_front(key);
+    entries.insert({key, {bo, lru.begin()}});
+    maxEntrySize = std::max(maxEntrySize, size);
+
+    while (entries.size() > maxEntries) {
+        statistics.evictions++;
+        eraseEntry(entries.find(lru.back()), bosToDestroy);
+    }
+}
+
+void DrmUserptrCache::invalidateRange(uintptr_t address, size_t size, std::vector<BufferObject *> &bosToDestroy) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (entries.empty() || size == 0) {
+        return;
+    }
+
+    auto searchStart = address > maxEntrySize ? address - maxEntrySize : 0u;
+    auto it = entries.lower_bound({searchStart, 0u, 0u});
+    while (it != entries.end() && it->first.address < address + size) {
+        if (it->first.address + it->first.size > address) {
+            statistics.invalidations++;
+            it = eraseEntry(it, bosToDestroy);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void DrmUserptrCache::releaseAll(std::vector<BufferObject *> &bosToDestroy) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto &entry : entries) {
+        bosToDestroy.push_back(entry.second.bo);
+    }
+    entries.clear();
+    lru.clear();
+    maxEntrySize = 0;
+}
+
+size_t DrmUserptrCache::getNumEntries() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+
+DrmUserptrCache::Statistics DrmUserptrCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics;
+}
+
+DrmUserptrCache::EntryMap::iterator DrmUserptrCache::eraseEntry(EntryMap::iterator it, std::vector<BufferObject *> &bosToDestroy) {
+    bosToDestroy.push_back(it->second.bo);
+    lru.erase(it->second.lruPosition);
+    return entries.erase(it);
+}
+
+} // namespace NEO
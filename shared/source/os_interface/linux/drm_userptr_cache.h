@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class BufferObject;
+
+// Keeps userptr BOs of released host pointer fragments so that repeated transfers
+// from the same host ranges skip GEM_USERPTR creation and validation.
+// Cached BOs are owned by the cache, acquire() hands the ownership back to the caller.
+class DrmUserptrCache {
+  public:
+    struct Statistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        uint64_t invalidations = 0;
+    };
+
+    static constexpr size_t defaultMaxEntries = 256;
+
+    DrmUserptrCache(size_t maxEntries) : maxEntries(maxEntries) {}
+
+    BufferObject *acquire(uint32_t rootDeviceIndex, uintptr_t address, size_t size);
+    void release(uint32_t rootDeviceIndex, uintptr_t address, size_t size, BufferObject *bo, std::vector<BufferObject *> &bosToDestroy);
+    void invalidateRange(uintptr_t address, size_t size, std::vector<BufferObject *> &bosToDestroy);
+    void releaseAll(std::vector<BufferObject *> &bosToDestroy);
+
+    size_t getNumEntries() const;
+    Statistics getStatistics() const;
+    size_t getMaxEntries() const { return maxEntries; }
+
+  protected:
+    struct EntryKey {
+        uintptr_t address;
+        size_t size;
+        uint32_t rootDeviceIndex;
+
+        bool operator<(const EntryKey &other) const {
+            if (address != other.address) {
+                return address < other.address;
+            }
+            if (size != other.size) {
+                return size < other.size;
+            }
+            return rootDeviceIndex < other.rootDeviceIndex;
+        }
+    };
+    using LruList = std::list<EntryKey>;
+
+    struct Entry {
+        BufferObject *bo;
+        LruList::iterator lruPosition;
+    };
+    using EntryMap = std::map<EntryKey, Entry>;
+
+    EntryMap::iterator eraseEntry(EntryMap::iterator it, std::vector<BufferObject *> &bosToDestroy);
+
+    // entries are ordered by start address, the largest cached size bounds the search for overlapping ranges
+    EntryMap entries;
+    LruList lru;
+    size_t maxEntries;
+    size_t maxEntrySize = 0;
+    Statistics statistics;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
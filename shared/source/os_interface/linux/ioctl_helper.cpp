@@ -391,6 +391,12 @@ std::string IoctlHelper::getFileForMemoryAddrRange(int subDeviceId) const {
     return "gt/gt" + std::to_string(subDeviceId) + "/addr_range";
 }
 
+int IoctlHelper::vmBindBatch(const std::vector<VmBindParams> &vmBindParams, bool bind, size_t &numCompleted) {
+    // no array bind interface, buffer objects are bound one by one instead
+    numCompleted = 0;
+    return -1;
+}
+
 bool IoctlHelper::checkIfIoctlReinvokeRequired(int error, DrmIoctl ioctlRequest) const {
     return (error == EINTR || error == EAGAIN || error == EBUSY || error == -EBUSY);
 }
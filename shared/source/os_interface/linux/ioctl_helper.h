@@ -145,6 +145,8 @@ class IoctlHelper {
     virtual std::string getFileForMemoryAddrRange(int subdeviceId) const;
     virtual bool getFabricLatency(uint32_t fabricId, uint32_t &latency, uint32_t &bandwidth) = 0;
     virtual bool isWaitBeforeBindRequired(bool bind) const = 0;
+    virtual bool isVmBindBatchSupported() const { return false; }
+    virtual int vmBindBatch(const std::vector<VmBindParams> &vmBindParams, bool bind, size_t &numCompleted);
     virtual void *pciBarrierMmap() { return nullptr; };
     virtual void setupIpVersion();
 
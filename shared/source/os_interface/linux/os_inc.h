@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,4 +15,8 @@ extern const char *sysFsPciPathPrefix;
 extern const char *pciDevicesDirectory;
 // Proc Path
 extern const char *sysFsProcPathPrefix;
+// Debugfs Path
+extern const char *debugFsDriPathPrefix;
+// Firmware Path
+extern const char *firmwarePathPrefix;
 } // namespace Os
@@ -1163,34 +1163,57 @@ int IoctlHelperXe::createDrmContext(Drm &drm, OsContextLinux &osContext, uint32_
     return drmContextId;
 }
 
-int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool bindOp) {
-    int ret = -1;
-    const char *operation = "unbind";
-    if (bindOp) {
-        operation = "bind";
-    }
-    int found = -1;
+int IoctlHelperXe::xeFindBindInfo(const VmBindParams &vmBindParams, bool bindOp) {
     if (bindOp) {
         for (unsigned int i = 0; i < bindInfo.size(); i++) {
             if (vmBindParams.handle == bindInfo[i].handle) {
-                found = i;
-                break;
+                return i;
             }
         }
     } else {
         uint64_t ad = xeDecanonize(vmBindParams.start);
         for (unsigned int i = 0; i < bindInfo.size(); i++) {
             if (ad == bindInfo[i].addr) {
-                found = i;
-                break;
+                return i;
             }
         }
     }
+    return -1;
+}
+
+void IoctlHelperXe::xeFillVmBindOp(const VmBindParams &vmBindParams, bool bindOp, int found, struct drm_xe_vm_bind_op &bindOperation) {
+    bindOperation.obj = vmBindParams.handle;
+    bindOperation.obj_offset = vmBindParams.offset;
+    bindOperation.range = vmBindParams.length;
+    bindOperation.addr = xeDecanonize(vmBindParams.start);
+    bindOperation.op = XE_VM_BIND_OP_MAP;
+    if (vmBindParams.handle & XE_USERPTR_FAKE_FLAG) {
+        bindOperation.obj = 0;
+        bindOperation.obj_offset = bindInfo[found].userptr;
+        bindOperation.op = XE_VM_BIND_OP_MAP_USERPTR;
+    }
+    if (!bindOp) {
+        bindOperation.op = XE_VM_BIND_OP_UNMAP;
+        bindOperation.obj = 0;
+        if (bindInfo[found].handle & XE_USERPTR_FAKE_FLAG) {
+            bindOperation.obj_offset = bindInfo[found].userptr;
+        }
+    }
+    bindOperation.op |= XE_VM_BIND_FLAG_ASYNC;
+
+    bindInfo[found].addr = bindOperation.addr;
+}
+
+int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool bindOp) {
+    int ret = -1;
+    const char *operation = "unbind";
+    if (bindOp) {
+        operation = "bind";
+    }
+    int found = xeFindBindInfo(vmBindParams, bindOp);
     if (found != -1) {
-        uint32_t extraBindFlag = 0;
         struct drm_xe_sync sync[1] = {};
         sync[0].flags = DRM_XE_SYNC_USER_FENCE | DRM_XE_SYNC_SIGNAL;
-        extraBindFlag = XE_VM_BIND_FLAG_ASYNC;
         auto xeBindExtUserFence = reinterpret_cast<UserFenceExtension *>(vmBindParams.extensions);
         UNRECOVERABLE_IF(!xeBindExtUserFence);
         UNRECOVERABLE_IF(xeBindExtUserFence->tag != UserFenceExtension::tagValue);
@@ -1200,28 +1223,10 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool bindOp) {
         struct drm_xe_vm_bind bind = {};
         bind.vm_id = vmBindParams.vmId;
         bind.num_binds = 1;
-        bind.bind.obj = vmBindParams.handle;
-        bind.bind.obj_offset = vmBindParams.offset;
-        bind.bind.range = vmBindParams.length;
-        bind.bind.addr = xeDecanonize(vmBindParams.start);
-        bind.bind.op = XE_VM_BIND_OP_MAP;
+        xeFillVmBindOp(vmBindParams, bindOp, found, bind.bind);
         bind.num_syncs = 1;
         bind.syncs = reinterpret_cast<uintptr_t>(&sync);
-        if (vmBindParams.handle & XE_USERPTR_FAKE_FLAG) {
-            bind.bind.obj = 0;
-            bind.bind.obj_offset = bindInfo[found].userptr;
-            bind.bind.op = XE_VM_BIND_OP_MAP_USERPTR;
-        }
-        if (!bindOp) {
-            bind.bind.op = XE_VM_BIND_OP_UNMAP;
-            bind.bind.obj = 0;
-            if (bindInfo[found].handle & XE_USERPTR_FAKE_FLAG) {
-                bind.bind.obj_offset = bindInfo[found].userptr;
-            }
-        }
-        bind.bind.op |= extraBindFlag;
 
-        bindInfo[found].addr = bind.bind.addr;
         xeLog(" vm=%d obj=0x%x off=0x%llx range=0x%llx addr=0x%llx op=%d(%s) nsy=%d\n",
               bind.vm_id,
               bind.bind.obj,
@@ -1249,6 +1254,57 @@ int IoctlHelperXe::xeVmBind(const VmBindParams &vmBindParams, bool bindOp) {
     return ret;
 }
 
+int IoctlHelperXe::vmBindBatch(const std::vector<VmBindParams> &vmBindParams, bool bind, size_t &numCompleted) {
+    numCompleted = 0;
+    std::vector<struct drm_xe_vm_bind_op> bindOperations(vmBindParams.size());
+    for (size_t i = 0; i < vmBindParams.size(); i++) {
+        int found = xeFindBindInfo(vmBindParams[i], bind);
+        if (found == -1) {
+            xeLog(" -> IoctlHelperXe::%s %s not found vmid=0x%x h=0x%x s=0x%llx\n",
+                  __FUNCTION__, bind ? "bind" : "unbind", vmBindParams[i].vmId, vmBindParams[i].handle, vmBindParams[i].start);
+            return -1;
+        }
+        xeFillVmBindOp(vmBindParams[i], bind, found, bindOperations[i]);
+    }
+
+    // the whole array is signaled with the user fence of the last operation
+    auto xeBindExtUserFence = reinterpret_cast<UserFenceExtension *>(vmBindParams.back().extensions);
+    UNRECOVERABLE_IF(!xeBindExtUserFence);
+    UNRECOVERABLE_IF(xeBindExtUserFence->tag != UserFenceExtension::tagValue);
+
+    struct drm_xe_sync sync[1] = {};
+    sync[0].flags = DRM_XE_SYNC_USER_FENCE | DRM_XE_SYNC_SIGNAL;
+    sync[0].addr = xeBindExtUserFence->addr;
+    sync[0].timeline_value = xeBindExtUserFence->value;
+
+    struct drm_xe_vm_bind vmBind = {};
+    vmBind.vm_id = vmBindParams.back().vmId;
+    vmBind.num_binds = static_cast<uint32_t>(bindOperations.size());
+    if (vmBind.num_binds == 1) {
+        vmBind.bind = bindOperations[0];
+    } else {
+        vmBind.vector_of_binds = castToUint64(bindOperations.data());
+    }
+    vmBind.num_syncs = 1;
+    vmBind.syncs = reinterpret_cast<uintptr_t>(&sync);
+
+    xeLog(" vm=%d num_binds=%d nsy=%d\n", vmBind.vm_id, vmBind.num_binds, vmBind.num_syncs);
+    auto ret = IoctlHelper::ioctl(DrmIoctl::GemVmBind, &vmBind);
+    if (ret != 0) {
+        return ret;
+    }
+
+    // once the ioctl is accepted every operation is submitted and the fence value is consumed,
+    // a failed wait is reported to the caller but the operations are not retried one by one
+    numCompleted = vmBindParams.size();
+
+    // keep the per operation wait budget of the single bind path
+    auto timeout = static_cast<int64_t>(XE_ONE_SEC) * static_cast<int64_t>(vmBindParams.size());
+    return xeWaitUserFence(DRM_XE_UFENCE_WAIT_U64, DRM_XE_UFENCE_WAIT_EQ,
+                           sync[0].addr,
+                           sync[0].timeline_value, timeout);
+}
+
 std::string IoctlHelperXe::getDrmParamString(DrmParam drmParam) const {
     switch (drmParam) {
     case DrmParam::ContextCreateExtSetparam:
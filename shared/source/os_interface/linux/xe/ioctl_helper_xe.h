@@ -11,6 +11,7 @@
 #include <mutex>
 
 struct drm_xe_engine_class_instance;
+struct drm_xe_vm_bind_op;
 
 // Arbitratry value for easier identification in the logs for now
 #define XE_NEO_BIND_CAPTURE_FLAG 0x1
@@ -99,6 +100,8 @@ class IoctlHelperXe : public IoctlHelper {
     std::string getFileForMemoryAddrRange(int subdeviceId) const override;
     bool getFabricLatency(uint32_t fabricId, uint32_t &latency, uint32_t &bandwidth) override;
     bool isWaitBeforeBindRequired(bool bind) const override;
+    bool isVmBindBatchSupported() const override { return true; }
+    int vmBindBatch(const std::vector<VmBindParams> &vmBindParams, bool bind, size_t &numCompleted) override;
     std::unique_ptr<EngineInfo> createEngineInfo(bool isSysmanEnabled) override;
     std::unique_ptr<MemoryInfo> createMemoryInfo() override;
 
@@ -121,6 +124,8 @@ class IoctlHelperXe : public IoctlHelper {
     const char *xeGetengineClassName(uint32_t engineClass);
     std::vector<uint8_t> queryData(uint32_t queryId);
     int xeWaitUserFence(uint64_t mask, uint16_t op, uint64_t addr, uint64_t value, int64_t timeout);
+    int xeFindBindInfo(const VmBindParams &vmBindParams, bool bindOp);
+    void xeFillVmBindOp(const VmBindParams &vmBindParams, bool bindOp, int found, struct drm_xe_vm_bind_op &bindOperation);
     int xeVmBind(const VmBindParams &vmBindParams, bool bindOp);
 
     struct UserFenceExtension {
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/worker_pool.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+WorkerPool::WorkerPool(uint32_t maxWorkers) : maxWorkers(maxWorkers) {}
+
+WorkerPool::~WorkerPool() {
+    std::unique_lock<std::mutex> lock(mtx);
+    stopWorkers = true;
+    lock.unlock();
+    workAvailable.notify_all();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+}
+
+size_t WorkerPool::getNumWorkers() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return workers.size();
+}
+
+void WorkerPool::ensureWorkers(size_t numWorkers) {
+    // called with mtx acquired
+    numWorkers = std::min(numWorkers, static_cast<size_t>(maxWorkers));
+    while (workers.size() < numWorkers) {
+        workers.push_back(Thread::create(run, reinterpret_cast<void *>(this)));
+    }
+}
+
+void WorkerPool::runWorkItem(std::unique_lock<std::mutex> &lock, const WorkItem &workItem) {
+    lock.unlock();
+    (*workItem.batch->task)(workItem.taskIndex);
+    lock.lock();
+    if (--workItem.batch->pendingTasks == 0) {
+        batchCompleted.notify_all();
+    }
+}
+
+void WorkerPool::parallelFor(size_t numTasks, const Task &task) {
+    if (maxWorkers == 0 || numTasks < 2) {
+        for (size_t taskIndex = 0; taskIndex < numTasks; taskIndex++) {
+            task(taskIndex);
+        }
+        return;
+    }
+
+    Batch batch{&task, numTasks - 1};
+    std::unique_lock<std::mutex> lock(mtx);
+    ensureWorkers(numTasks - 1);
+    for (size_t taskIndex = 1; taskIndex < numTasks; taskIndex++) {
+        workItems.push_back({&batch, taskIndex});
+    }
+    lock.unlock();
+    workAvailable.notify_all();
+
+    task(0);
+
+    lock.lock();
+    // help with queued items instead of idling, then wait for the ones taken by workers
+    while (batch.pendingTasks > 0 && !workItems.empty()) {
+        auto workItem = workItems.front();
+        workItems.pop_front();
+        runWorkItem(lock, workItem);
+    }
+    batchCompleted.wait(lock, [&batch]() { return batch.pendingTasks == 0; });
+}
+
+void *WorkerPool::run(void *arg) {
+    auto self = reinterpret_cast<WorkerPool *>(arg);
+    std::unique_lock<std::mutex> lock(self->mtx);
+    while (true) {
+        self->workAvailable.wait(lock, [self]() { return self->stopWorkers || !self->workItems.empty(); });
+        if (self->workItems.empty()) {
+            break;
+        }
+        auto workItem = self->workItems.front();
+        self->workItems.pop_front();
+        self->runWorkItem(lock, workItem);
+    }
+    return nullptr;
+}
+
+} // namespace NEO
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Persistent worker threads for splitting short CPU bound operations, threads are created on first use and
+// reused afterwards. The calling thread always takes part in the work, so a pool without workers runs inline.
+class WorkerPool : NonCopyableOrMovableClass {
+  public:
+    using Task = std::function<void(size_t taskIndex)>;
+
+    WorkerPool(uint32_t maxWorkers);
+    ~WorkerPool();
+
+    // runs task for every index in [0, numTasks) and returns once all of them are done
+    void parallelFor(size_t numTasks, const Task &task);
+
+    uint32_t getMaxWorkers() const { return maxWorkers; }
+    size_t getNumWorkers() const;
+
+  protected:
+    struct Batch {
+        const Task *task = nullptr;
+        size_t pendingTasks = 0;
+    };
+    struct WorkItem {
+        Batch *batch;
+        size_t taskIndex;
+    };
+
+    static void *run(void *arg);
+    void ensureWorkers(size_t numWorkers);
+    void runWorkItem(std::unique_lock<std::mutex> &lock, const WorkItem &workItem);
+
+    const uint32_t maxWorkers;
+    bool stopWorkers = false;
+    std::vector<std::unique_ptr<Thread>> workers;
+    std::deque<WorkItem> workItems;
+    mutable std::mutex mtx;
+    std::condition_variable workAvailable;
+    std::condition_variable batchCompleted;
+};
+} // namespace NEO
@@ -36,6 +36,7 @@ class DrmMock : public Drm {
     using Drm::fenceVal;
     using Drm::generateElfUUID;
     using Drm::generateUUID;
+    using Drm::getFirmwareIdentity;
     using Drm::getQueueSliceCount;
     using Drm::ioctlHelper;
     using Drm::memoryInfo;
@@ -45,6 +46,7 @@ class DrmMock : public Drm {
     using Drm::preemptionSupported;
     using Drm::query;
     using Drm::queryAndSetVmBindPatIndexProgrammingSupport;
+    using Drm::queryCache;
     using Drm::queryDeviceIdAndRevision;
     using Drm::requirePerContextVM;
     using Drm::setPairAvailable;
@@ -204,6 +204,11 @@ int DrmMockPrelimContext::handlePrelimRequest(DrmIoctl request, void *arg) {
             return EINVAL;
         }
 
+        if (gemCreateExtSuccessCount == 0) {
+            return EINVAL;
+        }
+        gemCreateExtSuccessCount--;
+
         return gemCreateExtReturn;
     } break;
     case DrmIoctl::GemWaitUserFence: {
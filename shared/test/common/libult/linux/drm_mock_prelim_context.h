@@ -153,6 +153,7 @@ struct DrmMockPrelimContext {
     std::optional<CreateGemExt> receivedCreateGemExt{};
     std::optional<GemContextParamAcc> receivedContextParamAcc{};
     int gemCreateExtReturn{0};
+    uint32_t gemCreateExtSuccessCount{std::numeric_limits<uint32_t>::max()};
 
     bool failDistanceInfoQuery{false};
     bool disableCcsSupport{false};
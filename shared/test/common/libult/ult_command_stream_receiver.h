@@ -80,6 +80,7 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
     using BaseClass::CommandStreamReceiver::cleanupResources;
     using BaseClass::CommandStreamReceiver::clearColorAllocation;
     using BaseClass::CommandStreamReceiver::commandStream;
+    using BaseClass::CommandStreamReceiver::completionWatermarkEnabled;
     using BaseClass::CommandStreamReceiver::debugConfirmationFunction;
     using BaseClass::CommandStreamReceiver::debugPauseStateAddress;
     using BaseClass::CommandStreamReceiver::deviceBitfield;
@@ -327,6 +328,13 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
         return BaseClass::createPerDssBackedBuffer(device);
     }
 
+    bool createEngineResources() override {
+        if (createEngineResourcesReturnValue.has_value()) {
+            return *createEngineResourcesReturnValue;
+        }
+        return BaseClass::createEngineResources();
+    }
+
     bool isMultiOsContextCapable() const override {
         if (callBaseIsMultiOsContextCapable) {
             return BaseClass::isMultiOsContextCapable();
@@ -430,6 +438,7 @@ class UltCommandStreamReceiver : public CommandStreamReceiverHw<GfxFamily>, publ
     uint32_t createAllocationForHostSurfaceCalled = 0;
     WaitStatus returnWaitForCompletionWithTimeout = WaitStatus::Ready;
     std::optional<WaitStatus> waitForTaskCountWithKmdNotifyFallbackReturnValue{};
+    std::optional<bool> createEngineResourcesReturnValue{};
     std::optional<SubmissionStatus> flushReturnValue{};
     CommandStreamReceiverType commandStreamReceiverType = CommandStreamReceiverType::CSR_HW;
     uint32_t downloadAllocationsCalledCount = 0;
@@ -52,24 +52,33 @@ class TestedDrmMemoryManager : public MemoryManagerCreate<DrmMemoryManager> {
     using DrmMemoryManager::allocatePhysicalLocalDeviceMemory;
     using DrmMemoryManager::allocationTypeForCompletionFence;
     using DrmMemoryManager::allocUserptr;
+    using DrmMemoryManager::applyNumaPlacement;
     using DrmMemoryManager::createAllocWithAlignment;
     using DrmMemoryManager::createAllocWithAlignmentFromUserptr;
     using DrmMemoryManager::createGraphicsAllocation;
     using DrmMemoryManager::createMultiHostAllocation;
     using DrmMemoryManager::createSharedUnifiedMemoryAllocation;
+    using DrmMemoryManager::deviceNumaNodes;
     using DrmMemoryManager::eraseSharedBoHandleWrapper;
     using DrmMemoryManager::eraseSharedBufferObject;
     using DrmMemoryManager::getDefaultDrmContextId;
     using DrmMemoryManager::getDrm;
+    using DrmMemoryManager::getPreferredNumaNode;
     using DrmMemoryManager::getRootDeviceIndex;
     using DrmMemoryManager::getUserptrAlignment;
     using DrmMemoryManager::gfxPartitions;
     using DrmMemoryManager::handleFenceCompletion;
+    using DrmMemoryManager::isParallelBoCreationAllowed;
     using DrmMemoryManager::lockBufferObject;
     using DrmMemoryManager::lockResourceImpl;
+    using DrmMemoryManager::madviseFunction;
     using DrmMemoryManager::mapPhysicalToVirtualMemory;
     using DrmMemoryManager::memoryForPinBBs;
     using DrmMemoryManager::mmapFunction;
+    using DrmMemoryManager::persistentMappingPositions;
+    using DrmMemoryManager::persistentMappings;
+    using DrmMemoryManager::persistentMappingsBudget;
+    using DrmMemoryManager::persistentMappingsSize;
     using DrmMemoryManager::munmapFunction;
     using DrmMemoryManager::pinBBs;
     using DrmMemoryManager::pinThreshold;
@@ -85,10 +94,12 @@ class TestedDrmMemoryManager : public MemoryManagerCreate<DrmMemoryManager> {
     using DrmMemoryManager::tryToGetBoHandleWrapperWithSharedOwnership;
     using DrmMemoryManager::unlockBufferObject;
     using DrmMemoryManager::unMapPhysicalToVirtualMemory;
+    using DrmMemoryManager::userptrCache;
     using DrmMemoryManager::waitOnCompletionFence;
     using MemoryManager::allocateGraphicsMemoryInDevicePool;
     using MemoryManager::allRegisteredEngines;
     using MemoryManager::heapAssigner;
+    using MemoryManager::workerPool;
 
     TestedDrmMemoryManager(ExecutionEnvironment &executionEnvironment);
     TestedDrmMemoryManager(bool enableLocalMemory,
@@ -61,10 +61,12 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::performDiagnosticMode;
     using BaseClass::preinitializedRelaxedOrderingScheduler;
     using BaseClass::preinitializedTaskStoreSection;
+    using BaseClass::relaxedOrderingAdaptiveQueueSize;
     using BaseClass::relaxedOrderingEnabled;
     using BaseClass::relaxedOrderingInitialized;
     using BaseClass::relaxedOrderingSchedulerAllocation;
     using BaseClass::relaxedOrderingSchedulerRequired;
+    using BaseClass::relaxedOrderingTasksSinceQueueStall;
     using BaseClass::reserved;
     using BaseClass::ringBuffers;
     using BaseClass::ringCommandStream;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2022 Intel Corporation
+ * Copyright (C) 2018-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,4 +26,6 @@ const char *dxcoreDllName = "";
 const char *sysFsPciPathPrefix = NEO_SHARED_TEST_FILES_DIR "/linux/devices/";
 const char *pciDevicesDirectory = NEO_SHARED_TEST_FILES_DIR "/linux/by-path";
 const char *sysFsProcPathPrefix = NEO_SHARED_TEST_FILES_DIR "/linux/proc/";
+const char *debugFsDriPathPrefix = NEO_SHARED_TEST_FILES_DIR "/linux/debug/dri/";
+const char *firmwarePathPrefix = NEO_SHARED_TEST_FILES_DIR "/linux/firmware/";
 } // namespace Os
@@ -66,6 +66,10 @@ bool mmapAllowExtendedPointers = false;
 bool failMmap = false;
 uint32_t mmapFuncCalled = 0u;
 uint32_t munmapFuncCalled = 0u;
+uint32_t mbindFuncCalled = 0u;
+long mbindFuncRetVal = 0;
+int mbindModePassed = 0;
+unsigned long mbindNodeMaskPassed = 0u;
 
 int (*sysCallsOpen)(const char *pathname, int flags) = nullptr;
 int (*sysCallsClose)(int fileDescriptor) = nullptr;
@@ -300,6 +304,13 @@ int munmap(void *addr, size_t size) noexcept {
     return 0;
 }
 
+long mbind(void *addr, unsigned long len, int mode, const unsigned long *nodemask, unsigned long maxnode, unsigned int flags) {
+    mbindFuncCalled++;
+    mbindModePassed = mode;
+    mbindNodeMaskPassed = nodemask ? *nodemask : 0u;
+    return mbindFuncRetVal;
+}
+
 ssize_t read(int fd, void *buf, size_t count) {
     if (sysCallsRead != nullptr) {
         return sysCallsRead(fd, buf, count);
@@ -63,7 +63,12 @@ extern std::vector<void *> mmapVector;
 extern std::vector<void *> mmapCapturedExtendedPointers;
 extern bool mmapCaptureExtendedPointers;
 extern bool mmapAllowExtendedPointers;
+extern bool failMmap;
 extern uint32_t mmapFuncCalled;
 extern uint32_t munmapFuncCalled;
+extern uint32_t mbindFuncCalled;
+extern long mbindFuncRetVal;
+extern int mbindModePassed;
+extern unsigned long mbindNodeMaskPassed;
 } // namespace SysCalls
 } // namespace NEO
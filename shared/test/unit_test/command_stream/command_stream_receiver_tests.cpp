@@ -464,6 +464,47 @@ HWTEST_F(CommandStreamReceiverTest, whenDownloadTagAllocationThenDonwloadOnlyIfT
     EXPECT_TRUE(csr.downloadAllocationCalled);
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenCompletionWatermarkEnabledWhenTaskCountObservedAsReadyThenLaterQueriesAreAnsweredFromWatermark) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.activePartitions = 1;
+    csr.completionWatermarkEnabled = true;
+
+    volatile TagAddressType tagValue = 0;
+    VariableBackup<volatile TagAddressType *> csrTagAddressBackup(&csr.tagAddress, &tagValue);
+
+    EXPECT_FALSE(csr.isTaskCountCompleted(5u));
+    EXPECT_FALSE(csr.testTaskCountReady(csr.tagAddress, 5u));
+    EXPECT_EQ(0u, csr.peekCompletionWatermark());
+
+    tagValue = 5u;
+    EXPECT_TRUE(csr.testTaskCountReady(csr.tagAddress, 5u));
+    EXPECT_EQ(5u, csr.peekCompletionWatermark());
+
+    tagValue = 0u;
+    EXPECT_TRUE(csr.isTaskCountCompleted(4u));
+    EXPECT_TRUE(csr.testTaskCountReady(csr.tagAddress, 5u));
+    EXPECT_FALSE(csr.testTaskCountReady(csr.tagAddress, 6u));
+
+    csr.updateCompletionWatermark(3u);
+    EXPECT_EQ(5u, csr.peekCompletionWatermark());
+
+    volatile TagAddressType otherPollValue = 0;
+    EXPECT_FALSE(csr.testTaskCountReady(&otherPollValue, 5u));
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenCompletionWatermarkDisabledWhenTaskCountObservedAsReadyThenWatermarkIsNotUpdated) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.activePartitions = 1;
+    csr.completionWatermarkEnabled = false;
+
+    volatile TagAddressType tagValue = 5u;
+    VariableBackup<volatile TagAddressType *> csrTagAddressBackup(&csr.tagAddress, &tagValue);
+
+    EXPECT_TRUE(csr.testTaskCountReady(csr.tagAddress, 5u));
+    EXPECT_EQ(0u, csr.peekCompletionWatermark());
+    EXPECT_FALSE(csr.isTaskCountCompleted(0u));
+}
+
 HWTEST_F(CommandStreamReceiverTest, givenGpuHangAndNonEmptyAllocationsListWhenCallingWaitForTaskCountAndCleanAllocationListThenWaitIsCalledAndGpuHangIsReturned) {
     auto driverModelMock = std::make_unique<MockDriverModel>();
     driverModelMock->isGpuHangDetectedToReturn = true;
@@ -642,6 +683,29 @@ TEST(CommandStreamReceiverSimpleTest, givenCsrWhenSubmittingBatchBufferAndFlushF
     executionEnvironment.memoryManager->freeGraphicsMemoryImpl(commandBuffer);
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenUpdateTaskCountFromWaitWhenGettingNumPendingTasksThenTasksUpToLatestFlushedTaskCountNotCoveredByCompletionWatermarkAreCounted) {
+    DebugManagerStateRestore restorer;
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    *csr.getTagAddress() = 2;
+    csr.taskCount = 10;
+    csr.latestFlushedTaskCount = 5;
+
+    DebugManager.flags.UpdateTaskCountFromWait.set(0);
+    EXPECT_EQ(8u, csr.getNumPendingTasks());
+
+    DebugManager.flags.UpdateTaskCountFromWait.set(3);
+    EXPECT_EQ(3u, csr.getNumPendingTasks());
+
+    csr.completionWatermarkEnabled = true;
+    csr.updateCompletionWatermark(4);
+    EXPECT_EQ(1u, csr.getNumPendingTasks());
+
+    csr.updateCompletionWatermark(7);
+    EXPECT_EQ(0u, csr.getNumPendingTasks());
+
+    *csr.getTagAddress() = csr.peekTaskCount();
+}
+
 HWTEST_F(CommandStreamReceiverTest, givenUpdateTaskCountFromWaitWhenSubmitiingBatchBufferThenTaskCountIsIncrementedAndLatestsValuesSetCorrectly) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.UpdateTaskCountFromWait.set(3);
@@ -858,3 +858,28 @@ TEST_F(DeviceTests, whenInitializingDeviceThenSetCorrectDefaultBcsEngineIndex) {
     EXPECT_EQ(aub_stream::EngineType::ENGINE_BCS, engine.getEngineType());
     EXPECT_EQ(EngineUsage::Regular, engine.getEngineUsage());
 }
+
+TEST(Device, givenDeferEngineResourcesCreationWhenDeviceIsCreatedThenEnginesWithDeferredOsContextCreateResourcesOnInitialization) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DeferOsContextInitialization.set(1);
+    DebugManager.flags.DeferEngineResourcesCreation.set(1);
+
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+
+    uint32_t numDeferredEngines = 0;
+    for (auto &engine : device->getAllEngines()) {
+        auto csr = engine.commandStreamReceiver;
+        EXPECT_EQ(!engine.osContext->isInitialized(), csr->isEngineResourcesCreationDeferred());
+
+        if (csr->isEngineResourcesCreationDeferred()) {
+            numDeferredEngines++;
+            EXPECT_EQ(nullptr, csr->getGlobalFenceAllocation());
+            EXPECT_EQ(nullptr, csr->getKernelArgsBufferAllocation());
+            EXPECT_EQ(nullptr, csr->getPreemptionAllocation());
+
+            EXPECT_TRUE(csr->initializeResources());
+            EXPECT_FALSE(csr->isEngineResourcesCreationDeferred());
+        }
+    }
+    EXPECT_LT(0u, numDeferredEngines);
+}
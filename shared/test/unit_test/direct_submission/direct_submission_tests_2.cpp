@@ -1620,6 +1620,61 @@ HWTEST2_F(DirectSubmissionRelaxedOrderingTests, givenNewNumberOfClientsWhenDispa
     EXPECT_FALSE(findStaticSchedulerUpdate(directSubmission.ringCommandStream, offset, RelaxedOrderingHelper::queueSizeMultiplier * batchBuffer.numCsrClients));
 }
 
+HWTEST2_F(DirectSubmissionRelaxedOrderingTests, givenAdaptiveQueueSizeWhenDispatchingTasksThenGrowQueueUntilStallAndShrinkAfterIt, IsAtLeastXeHpcCore) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    DebugManager.flags.DirectSubmissionRelaxedOrderingAdaptiveQueueSize.set(1);
+
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.relaxedOrderingAdaptiveQueueSize);
+    directSubmission.initialize(true, false);
+
+    batchBuffer.hasRelaxedOrderingDependencies = true;
+    batchBuffer.numCsrClients = 1;
+
+    for (uint32_t i = 1; i <= RelaxedOrderingHelper::maxQueueSize + 2; i++) {
+        directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+
+        auto expectedQueueSize = std::min(std::max(i, RelaxedOrderingHelper::queueSizeMultiplier), RelaxedOrderingHelper::maxQueueSize);
+        EXPECT_EQ(expectedQueueSize, directSubmission.currentRelaxedOrderingQueueSize);
+        EXPECT_EQ(i, directSubmission.relaxedOrderingTasksSinceQueueStall);
+    }
+
+    auto &statistics = directSubmission.getRelaxedOrderingStatistics();
+    EXPECT_EQ(RelaxedOrderingHelper::maxQueueSize + 2u, statistics.scheduledTasks);
+    EXPECT_EQ(RelaxedOrderingHelper::maxQueueSize - RelaxedOrderingHelper::queueSizeMultiplier, statistics.queueSizeUpdates);
+    EXPECT_EQ(RelaxedOrderingHelper::maxQueueSize, statistics.peakQueueSize);
+    EXPECT_EQ(0u, statistics.queueStalls);
+
+    batchBuffer.hasStallingCmds = true;
+    directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+
+    EXPECT_EQ(1u, directSubmission.dispatchRelaxedOrderingQueueStallCalled);
+    EXPECT_EQ(1u, statistics.queueStalls);
+    EXPECT_EQ(1u, directSubmission.relaxedOrderingTasksSinceQueueStall);
+    EXPECT_EQ(RelaxedOrderingHelper::queueSizeMultiplier, directSubmission.currentRelaxedOrderingQueueSize);
+    EXPECT_EQ(RelaxedOrderingHelper::maxQueueSize - RelaxedOrderingHelper::queueSizeMultiplier + 1, statistics.queueSizeUpdates);
+}
+
+HWTEST2_F(DirectSubmissionRelaxedOrderingTests, givenAdaptiveQueueSizeDisabledWhenDispatchingManyTasksThenQueueSizeDependsOnlyOnNumberOfClients, IsAtLeastXeHpcCore) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_FALSE(directSubmission.relaxedOrderingAdaptiveQueueSize);
+    directSubmission.initialize(true, false);
+
+    batchBuffer.hasRelaxedOrderingDependencies = true;
+    batchBuffer.numCsrClients = 1;
+
+    for (uint32_t i = 0; i < RelaxedOrderingHelper::maxQueueSize; i++) {
+        directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp);
+    }
+
+    EXPECT_EQ(RelaxedOrderingHelper::queueSizeMultiplier, directSubmission.currentRelaxedOrderingQueueSize);
+    EXPECT_EQ(RelaxedOrderingHelper::maxQueueSize, directSubmission.getRelaxedOrderingStatistics().scheduledTasks);
+    EXPECT_EQ(0u, directSubmission.getRelaxedOrderingStatistics().queueSizeUpdates);
+}
+
 HWTEST2_F(DirectSubmissionRelaxedOrderingTests, whenInitializingThenDispatchStaticScheduler, IsAtLeastXeHpcCore) {
     using Dispatcher = RenderDispatcher<FamilyType>;
 
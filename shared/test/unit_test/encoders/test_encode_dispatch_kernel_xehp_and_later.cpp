@@ -597,6 +597,33 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenInlineDataRequiredWhe
     EXPECT_EQ(expectedSizeIOH, heap->getUsed());
 }
 
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenInlineDataRequiredWhenEncodingWalkerThenDispatchLocationsAreReturnedInArgs) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    using InlineData = typename FamilyType::INLINE_DATA;
+    uint32_t dims[] = {1, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+
+    dispatchInterface->kernelDescriptor.kernelAttributes.flags.passInlineData = true;
+
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs, nullptr);
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, ptrOffset(cmdContainer->getCommandStream()->getCpuBase(), 0), cmdContainer->getCommandStream()->getUsed());
+
+    auto itor = find<WALKER_TYPE *>(commands.begin(), commands.end());
+    ASSERT_NE(itor, commands.end());
+
+    auto cmd = genCmdCast<WALKER_TYPE *>(*itor);
+    EXPECT_EQ(cmd, dispatchArgs.outWalkerPtr);
+    EXPECT_EQ(cmd->getInlineDataPointer(), dispatchArgs.outInlineDataPtr);
+    EXPECT_EQ(sizeof(InlineData), dispatchArgs.outInlineDataSize);
+
+    auto heap = cmdContainer->getIndirectHeap(HeapType::INDIRECT_OBJECT);
+    EXPECT_EQ(heap->getCpuBase(), dispatchArgs.outIndirectDataPtr);
+    EXPECT_EQ(dispatchInterface->getCrossThreadDataSize() - sizeof(InlineData), dispatchArgs.outIndirectDataSize);
+}
+
 HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenInlineDataRequiredIsFalseWhenEncodingWalkerThenEmitInlineParameterIsNotSet) {
     using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
     uint32_t dims[] = {1, 1, 1};
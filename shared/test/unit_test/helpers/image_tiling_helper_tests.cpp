@@ -0,0 +1,249 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/gmm_helper/resource_info.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/image_tiling_helper.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/worker_pool.h"
+#include "shared/test/common/fixtures/device_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_gmm.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <utility>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+// (x in bytes, row) of every 16B chunk of a tile, listed in the order the chunks are laid out in memory
+std::vector<std::pair<size_t, size_t>> getChunksInMemoryOrder(ImageTilingMode tilingMode) {
+    std::vector<std::pair<size_t, size_t>> chunks;
+    if (tilingMode == ImageTilingMode::TileY) {
+        // 8 columns of 16B, each column holds all 32 rows
+        for (size_t column = 0; column < 8; column++) {
+            for (size_t row = 0; row < 32; row++) {
+                chunks.push_back({column * 16, row});
+            }
+        }
+    } else {
+        // 512B blocks (64B x 8 rows) placed 2 across and 4 down, each made of 2 rows of four 64B cells (16B x 4 rows)
+        for (size_t blockRow = 0; blockRow < 4; blockRow++) {
+            for (size_t blockColumn = 0; blockColumn < 2; blockColumn++) {
+                for (size_t cellRow = 0; cellRow < 2; cellRow++) {
+                    for (size_t cellColumn = 0; cellColumn < 4; cellColumn++) {
+                        for (size_t row = 0; row < 4; row++) {
+                            chunks.push_back({blockColumn * 64 + cellColumn * 16, blockRow * 8 + cellRow * 4 + row});
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return chunks;
+}
+
+struct TiledImageBuffers {
+    TiledImageBuffers(ImageTilingMode tilingMode, size_t widthInBytes, size_t height, size_t slices) {
+        args.tilingMode = tilingMode;
+        args.tiledRowPitch = alignUp(widthInBytes, ImageTilingHelper::tileWidthInBytes);
+        args.tiledSlicePitch = args.tiledRowPitch * alignUp(height, ImageTilingHelper::tileHeight);
+        args.linearRowPitch = widthInBytes + 7;
+        args.linearSlicePitch = args.linearRowPitch * height;
+
+        tiled.resize(args.tiledSlicePitch * slices);
+        reference.resize(tiled.size());
+        linear.resize(args.linearSlicePitch * slices);
+
+        for (size_t i = 0; i < linear.size(); i++) {
+            linear[i] = static_cast<uint8_t>((i * 131) ^ (i >> 8));
+        }
+
+        args.tiledPtr = tiled.data();
+        args.linearPtr = linear.data();
+    }
+
+    void fillExpectedTiled() {
+        auto chunks = getChunksInMemoryOrder(args.tilingMode);
+        const size_t tilesPerRow = args.tiledRowPitch / ImageTilingHelper::tileWidthInBytes;
+        const size_t tilesPerSlice = args.tiledSlicePitch / ImageTilingHelper::tileSize;
+
+        for (size_t slice = args.origin[2]; slice < args.origin[2] + args.region[2]; slice++) {
+            for (size_t tile = 0; tile < tilesPerSlice; tile++) {
+                for (size_t chunk = 0; chunk < chunks.size(); chunk++) {
+                    for (size_t byte = 0; byte < 16; byte++) {
+                        const size_t x = (tile % tilesPerRow) * ImageTilingHelper::tileWidthInBytes + chunks[chunk].first + byte;
+                        const size_t y = (tile / tilesPerRow) * ImageTilingHelper::tileHeight + chunks[chunk].second;
+                        if (x < args.origin[0] || x >= args.origin[0] + args.region[0] || y < args.origin[1] || y >= args.origin[1] + args.region[1]) {
+                            continue;
+                        }
+                        auto tiledOffset = slice * args.tiledSlicePitch + tile * ImageTilingHelper::tileSize + chunk * 16 + byte;
+                        reference[tiledOffset] = linear[slice * args.linearSlicePitch + y * args.linearRowPitch + x];
+                    }
+                }
+            }
+        }
+    }
+
+    TiledImageCopyArgs args;
+    std::vector<uint8_t> tiled;
+    std::vector<uint8_t> reference;
+    std::vector<uint8_t> linear;
+};
+} // namespace
+
+TEST(ImageTilingHelperTest, givenTileYWhenGettingTiledOffsetThenSixteenByteColumnsOfThirtyTwoRowsAreUsed) {
+    constexpr size_t pitch = 4 * ImageTilingHelper::tileWidthInBytes;
+
+    EXPECT_EQ(0u, ImageTilingHelper::getTiledOffset(ImageTilingMode::TileY, 0, 0, pitch));
+    EXPECT_EQ(15u, ImageTilingHelper::getTiledOffset(ImageTilingMode::TileY, 15, 0, pitch));
+    EXPECT_EQ(16u, ImageTilingHelper::getTiledOffset(ImageTilingMode::TileY, 0, 1, pitch));
+    EXPECT_EQ(512u, ImageTilingHelper::getTiledOffset(ImageTilingMode::TileY, 16, 0, pitch));
+    EXPECT_EQ(ImageTilingHelper::tileSize, ImageTilingHelper::getTiledOffset(ImageTilingMode::TileY, 128, 0, pitch));
+    EXPECT_EQ(pitch * ImageTilingHelper::tileHeight, ImageTilingHelper::getTiledOffset(ImageTilingMode::TileY, 0, 32, pitch));
+}
+
+TEST(ImageTilingHelperTest, givenTile4WhenGettingTiledOffsetThenSixtyFourByteCellsAreGroupedInFiveHundredTwelveByteBlocks) {
+    constexpr size_t pitch = 4 * ImageTilingHelper::tileWidthInBytes;
+
+    EXPECT_EQ(16u, ImageTilingHelper::getTiledOffset(ImageTilingMode::Tile4, 0, 1, pitch));
+    EXPECT_EQ(64u, ImageTilingHelper::getTiledOffset(ImageTilingMode::Tile4, 16, 0, pitch));
+    EXPECT_EQ(128u, ImageTilingHelper::getTiledOffset(ImageTilingMode::Tile4, 32, 0, pitch));
+    EXPECT_EQ(192u, ImageTilingHelper::getTiledOffset(ImageTilingMode::Tile4, 48, 0, pitch));
+    EXPECT_EQ(256u, ImageTilingHelper::getTiledOffset(ImageTilingMode::Tile4, 0, 4, pitch));
+    EXPECT_EQ(512u, ImageTilingHelper::getTiledOffset(ImageTilingMode::Tile4, 64, 0, pitch));
+    EXPECT_EQ(1024u, ImageTilingHelper::getTiledOffset(ImageTilingMode::Tile4, 0, 8, pitch));
+    EXPECT_EQ(2048u, ImageTilingHelper::getTiledOffset(ImageTilingMode::Tile4, 0, 16, pitch));
+    EXPECT_EQ(ImageTilingHelper::tileSize + 1, ImageTilingHelper::getTiledOffset(ImageTilingMode::Tile4, 129, 0, pitch));
+}
+
+TEST(ImageTilingHelperTest, givenTiledModeWhenGettingOffsetsForWholeTileThenEachByteIsMappedOnce) {
+    for (auto tilingMode : {ImageTilingMode::TileY, ImageTilingMode::Tile4}) {
+        std::vector<uint8_t> used(ImageTilingHelper::tileSize, 0);
+        for (size_t y = 0; y < ImageTilingHelper::tileHeight; y++) {
+            for (size_t x = 0; x < ImageTilingHelper::tileWidthInBytes; x++) {
+                auto offset = ImageTilingHelper::getTiledOffset(tilingMode, x, y, ImageTilingHelper::tileWidthInBytes);
+                ASSERT_LT(offset, used.size());
+                used[offset]++;
+            }
+        }
+        for (auto &count : used) {
+            EXPECT_EQ(1u, count);
+        }
+    }
+}
+
+TEST(ImageTilingHelperTest, givenUnalignedRegionWhenCopyingLinearToTiledThenDataIsPlacedInTiledLayout) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CpuImageTilingMaxThreads.set(1);
+
+    for (auto tilingMode : {ImageTilingMode::TileY, ImageTilingMode::Tile4}) {
+        TiledImageBuffers buffers(tilingMode, 300, 70, 3);
+        buffers.args.origin = {5, 3, 1};
+        buffers.args.region = {283, 61, 2};
+
+        buffers.fillExpectedTiled();
+        ImageTilingHelper::copyLinearToTiled(buffers.args);
+
+        EXPECT_EQ(buffers.reference, buffers.tiled);
+    }
+}
+
+TEST(ImageTilingHelperTest, givenLargeImageWhenCopyingThenWorkIsSplitAcrossWorkersAndDataIsPlacedInTiledLayout) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CpuImageTilingMaxThreads.set(3);
+    WorkerPool workerPool(4u);
+
+    for (auto tilingMode : {ImageTilingMode::TileY, ImageTilingMode::Tile4}) {
+        TiledImageBuffers buffers(tilingMode, 1024, 64, 48);
+        buffers.args.region = {1024, 64, 48};
+        buffers.args.workerPool = &workerPool;
+        EXPECT_EQ(3u, ImageTilingHelper::getNumWorkerThreads(buffers.args));
+
+        buffers.fillExpectedTiled();
+        ImageTilingHelper::copyLinearToTiled(buffers.args);
+        EXPECT_EQ(buffers.reference, buffers.tiled);
+
+        auto expectedLinear = buffers.linear;
+        std::fill(buffers.linear.begin(), buffers.linear.end(), static_cast<uint8_t>(0));
+        ImageTilingHelper::copyTiledToLinear(buffers.args);
+
+        for (size_t slice = 0; slice < 48; slice++) {
+            for (size_t y = 0; y < 64; y++) {
+                auto rowOffset = slice * buffers.args.linearSlicePitch + y * buffers.args.linearRowPitch;
+                EXPECT_EQ(0, memcmp(&expectedLinear[rowOffset], &buffers.linear[rowOffset], 1024));
+            }
+        }
+    }
+}
+
+TEST(ImageTilingHelperTest, givenSmallImageWhenGettingNumWorkerThreadsThenCopyIsDoneInline) {
+    WorkerPool workerPool(4u);
+    TiledImageCopyArgs args;
+    args.workerPool = &workerPool;
+    args.region = {256, 64, 1};
+    EXPECT_EQ(1u, ImageTilingHelper::getNumWorkerThreads(args));
+
+    args.region = {4096, 1, 1};
+    EXPECT_EQ(1u, ImageTilingHelper::getNumWorkerThreads(args));
+
+    args.region = {0, 0, 0};
+    EXPECT_EQ(1u, ImageTilingHelper::getNumWorkerThreads(args));
+}
+
+TEST(ImageTilingHelperTest, givenLargeImageWhenGettingNumWorkerThreadsThenItIsLimitedByWorkerPool) {
+    TiledImageCopyArgs args;
+    args.region = {1024, 64, 48};
+    EXPECT_EQ(1u, ImageTilingHelper::getNumWorkerThreads(args));
+
+    WorkerPool singleWorkerPool(1u);
+    args.workerPool = &singleWorkerPool;
+    EXPECT_EQ(2u, ImageTilingHelper::getNumWorkerThreads(args));
+
+    WorkerPool emptyPool(0u);
+    args.workerPool = &emptyPool;
+    EXPECT_EQ(1u, ImageTilingHelper::getNumWorkerThreads(args));
+}
+
+TEST(ImageTilingHelperTest, givenDebugFlagWhenCheckingCpuTilingThenReturnCorrectValue) {
+    DebugManagerStateRestore restorer;
+    EXPECT_FALSE(ImageTilingHelper::isCpuTilingEnabled());
+
+    DebugManager.flags.EnableCpuImageTiling.set(1);
+    EXPECT_TRUE(ImageTilingHelper::isCpuTilingEnabled());
+}
+
+using ImageTilingHelperGmmTest = Test<DeviceFixture>;
+
+TEST_F(ImageTilingHelperGmmTest, givenGmmResourceFlagsWhenGettingTilingModeThenReturnCorrectMode) {
+    EXPECT_EQ(ImageTilingMode::Linear, ImageTilingHelper::getTilingMode(nullptr));
+
+    auto gmm = std::make_unique<MockGmm>(pDevice->getGmmHelper());
+    auto &flags = gmm->gmmResourceInfo->getResourceFlags()->Info;
+    flags = {};
+
+    flags.Linear = 1;
+    EXPECT_EQ(ImageTilingMode::Linear, ImageTilingHelper::getTilingMode(gmm.get()));
+
+    flags.Linear = 0;
+    flags.TiledY = 1;
+    EXPECT_EQ(ImageTilingMode::TileY, ImageTilingHelper::getTilingMode(gmm.get()));
+
+    flags.TiledYs = 1;
+    EXPECT_EQ(ImageTilingMode::Unsupported, ImageTilingHelper::getTilingMode(gmm.get()));
+
+    flags = {};
+    flags.Tile4 = 1;
+    EXPECT_EQ(ImageTilingMode::Tile4, ImageTilingHelper::getTilingMode(gmm.get()));
+
+    flags = {};
+    flags.Tile64 = 1;
+    EXPECT_EQ(ImageTilingMode::Unsupported, ImageTilingHelper::getTilingMode(gmm.get()));
+}
@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/memory_manager/memory_pressure_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/test/common/fixtures/memory_allocator_fixture.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
@@ -90,6 +91,24 @@ TEST_F(InternalAllocationStorageTest, whenAllocationIsStoredAsReusableButIsStill
     storage->cleanAllocationList(2u, REUSABLE_ALLOCATION);
 }
 
+HWTEST_F(InternalAllocationStorageTest, whenReclaimingMemoryThenOnlyReusableAllocationsCompletedByGpuAreReleased) {
+    auto &ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> &>(*csr);
+    auto completedAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    auto busyAllocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(completedAllocation), REUSABLE_ALLOCATION, 5u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(busyAllocation), REUSABLE_ALLOCATION, 20u);
+
+    ultCsr.taskCount = 10u;
+    *csr->getTagAddress() = 10u;
+
+    EXPECT_EQ(MemoryConstants::pageSize, memoryManager->getMemoryPressureManager()->reclaim(csr->getRootDeviceIndex(), MemoryConstants::pageSize));
+    EXPECT_FALSE(csr->getAllocationsForReuse().peekContains(*completedAllocation));
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekContains(*busyAllocation));
+
+    storage->cleanAllocationList(20u, REUSABLE_ALLOCATION);
+}
+
 TEST_F(InternalAllocationStorageTest, whenGetDeferredAllocationsThenReturnDeferredAllocationsListFromInternalStorage) {
     EXPECT_EQ(&csr->getDeferredAllocations(), &csr->getInternalAllocationStorage()->getDeferredAllocations());
 }
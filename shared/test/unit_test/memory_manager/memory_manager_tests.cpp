@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/utilities/worker_pool.h"
 #include "shared/test/common/helpers/engine_descriptor_helper.h"
 #include "shared/test/common/mocks/mock_allocation_properties.h"
 #include "shared/test/common/mocks/mock_csr.h"
@@ -59,6 +60,16 @@ TEST(MemoryManagerTest, WhenCallingIsAllocationTypeToCaptureThenScratchAndPrivat
     EXPECT_TRUE(mockMemoryManager.isAllocationTypeToCapture(AllocationType::INTERNAL_HEAP));
 }
 
+TEST(MemoryManagerTest, givenMemoryManagerWhenWorkerPoolIsRequestedThenItIsCreatedOnFirstRequestWithoutWorkerThreads) {
+    MockMemoryManager mockMemoryManager;
+    EXPECT_EQ(nullptr, mockMemoryManager.workerPool.get());
+
+    auto workerPool = mockMemoryManager.getWorkerPool();
+    ASSERT_NE(nullptr, workerPool);
+    EXPECT_EQ(0u, workerPool->getNumWorkers());
+    EXPECT_EQ(workerPool, mockMemoryManager.getWorkerPool());
+}
+
 TEST(MemoryManagerTest, givenAllocationWithNullCpuPtrThenMemoryCopyToAllocationReturnsFalse) {
     MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
     MockMemoryManager memoryManager(false, false, executionEnvironment);
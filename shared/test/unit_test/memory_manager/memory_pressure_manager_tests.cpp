@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/local_memory_usage.h"
+#include "shared/source/memory_manager/memory_pressure_manager.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+TEST(MemoryPressureManagerTests, givenRegisteredShrinkersWhenReclaimingThenShrinkersAreCalledInPriorityOrderUntilRequestedSizeIsReclaimed) {
+    MemoryPressureManager memoryPressureManager;
+    std::vector<uint32_t> callOrder;
+
+    memoryPressureManager.registerShrinker("reusable", MemoryPressureManager::ReusableAllocations, [&](uint32_t rootDeviceIndex) -> size_t {
+        callOrder.push_back(2u);
+        return 100u;
+    });
+    auto cacheShrinkerId = memoryPressureManager.registerShrinker("cache", MemoryPressureManager::CachedAllocations, [&](uint32_t rootDeviceIndex) -> size_t {
+        callOrder.push_back(1u);
+        return 50u;
+    });
+    EXPECT_EQ(2u, memoryPressureManager.getNumShrinkers());
+
+    EXPECT_EQ(50u, memoryPressureManager.reclaim(0u, 50u));
+    EXPECT_EQ(std::vector<uint32_t>({1u}), callOrder);
+
+    EXPECT_EQ(150u, memoryPressureManager.reclaim(0u, 60u));
+    EXPECT_EQ(std::vector<uint32_t>({1u, 1u, 2u}), callOrder);
+
+    auto statistics = memoryPressureManager.getStatistics();
+    ASSERT_EQ(2u, statistics.size());
+    EXPECT_EQ("cache", statistics[0].name);
+    EXPECT_EQ(2u, statistics[0].invocations);
+    EXPECT_EQ(100u, statistics[0].reclaimedBytes);
+    EXPECT_EQ("reusable", statistics[1].name);
+    EXPECT_EQ(1u, statistics[1].invocations);
+    EXPECT_EQ(100u, statistics[1].reclaimedBytes);
+
+    memoryPressureManager.unregisterShrinker(cacheShrinkerId);
+    EXPECT_EQ(1u, memoryPressureManager.getNumShrinkers());
+    EXPECT_EQ(100u, memoryPressureManager.reclaim(0u, 1u));
+}
+
+TEST(MemoryPressureManagerTests, givenReclaimOnFailureEnabledWhenAllocationFailsAndShrinkerReleasesMemoryThenAllocationIsRetried) {
+    DebugManagerStateRestore restorer;
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    MockMemoryManager memoryManager(false, true, executionEnvironment);
+    ASSERT_NE(nullptr, memoryManager.getMemoryPressureManager());
+
+    uint32_t shrinkerCalls = 0;
+    memoryManager.getMemoryPressureManager()->registerShrinker("test", MemoryPressureManager::CachedAllocations, [&](uint32_t rootDeviceIndex) -> size_t {
+        shrinkerCalls++;
+        memoryManager.failInDevicePoolWithError = false;
+        return MemoryConstants::pageSize;
+    });
+
+    memoryManager.failInDevicePoolWithError = true;
+    auto allocation = memoryManager.allocateGraphicsMemoryWithProperties({mockRootDeviceIndex, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    EXPECT_EQ(nullptr, allocation);
+    EXPECT_EQ(0u, shrinkerCalls);
+
+    DebugManager.flags.EnableMemoryPressureReclaim.set(1);
+    allocation = memoryManager.allocateGraphicsMemoryWithProperties({mockRootDeviceIndex, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    EXPECT_NE(nullptr, allocation);
+    EXPECT_EQ(1u, shrinkerCalls);
+
+    memoryManager.freeGraphicsMemory(allocation);
+}
+
+TEST(MemoryPressureManagerTests, givenLocalMemoryWatermarkPercentWhenQueriedThenOnlyValidPercentsAreReturned) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(0u, MemoryPressureManager::getLocalMemoryWatermarkPercent());
+
+    DebugManager.flags.LocalMemoryPressureWatermarkPercent.set(90);
+    EXPECT_EQ(90u, MemoryPressureManager::getLocalMemoryWatermarkPercent());
+
+    DebugManager.flags.LocalMemoryPressureWatermarkPercent.set(101);
+    EXPECT_EQ(0u, MemoryPressureManager::getLocalMemoryWatermarkPercent());
+}
+
+TEST(MemoryPressureManagerTests, givenLocalMemoryWatermarkWhenLocalMemoryUsageCrossesItThenShrinkersOfThisRootDeviceAreCalled) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.LocalMemoryPressureWatermarkPercent.set(50);
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    MockMemoryManager memoryManager(false, true, executionEnvironment);
+
+    std::vector<uint32_t> reclaimedRootDeviceIndices;
+    memoryManager.getMemoryPressureManager()->registerShrinker("test", MemoryPressureManager::CachedAllocations, [&](uint32_t rootDeviceIndex) -> size_t {
+        reclaimedRootDeviceIndices.push_back(rootDeviceIndex);
+        return 0u;
+    });
+
+    AllocationProperties properties{mockRootDeviceIndex, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield};
+    auto allocation = memoryManager.allocateGraphicsMemoryWithProperties(properties);
+    ASSERT_NE(nullptr, allocation);
+    ASSERT_TRUE(allocation->isAllocatedInLocalMemoryPool());
+    EXPECT_TRUE(reclaimedRootDeviceIndices.empty());
+
+    auto bankSelector = memoryManager.getLocalMemoryUsageBankSelector(AllocationType::BUFFER, mockRootDeviceIndex);
+    auto occupiedSize = memoryManager.getLocalMemorySize(mockRootDeviceIndex, 1u) / 2;
+    bankSelector->reserveOnBanks(1u, occupiedSize);
+
+    auto allocationAboveWatermark = memoryManager.allocateGraphicsMemoryWithProperties(properties);
+    ASSERT_NE(nullptr, allocationAboveWatermark);
+    EXPECT_EQ(std::vector<uint32_t>({mockRootDeviceIndex}), reclaimedRootDeviceIndices);
+
+    bankSelector->freeOnBanks(1u, occupiedSize);
+    memoryManager.freeGraphicsMemory(allocationAboveWatermark);
+    memoryManager.freeGraphicsMemory(allocation);
+}
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/memory_manager/memory_pressure_manager.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
@@ -79,6 +80,36 @@ TEST(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingDeviceA
     EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
 }
 
+TEST(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenReclaimingMemoryOfRootDeviceThenOnlyCachedAllocationsOfThisRootDeviceAreFreed) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(2, 1));
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    auto memoryManager = deviceFactory->rootDevices[0]->getMemoryManager();
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager, false);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+
+    void *allocations[2] = {};
+    for (uint32_t rootDeviceIndex = 0u; rootDeviceIndex < 2u; rootDeviceIndex++) {
+        RootDeviceIndicesContainer rootDeviceIndices = {rootDeviceIndex};
+        std::map<uint32_t, DeviceBitfield> deviceBitfields{{rootDeviceIndex, mockDeviceBitfield}};
+        SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, 1, rootDeviceIndices, deviceBitfields);
+        unifiedMemoryProperties.device = deviceFactory->rootDevices[rootDeviceIndex];
+        allocations[rootDeviceIndex] = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+        ASSERT_NE(nullptr, allocations[rootDeviceIndex]);
+    }
+    for (auto allocation : allocations) {
+        svmManager->freeSVMAlloc(allocation);
+    }
+    ASSERT_EQ(2u, svmManager->usmDeviceAllocationsCache.allocations.size());
+
+    EXPECT_EQ(MemoryConstants::pageSize64k, memoryManager->getMemoryPressureManager()->reclaim(1u, MemoryConstants::pageSize64k));
+    ASSERT_EQ(1u, svmManager->usmDeviceAllocationsCache.allocations.size());
+    EXPECT_EQ(allocations[0], svmManager->usmDeviceAllocationsCache.allocations[0].allocation);
+
+    svmManager->trimUSMDeviceAllocCache();
+    EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCache.allocations.size());
+}
+
 TEST(SvmDeviceAllocationCacheTest, givenAllocationsWithDifferentSizesWhenAllocatingAfterFreeThenReturnCorrectCachedAllocation) {
     std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
     RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
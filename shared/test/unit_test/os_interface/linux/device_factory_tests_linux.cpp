@@ -7,14 +7,20 @@
 
 #include "shared/test/unit_test/os_interface/linux/device_factory_tests_linux.h"
 
+#include "shared/source/ail/ail_configuration.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/source/os_interface/driver_info.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler_bind.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_driver_model.h"
 
+#include <atomic>
+#include <thread>
+
 TEST_F(DeviceFactoryLinuxTest, WhenPreparingDeviceEnvironmentsThenInitializedCorrectly) {
     const HardwareInfo *refHwinfo = defaultHwInfo.get();
 
@@ -68,6 +74,82 @@ TEST_F(DeviceFactoryLinuxTest, whenDrmIsNotCretedThenPrepareDeviceEnvironmentsFa
     EXPECT_FALSE(success);
 }
 
+TEST(DeviceFactoryLinuxParallelInitTest, givenParallelRootDeviceInitializationWhenQueryingThreadsCountThenItIsBoundedByRootDevicesCount) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(1u, DeviceFactory::getRootDeviceInitializationThreadsCount(8u));
+
+    DebugManager.flags.ParallelRootDeviceInitialization.set(4);
+    EXPECT_EQ(4u, DeviceFactory::getRootDeviceInitializationThreadsCount(8u));
+    EXPECT_EQ(2u, DeviceFactory::getRootDeviceInitializationThreadsCount(2u));
+    EXPECT_EQ(1u, DeviceFactory::getRootDeviceInitializationThreadsCount(1u));
+
+    DebugManager.flags.ParallelRootDeviceInitialization.set(1);
+    EXPECT_EQ(1u, DeviceFactory::getRootDeviceInitializationThreadsCount(8u));
+}
+
+TEST(DeviceFactoryLinuxParallelInitTest, givenParallelRootDeviceInitializationWhenPreparingDeviceEnvironmentsThenRootDevicesAreInitializedInSameOrderAsSerially) {
+    DebugManagerStateRestore restorer;
+    VariableBackup<Drm **> drmBackup{&pDrmToReturnFromCreateFunc, nullptr};
+
+    ExecutionEnvironment serialExecutionEnvironment{};
+    ASSERT_TRUE(DeviceFactory::prepareDeviceEnvironments(serialExecutionEnvironment));
+
+    DebugManager.flags.ParallelRootDeviceInitialization.set(4);
+    ExecutionEnvironment parallelExecutionEnvironment{};
+    ASSERT_TRUE(DeviceFactory::prepareDeviceEnvironments(parallelExecutionEnvironment));
+
+    ASSERT_EQ(serialExecutionEnvironment.rootDeviceEnvironments.size(), parallelExecutionEnvironment.rootDeviceEnvironments.size());
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < parallelExecutionEnvironment.rootDeviceEnvironments.size(); rootDeviceIndex++) {
+        auto &serialRootDeviceEnvironment = *serialExecutionEnvironment.rootDeviceEnvironments[rootDeviceIndex];
+        auto &parallelRootDeviceEnvironment = *parallelExecutionEnvironment.rootDeviceEnvironments[rootDeviceIndex];
+        ASSERT_NE(nullptr, parallelRootDeviceEnvironment.osInterface);
+        EXPECT_NE(nullptr, parallelRootDeviceEnvironment.memoryOperationsInterface);
+        EXPECT_NE(nullptr, parallelRootDeviceEnvironment.getGmmHelper());
+
+        auto serialBusInfo = serialRootDeviceEnvironment.osInterface->getDriverModel()->getPciBusInfo();
+        auto parallelBusInfo = parallelRootDeviceEnvironment.osInterface->getDriverModel()->getPciBusInfo();
+        EXPECT_EQ(serialBusInfo.pciBus, parallelBusInfo.pciBus);
+        EXPECT_EQ(serialBusInfo.pciDevice, parallelBusInfo.pciDevice);
+        EXPECT_EQ(serialBusInfo.pciFunction, parallelBusInfo.pciFunction);
+    }
+}
+
+TEST(DeviceFactoryLinuxParallelInitTest, givenParallelRootDeviceInitializationWhenPreparingDeviceEnvironmentsThenAilConfigurationIsNotInitializedConcurrently) {
+    struct AILConfigurationMock : AILConfiguration {
+        bool initProcessExecutableName() override {
+            auto inFlight = ++callsInFlight;
+            auto currentMax = maxCallsInFlight.load();
+            while (inFlight > currentMax && !maxCallsInFlight.compare_exchange_weak(currentMax, inFlight)) {
+            }
+            std::this_thread::yield();
+            processName = "ult";
+            calls++;
+            --callsInFlight;
+            return true;
+        }
+        void modifyKernelIfRequired(std::string &kernel) override {}
+        bool isFallbackToPatchtokensRequired(const std::string &kernelSources) override { return false; }
+        void applyExt(RuntimeCapabilityTable &runtimeCapabilityTable) override {}
+
+        std::atomic<uint32_t> callsInFlight{0};
+        std::atomic<uint32_t> maxCallsInFlight{0};
+        std::atomic<uint32_t> calls{0};
+    };
+
+    DebugManagerStateRestore restorer;
+    VariableBackup<Drm **> drmBackup{&pDrmToReturnFromCreateFunc, nullptr};
+
+    AILConfigurationMock ailConfiguration;
+    VariableBackup<AILConfiguration *> ailConfigurationBackup{&ailConfigurationTable[defaultHwInfo->platform.eProductFamily], &ailConfiguration};
+
+    DebugManager.flags.ParallelRootDeviceInitialization.set(4);
+    ExecutionEnvironment executionEnvironment{};
+    ASSERT_TRUE(DeviceFactory::prepareDeviceEnvironments(executionEnvironment));
+
+    EXPECT_EQ(executionEnvironment.rootDeviceEnvironments.size(), ailConfiguration.calls.load());
+    EXPECT_EQ(1u, ailConfiguration.maxCallsInFlight.load());
+}
+
 TEST(SortDevicesDrmTest, whenSortingDevicesThenMemoryOperationHandlersHaveProperIndices) {
     ExecutionEnvironment executionEnvironment{};
     static const auto numRootDevices = 6;
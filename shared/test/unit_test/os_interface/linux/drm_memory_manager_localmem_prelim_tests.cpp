@@ -14,6 +14,7 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/linux/allocator_helper.h"
 #include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/worker_pool.h"
 #include "shared/test/common/helpers/batch_buffer_helper.h"
 #include "shared/test/common/libult/linux/drm_mock_helper.h"
 #include "shared/test/common/libult/linux/drm_mock_prelim_context.h"
@@ -1564,6 +1565,78 @@ TEST_F(DrmMemoryManagerLocalMemoryPrelimTest, givenChunkSizeBasedColouringPolicy
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryManagerLocalMemoryPrelimTest, givenParallelBoCreationThresholdWhenAllocatingInDevicePoolOnAllMemoryBanksThenBufferObjectsAreCreatedInOrderOfHandles) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelBoCreationThresholdInMb.set(0);
+    // the drm mock is not thread safe, keep creations on the calling thread
+    memoryManager->workerPool.reset(new WorkerPool(0u));
+
+    MemoryManager::AllocationStatus status = MemoryManager::AllocationStatus::Success;
+    AllocationData allocData;
+    allocData.allFlags = 0;
+    allocData.size = 18 * MemoryConstants::pageSize64k;
+    allocData.flags.allocateMemory = true;
+    allocData.type = AllocationType::BUFFER;
+    allocData.storageInfo.memoryBanks = maxNBitValue(MemoryBanks::getBankForLocalMemory(3));
+    allocData.storageInfo.multiStorage = true;
+    allocData.rootDeviceIndex = rootDeviceIndex;
+    allocData.storageInfo.colouringPolicy = ColouringPolicy::ChunkSizeBased;
+    allocData.storageInfo.colouringGranularity = 256 * MemoryConstants::kiloByte;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryInDevicePool(allocData, status);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(MemoryManager::AllocationStatus::Success, status);
+
+    auto drmAllocation = static_cast<DrmAllocation *>(allocation);
+    auto numHandles = static_cast<uint32_t>(alignUp(allocData.size, allocation->storageInfo.colouringGranularity) / allocation->storageInfo.colouringGranularity);
+    EXPECT_TRUE(memoryManager->isParallelBoCreationAllowed(drmAllocation, numHandles));
+    EXPECT_EQ(numHandles, drmAllocation->getBOs().size());
+
+    auto &bos = drmAllocation->getBOs();
+    auto boAddress = drmAllocation->getGpuAddress();
+    for (auto handleId = 0u; handleId < numHandles; handleId++) {
+        auto bo = bos[handleId];
+        ASSERT_NE(nullptr, bo);
+        EXPECT_EQ(boAddress, bo->peekAddress());
+        boAddress += bo->peekSize();
+    }
+
+    DebugManager.flags.ParallelBoCreationThresholdInMb.set(-1);
+    EXPECT_FALSE(memoryManager->isParallelBoCreationAllowed(drmAllocation, numHandles));
+    DebugManager.flags.ParallelBoCreationThresholdInMb.set(2);
+    EXPECT_FALSE(memoryManager->isParallelBoCreationAllowed(drmAllocation, numHandles));
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryPrelimTest, givenParallelBoCreationWhenOneBufferObjectCreationFailsThenAllocationFailsAndCreatedBufferObjectsAreReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelBoCreationThresholdInMb.set(0);
+    // a pool without workers creates buffer objects in order of handles, so the failing one is deterministic
+    memoryManager->workerPool.reset(new WorkerPool(0u));
+
+    MemoryManager::AllocationStatus status = MemoryManager::AllocationStatus::Success;
+    AllocationData allocData;
+    allocData.allFlags = 0;
+    allocData.size = 18 * MemoryConstants::pageSize64k;
+    allocData.flags.allocateMemory = true;
+    allocData.type = AllocationType::BUFFER;
+    allocData.storageInfo.memoryBanks = maxNBitValue(MemoryBanks::getBankForLocalMemory(3));
+    allocData.storageInfo.multiStorage = true;
+    allocData.rootDeviceIndex = rootDeviceIndex;
+    allocData.storageInfo.colouringPolicy = ColouringPolicy::ChunkSizeBased;
+    allocData.storageInfo.colouringGranularity = 256 * MemoryConstants::kiloByte;
+
+    constexpr uint32_t numBufferObjectsCreated = 2u;
+    mock->context.gemCreateExtSuccessCount = numBufferObjectsCreated;
+    memoryManager->unreferenceCalled = 0u;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryInDevicePool(allocData, status);
+    EXPECT_EQ(nullptr, allocation);
+    EXPECT_EQ(MemoryManager::AllocationStatus::Error, status);
+    EXPECT_EQ(numBufferObjectsCreated, memoryManager->unreferenceCalled);
+}
+
 TEST_F(DrmMemoryManagerLocalMemoryPrelimTest, givenMappingBasedColouringPolicyWhenAllocatingInDevicePoolOnAllMemoryBanksThenSetBindAddressesToBufferObjects) {
     MemoryManager::AllocationStatus status = MemoryManager::AllocationStatus::Success;
     AllocationData allocData;
@@ -26,11 +26,14 @@
 #include "shared/test/common/mocks/mock_gmm.h"
 #include "shared/test/common/os_interface/linux/drm_memory_manager_fixture.h"
 #include "shared/test/common/os_interface/linux/drm_mock_memory_info.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
 #include "shared/test/common/test_macros/hw_test.h"
 #include "shared/test/unit_test/os_interface/linux/drm_mock_impl.h"
 
 #include "gtest/gtest.h"
 
+#include <linux/mempolicy.h>
+
 namespace NEO {
 
 class DrmMemoryManagerFixtureImpl : public DrmMemoryManagerFixture {
@@ -1036,6 +1039,35 @@ HWTEST2_F(DrmMemoryManagerLocalMemoryTest, givenAlignmentAndSizeWhenMmapReturnsA
     munmapCalledCount = 0u;
 }
 
+HWTEST2_F(DrmMemoryManagerLocalMemoryTest, givenDeviceNumaNodeWhenHostMemoryIsCreatedWithAlignmentThenBufferObjectIsNotMmapedAndUserptrMemoryIsBound, NonDefaultIoctlsSupported) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBOMmapCreate.set(-1);
+    VariableBackup<uint32_t> mbindCalledBackup(&SysCalls::mbindFuncCalled, 0u);
+
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+
+    mock->memoryInfo.reset(new MemoryInfo(regionInfo, *mock));
+    mock->ioctlCallsCount = 0;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize64k;
+    allocationData.flags.isUSMHostAllocation = true;
+    allocationData.useMmapObject = true;
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = 1;
+
+    auto allocation = memoryManager->createAllocWithAlignment(allocationData, MemoryConstants::pageSize64k, MemoryConstants::pageSize64k, MemoryConstants::pageSize64k, 0u);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(nullptr, allocation->getMmapPtr());
+    EXPECT_FALSE(allocation->isShareableHostMemory);
+    EXPECT_EQ(1u, SysCalls::mbindFuncCalled);
+    EXPECT_EQ(MPOL_PREFERRED, SysCalls::mbindModePassed);
+    EXPECT_EQ(1ul << 1, SysCalls::mbindNodeMaskPassed);
+    EXPECT_EQ(1u, memoryManager->getNumaPlacementStatistics().placedOnDeviceNode);
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 TEST_F(DrmMemoryManagerLocalMemoryTest, givenAllocationWithInvalidCacheRegionWhenAllocatingInDevicePoolThenReturnNullptr) {
     MemoryManager::AllocationStatus status = MemoryManager::AllocationStatus::Success;
     AllocationData allocData;
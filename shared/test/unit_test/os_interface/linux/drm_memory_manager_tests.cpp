@@ -38,7 +38,9 @@
 
 #include <array>
 #include <fcntl.h>
+#include <linux/mempolicy.h>
 #include <memory>
+#include <thread>
 #include <vector>
 
 namespace {
@@ -1344,6 +1346,60 @@ TEST_F(DrmMemoryManagerTest, WhenNullOsHandleStorageAskedForPopulationThenFilled
     memoryManager->cleanOsHandles(storage, rootDeviceIndex);
 }
 
+TEST_F(DrmMemoryManagerTest, givenUserptrCacheWhenSameFragmentIsPopulatedAgainAfterCleanThenCachedBufferObjectIsReused) {
+    mock->ioctlExpected.gemUserptr = 1;
+    mock->ioctlExpected.gemWait = 1;
+    mock->ioctlExpected.gemClose = 1;
+    memoryManager->userptrCache = std::make_unique<DrmUserptrCache>(DrmUserptrCache::defaultMaxEntries);
+
+    OsHandleStorage storage;
+    storage.fragmentStorageData[0].cpuPtr = reinterpret_cast<void *>(0x1000);
+    storage.fragmentStorageData[0].fragmentSize = MemoryConstants::pageSize;
+    EXPECT_EQ(MemoryManager::AllocationStatus::Success, memoryManager->populateOsHandles(storage, rootDeviceIndex));
+    auto bo = static_cast<OsHandleLinux *>(storage.fragmentStorageData[0].osHandleStorage)->bo;
+    ASSERT_NE(nullptr, bo);
+    memoryManager->getHostPtrManager()->releaseHandleStorage(rootDeviceIndex, storage);
+    memoryManager->cleanOsHandles(storage, rootDeviceIndex);
+    EXPECT_EQ(1u, memoryManager->userptrCache->getNumEntries());
+
+    OsHandleStorage storage2;
+    storage2.fragmentStorageData[0].cpuPtr = reinterpret_cast<void *>(0x1000);
+    storage2.fragmentStorageData[0].fragmentSize = MemoryConstants::pageSize;
+    EXPECT_EQ(MemoryManager::AllocationStatus::Success, memoryManager->populateOsHandles(storage2, rootDeviceIndex));
+    EXPECT_EQ(bo, static_cast<OsHandleLinux *>(storage2.fragmentStorageData[0].osHandleStorage)->bo);
+    EXPECT_EQ(0u, memoryManager->userptrCache->getNumEntries());
+    memoryManager->getHostPtrManager()->releaseHandleStorage(rootDeviceIndex, storage2);
+    memoryManager->cleanOsHandles(storage2, rootDeviceIndex);
+
+    auto statistics = memoryManager->userptrCache->getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+
+    memoryManager->invalidateHostPtrCache(reinterpret_cast<void *>(0x1000), 1);
+    EXPECT_EQ(0u, memoryManager->userptrCache->getNumEntries());
+    EXPECT_EQ(1u, memoryManager->userptrCache->getStatistics().invalidations);
+}
+
+TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenEnableUserptrBoCacheFlagWhenMemoryManagerIsCreatedThenUserptrCacheIsCreatedWithRequestedSize) {
+    DebugManagerStateRestore restorer;
+    {
+        TestedDrmMemoryManager memoryManager(false, false, false, *executionEnvironment);
+        EXPECT_EQ(nullptr, memoryManager.userptrCache.get());
+    }
+
+    DebugManager.flags.EnableUserptrBoCache.set(1);
+    {
+        TestedDrmMemoryManager memoryManager(false, false, false, *executionEnvironment);
+        ASSERT_NE(nullptr, memoryManager.userptrCache.get());
+        EXPECT_EQ(DrmUserptrCache::defaultMaxEntries, memoryManager.userptrCache->getMaxEntries());
+    }
+
+    DebugManager.flags.UserptrBoCacheMaxEntries.set(3);
+    TestedDrmMemoryManager memoryManager(false, false, false, *executionEnvironment);
+    ASSERT_NE(nullptr, memoryManager.userptrCache.get());
+    EXPECT_EQ(3u, memoryManager.userptrCache->getMaxEntries());
+}
+
 TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenEnabledHostMemoryValidationWhenReadOnlyPointerCausesPinningFailWithEfaultThenPopulateOsHandlesReturnsInvalidHostPointerError) {
     std::unique_ptr<TestedDrmMemoryManager> memoryManager(new (std::nothrow) TestedDrmMemoryManager(false,
                                                                                                     false,
@@ -2260,6 +2316,159 @@ TEST_F(DrmMemoryManagerTest, givenDrmMemoryManagerWhenLockUnlockIsCalledButFails
     mock->ioctlResExt = &mock->none;
 }
 
+TEST_F(DrmMemoryManagerTest, givenPersistentLockMappingsWhenLocalMemoryAllocationIsLockedRepeatedlyThenMappingAndMmapOffsetAreReused) {
+    mock->ioctlExpected.gemMmapOffset = 1;
+    mock->ioctlExpected.gemWait = 1;
+    mock->ioctlExpected.gemClose = 1;
+    mock->mmapOffsetExpected = 0x1000;
+    memoryManager->persistentMappingsBudget = MemoryConstants::megaByte;
+
+    auto bo = new BufferObject(rootDeviceIndex, mock, 3, 1, MemoryConstants::pageSize, 1);
+    auto drmAllocation = new DrmAllocation(rootDeviceIndex, AllocationType::BUFFER, bo, nullptr, 0u, static_cast<osHandle>(0u), MemoryPool::LocalMemory);
+
+    auto mmapCalledBefore = SysCalls::mmapFuncCalled;
+    auto munmapCalledBefore = SysCalls::munmapFuncCalled;
+
+    auto ptr = memoryManager->lockResource(drmAllocation);
+    ASSERT_NE(nullptr, ptr);
+    memoryManager->unlockResource(drmAllocation);
+    EXPECT_EQ(ptr, bo->peekLockedAddress());
+    EXPECT_NE(0u, bo->peekLockMmapOffset());
+    EXPECT_EQ(MemoryConstants::pageSize, memoryManager->persistentMappingsSize);
+
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(ptr, memoryManager->lockResource(drmAllocation));
+        EXPECT_EQ(0u, memoryManager->persistentMappingsSize);
+        memoryManager->unlockResource(drmAllocation);
+    }
+    EXPECT_EQ(mmapCalledBefore + 1, SysCalls::mmapFuncCalled);
+    EXPECT_EQ(munmapCalledBefore, SysCalls::munmapFuncCalled);
+
+    memoryManager->freeGraphicsMemory(drmAllocation);
+    EXPECT_EQ(munmapCalledBefore + 1, SysCalls::munmapFuncCalled);
+    EXPECT_TRUE(memoryManager->persistentMappings.empty());
+    EXPECT_TRUE(memoryManager->persistentMappingPositions.empty());
+    EXPECT_EQ(0u, memoryManager->persistentMappingsSize);
+}
+
+TEST_F(DrmMemoryManagerTest, givenPersistentLockMappingsOverBudgetWhenUnlockingThenLeastRecentlyUnlockedMappingIsUnmapped) {
+    mock->ioctlExpected.gemMmapOffset = 2;
+    mock->ioctlExpected.gemWait = 2;
+    mock->ioctlExpected.gemClose = 2;
+    mock->mmapOffsetExpected = 0x1000;
+    memoryManager->persistentMappingsBudget = MemoryConstants::pageSize;
+
+    auto bo0 = new BufferObject(rootDeviceIndex, mock, 3, 1, MemoryConstants::pageSize, 1);
+    auto bo1 = new BufferObject(rootDeviceIndex, mock, 3, 2, MemoryConstants::pageSize, 1);
+    auto allocation0 = new DrmAllocation(rootDeviceIndex, AllocationType::BUFFER, bo0, nullptr, 0u, static_cast<osHandle>(0u), MemoryPool::LocalMemory);
+    auto allocation1 = new DrmAllocation(rootDeviceIndex, AllocationType::BUFFER, bo1, nullptr, 0u, static_cast<osHandle>(0u), MemoryPool::LocalMemory);
+
+    auto munmapCalledBefore = SysCalls::munmapFuncCalled;
+
+    EXPECT_NE(nullptr, memoryManager->lockResource(allocation0));
+    EXPECT_NE(nullptr, memoryManager->lockResource(allocation1));
+    memoryManager->unlockResource(allocation0);
+    memoryManager->unlockResource(allocation1);
+
+    EXPECT_EQ(munmapCalledBefore + 1, SysCalls::munmapFuncCalled);
+    EXPECT_EQ(nullptr, bo0->peekLockedAddress());
+    EXPECT_NE(nullptr, bo1->peekLockedAddress());
+    ASSERT_EQ(1u, memoryManager->persistentMappings.size());
+    EXPECT_EQ(bo1, memoryManager->persistentMappings.front());
+
+    auto mmapCalledBefore = SysCalls::mmapFuncCalled;
+    EXPECT_NE(nullptr, memoryManager->lockResource(allocation0));
+    memoryManager->unlockResource(allocation0);
+    EXPECT_EQ(mmapCalledBefore + 1, SysCalls::mmapFuncCalled);
+    EXPECT_EQ(munmapCalledBefore + 2, SysCalls::munmapFuncCalled);
+    EXPECT_EQ(nullptr, bo1->peekLockedAddress());
+
+    memoryManager->freeGraphicsMemory(allocation0);
+    memoryManager->freeGraphicsMemory(allocation1);
+    EXPECT_EQ(munmapCalledBefore + 3, SysCalls::munmapFuncCalled);
+}
+
+namespace {
+BufferObject *evictedBo = nullptr;
+void *evictedBoLockedAddressDuringMunmap = nullptr;
+void *munmappedAddress = nullptr;
+size_t munmappedSize = 0;
+} // namespace
+
+TEST_F(DrmMemoryManagerTest, givenPersistentLockMappingsOverBudgetWhenMappingIsEvictedThenBufferObjectIsDetachedBeforeRecordedRangeIsUnmapped) {
+    mock->ioctlExpected.gemMmapOffset = 2;
+    mock->ioctlExpected.gemWait = 2;
+    mock->ioctlExpected.gemClose = 2;
+    mock->mmapOffsetExpected = 0x1000;
+    memoryManager->persistentMappingsBudget = MemoryConstants::pageSize;
+
+    auto bo0 = new BufferObject(rootDeviceIndex, mock, 3, 1, MemoryConstants::pageSize, 1);
+    auto bo1 = new BufferObject(rootDeviceIndex, mock, 3, 2, MemoryConstants::pageSize, 1);
+    auto allocation0 = new DrmAllocation(rootDeviceIndex, AllocationType::BUFFER, bo0, nullptr, 0u, static_cast<osHandle>(0u), MemoryPool::LocalMemory);
+    auto allocation1 = new DrmAllocation(rootDeviceIndex, AllocationType::BUFFER, bo1, nullptr, 0u, static_cast<osHandle>(0u), MemoryPool::LocalMemory);
+
+    auto bo0Address = memoryManager->lockResource(allocation0);
+    EXPECT_NE(nullptr, bo0Address);
+    EXPECT_NE(nullptr, memoryManager->lockResource(allocation1));
+    memoryManager->unlockResource(allocation0);
+
+    evictedBo = bo0;
+    evictedBoLockedAddressDuringMunmap = reinterpret_cast<void *>(0x1);
+    munmappedAddress = nullptr;
+    munmappedSize = 0;
+    memoryManager->munmapFunction = [](void *addr, size_t len) throw() {
+        evictedBoLockedAddressDuringMunmap = evictedBo->peekLockedAddress();
+        munmappedAddress = addr;
+        munmappedSize = len;
+        return SysCalls::munmap(addr, len);
+    };
+
+    memoryManager->unlockResource(allocation1);
+    memoryManager->munmapFunction = SysCalls::munmap;
+
+    EXPECT_EQ(nullptr, evictedBoLockedAddressDuringMunmap);
+    EXPECT_EQ(bo0Address, munmappedAddress);
+    EXPECT_EQ(MemoryConstants::pageSize, munmappedSize);
+    EXPECT_EQ(nullptr, bo0->peekLockedAddress());
+    EXPECT_EQ(1u, memoryManager->persistentMappings.size());
+
+    memoryManager->freeGraphicsMemory(allocation0);
+    memoryManager->freeGraphicsMemory(allocation1);
+    evictedBo = nullptr;
+}
+
+TEST_F(DrmMemoryManagerTest, givenPersistentLockMappingsWhenSystemMemoryAllocationIsUnlockedThenMappingIsReleased) {
+    mock->ioctlExpected.gemMmapOffset = 1;
+    memoryManager->persistentMappingsBudget = MemoryConstants::megaByte;
+
+    BufferObject bo(rootDeviceIndex, mock, 3, 1, MemoryConstants::pageSize, 1);
+    DrmAllocation drmAllocation(rootDeviceIndex, AllocationType::BUFFER, &bo, nullptr, 0u, static_cast<osHandle>(0u), MemoryPool::System4KBPages);
+
+    EXPECT_NE(nullptr, memoryManager->lockResource(&drmAllocation));
+    memoryManager->unlockResource(&drmAllocation);
+
+    EXPECT_EQ(nullptr, bo.peekLockedAddress());
+    EXPECT_TRUE(memoryManager->persistentMappings.empty());
+}
+
+TEST_F(DrmMemoryManagerTest, givenEnablePersistentLockMappingsFlagWhenMemoryManagerIsCreatedThenBudgetIsSet) {
+    DebugManagerStateRestore restorer;
+    {
+        TestedDrmMemoryManager memoryManager(false, false, false, *executionEnvironment);
+        EXPECT_EQ(0u, memoryManager.persistentMappingsBudget);
+    }
+
+    DebugManager.flags.EnablePersistentLockMappings.set(1);
+    {
+        TestedDrmMemoryManager memoryManager(false, false, false, *executionEnvironment);
+        EXPECT_EQ(256 * MemoryConstants::megaByte, memoryManager.persistentMappingsBudget);
+    }
+
+    DebugManager.flags.PersistentLockMappingsBudgetInMb.set(3);
+    TestedDrmMemoryManager memoryManager(false, false, false, *executionEnvironment);
+    EXPECT_EQ(3 * MemoryConstants::megaByte, memoryManager.persistentMappingsBudget);
+}
+
 TEST_F(DrmMemoryManagerTest, givenDrmMemoryManagerWhenUnlockResourceIsCalledOnAllocationInLocalMemoryThenRedirectToUnlockResourceInLocalMemory) {
     struct DrmMemoryManagerToTestUnlockResource : public DrmMemoryManager {
         using DrmMemoryManager::unlockResourceImpl;
@@ -4417,6 +4626,185 @@ HWTEST_F(DrmMemoryManagerTest, givenDrmAllocationWithWithAlignmentFromUserptrWhe
     EXPECT_EQ(allocation, nullptr);
 }
 
+TEST_F(DrmMemoryManagerTest, givenDeviceNumaNodeWhenAllocatingHostMemoryFromUserptrThenMemoryIsBoundToDeviceNodeOrRequestedNode) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HostHugeTlbPageSizeInMb.set(2);
+    mock->ioctlExpected.total = -1;
+    VariableBackup<uint32_t> mbindCalledBackup(&SysCalls::mbindFuncCalled, 0u);
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = 1;
+
+    auto size = MemoryConstants::pageSize2Mb;
+    allocationData.size = size;
+    allocationData.type = AllocationType::COMMAND_BUFFER;
+    auto allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, size, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(1u, SysCalls::mbindFuncCalled);
+    EXPECT_EQ(MPOL_PREFERRED, SysCalls::mbindModePassed);
+    EXPECT_EQ(1ul << 1, SysCalls::mbindNodeMaskPassed);
+    memoryManager->freeGraphicsMemory(allocation);
+
+    allocationData.numaNode = 3;
+    allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, size, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(2u, SysCalls::mbindFuncCalled);
+    EXPECT_EQ(1ul << 3, SysCalls::mbindNodeMaskPassed);
+    memoryManager->freeGraphicsMemory(allocation);
+
+    allocationData.numaNode = -1;
+    allocationData.type = AllocationType::BUFFER;
+    allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, size, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(2u, SysCalls::mbindFuncCalled);
+    memoryManager->freeGraphicsMemory(allocation);
+
+    auto statistics = memoryManager->getNumaPlacementStatistics();
+    EXPECT_EQ(1u, statistics.placedOnDeviceNode);
+    EXPECT_EQ(1u, statistics.placedOnRequestedNode);
+    EXPECT_EQ(0u, statistics.failed);
+}
+
+TEST_F(DrmMemoryManagerTest, givenDeviceNumaNodeWhenHostMemoryFromUserptrIsAllocatedWithoutHugeTlbThenDedicatedMappingIsBound) {
+    mock->ioctlExpected.total = -1;
+    VariableBackup<uint32_t> mbindCalledBackup(&SysCalls::mbindFuncCalled, 0u);
+    VariableBackup<uint32_t> mmapCalledBackup(&SysCalls::mmapFuncCalled, 0u);
+    VariableBackup<uint32_t> munmapCalledBackup(&SysCalls::munmapFuncCalled, 0u);
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = 1;
+
+    auto size = MemoryConstants::pageSize;
+    allocationData.size = size;
+    allocationData.type = AllocationType::COMMAND_BUFFER;
+    auto allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, size, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(nullptr, allocation->getDriverAllocatedCpuPtr());
+    EXPECT_EQ(1u, SysCalls::mmapFuncCalled);
+    EXPECT_EQ(1u, SysCalls::mbindFuncCalled);
+    EXPECT_EQ(1u, memoryManager->getNumaPlacementStatistics().placedOnDeviceNode);
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, SysCalls::munmapFuncCalled);
+}
+
+TEST_F(DrmMemoryManagerTest, givenNoNumaPlacementWhenHostMemoryFromUserptrIsAllocatedWithoutHugeTlbThenMallocHeapIsUsedAndNotBound) {
+    mock->ioctlExpected.total = -1;
+    VariableBackup<uint32_t> mbindCalledBackup(&SysCalls::mbindFuncCalled, 0u);
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = -1;
+
+    auto size = MemoryConstants::pageSize;
+    allocationData.size = size;
+    allocationData.type = AllocationType::COMMAND_BUFFER;
+    auto allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, size, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_NE(nullptr, allocation->getDriverAllocatedCpuPtr());
+    EXPECT_EQ(0u, SysCalls::mbindFuncCalled);
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenNumaPlacementWhenBindingFailsOrNodeIsUnknownThenAllocationIsNotBoundAndFailureIsCounted) {
+    VariableBackup<uint32_t> mbindCalledBackup(&SysCalls::mbindFuncCalled, 0u);
+    VariableBackup<long> mbindRetValBackup(&SysCalls::mbindFuncRetVal, -1);
+
+    allocationData.flags.isUSMHostAllocation = true;
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = -1;
+    EXPECT_EQ(-1, memoryManager->getPreferredNumaNode(allocationData));
+
+    memoryManager->deviceNumaNodes[rootDeviceIndex] = 0;
+    EXPECT_EQ(0, memoryManager->getPreferredNumaNode(allocationData));
+
+    auto ptr = alignedMalloc(MemoryConstants::pageSize, MemoryConstants::pageSize);
+    memoryManager->applyNumaPlacement(allocationData, ptr, MemoryConstants::pageSize);
+    EXPECT_EQ(1u, SysCalls::mbindFuncCalled);
+
+    allocationData.numaNode = 64;
+    memoryManager->applyNumaPlacement(allocationData, ptr, MemoryConstants::pageSize);
+    EXPECT_EQ(1u, SysCalls::mbindFuncCalled);
+    alignedFree(ptr);
+
+    auto statistics = memoryManager->getNumaPlacementStatistics();
+    EXPECT_EQ(0u, statistics.placedOnDeviceNode);
+    EXPECT_EQ(0u, statistics.placedOnRequestedNode);
+    EXPECT_EQ(2u, statistics.failed);
+}
+
+namespace {
+uint32_t madviseCalled = 0u;
+int madviseAdvicePassed = 0;
+} // namespace
+
+TEST_F(DrmMemoryManagerTest, givenTransparentHugePagesEnabledWhenAllocatingHostMemoryFromUserptrThenOnlyLargeAllocationsAreAdvised) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHostTransparentHugePages.set(1);
+    mock->ioctlExpected.total = -1;
+
+    VariableBackup<uint32_t> madviseCalledBackup(&madviseCalled, 0u);
+    memoryManager->madviseFunction = [](void *addr, size_t len, int advice) throw() {
+        madviseCalled++;
+        madviseAdvicePassed = advice;
+        return 0;
+    };
+
+    allocationData.size = MemoryConstants::pageSize;
+    auto allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, MemoryConstants::pageSize, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(0u, madviseCalled);
+    memoryManager->freeGraphicsMemory(allocation);
+
+    allocationData.size = MemoryConstants::pageSize2Mb;
+    allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, MemoryConstants::pageSize2Mb, MemoryConstants::pageSize2Mb, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(1u, madviseCalled);
+    EXPECT_EQ(MADV_HUGEPAGE, madviseAdvicePassed);
+    EXPECT_NE(nullptr, allocation->getDriverAllocatedCpuPtr());
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenHugeTlbPageSizeWhenAllocatingHostMemoryFromUserptrThenHugeTlbMappingIsUsedAndRegularPagesAreUsedWhenMappingFails) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HostHugeTlbPageSizeInMb.set(2);
+    mock->ioctlExpected.total = -1;
+
+    VariableBackup<uint32_t> mmapCalledBackup(&SysCalls::mmapFuncCalled, 0u);
+    VariableBackup<uint32_t> munmapCalledBackup(&SysCalls::munmapFuncCalled, 0u);
+
+    allocationData.size = MemoryConstants::pageSize2Mb;
+    auto allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, MemoryConstants::pageSize2Mb, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(1u, SysCalls::mmapFuncCalled);
+    EXPECT_EQ(nullptr, allocation->getDriverAllocatedCpuPtr());
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, SysCalls::munmapFuncCalled);
+
+    VariableBackup<bool> failMmapBackup(&SysCalls::failMmap, true);
+    allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, MemoryConstants::pageSize2Mb, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(2u, SysCalls::mmapFuncCalled);
+    EXPECT_NE(nullptr, allocation->getDriverAllocatedCpuPtr());
+    memoryManager->freeGraphicsMemory(allocation);
+
+    allocationData.size = MemoryConstants::pageSize;
+    allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, MemoryConstants::pageSize, MemoryConstants::pageSize, 0, 0x1000);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(2u, SysCalls::mmapFuncCalled);
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+HWTEST_F(DrmMemoryManagerTest, givenHugeTlbMappingWhenAllocationFromUserptrIsCreatedWithIncorrectCacheRegionThenNullIsReturnedAndMappingIsReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HostHugeTlbPageSizeInMb.set(2);
+    mock->ioctlExpected.total = -1;
+    auto drm = static_cast<DrmMockCustom *>(executionEnvironment->rootDeviceEnvironments[rootDeviceIndex]->osInterface->getDriverModel()->as<Drm>());
+    drm->setupCacheInfo(*defaultHwInfo.get());
+
+    VariableBackup<uint32_t> mmapCalledBackup(&SysCalls::mmapFuncCalled, 0u);
+    VariableBackup<uint32_t> munmapCalledBackup(&SysCalls::munmapFuncCalled, 0u);
+
+    allocationData.size = MemoryConstants::pageSize2Mb;
+    allocationData.cacheRegion = 0xFFFF;
+
+    auto allocation = memoryManager->createAllocWithAlignmentFromUserptr(allocationData, MemoryConstants::pageSize2Mb, MemoryConstants::pageSize, 0, 0x1000);
+    EXPECT_EQ(nullptr, allocation);
+    EXPECT_EQ(1u, SysCalls::mmapFuncCalled);
+    EXPECT_EQ(1u, SysCalls::munmapFuncCalled);
+}
+
 TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenAllocateGraphicsMemoryWithPropertiesCalledWithDebugSurfaceTypeThenDebugSurfaceIsCreated) {
     AllocationProperties debugSurfaceProperties{0, true, MemoryConstants::pageSize, NEO::AllocationType::DEBUG_CONTEXT_SAVE_AREA, false, false, 0b1011};
     auto debugSurface = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithProperties(debugSurfaceProperties));
@@ -6604,6 +6992,57 @@ TEST_F(DrmMemoryManagerTest, givenMakeBosResidentSuccessWhenRegisteringMemoryAll
     EXPECT_EQ(MemoryManager::AllocationStatus::Success, memoryManager->registerLocalMemAlloc(&allocation, 0));
 }
 
+TEST_F(DrmMemoryManagerTest, givenAllocationsRegisteredAndUnregisteredFromMultipleThreadsThenRegisteredAllocationListsStayConsistent) {
+    constexpr size_t numThreads = 4;
+    constexpr size_t allocationsPerThread = 64;
+
+    std::vector<std::unique_ptr<MockDrmAllocation>> allocations;
+    for (size_t i = 0; i < numThreads * allocationsPerThread; i++) {
+        allocations.push_back(std::make_unique<MockDrmAllocation>(rootDeviceIndex, AllocationType::BUFFER, MemoryPool::System4KBPages));
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < allocationsPerThread; i++) {
+                auto allocation = allocations[t * allocationsPerThread + i].get();
+                if (i % 2) {
+                    memoryManager->registerSysMemAlloc(allocation);
+                } else {
+                    memoryManager->registerLocalMemAlloc(allocation, rootDeviceIndex);
+                }
+            }
+            for (size_t i = 0; i < allocationsPerThread; i += 4) {
+                memoryManager->unregisterAllocation(allocations[t * allocationsPerThread + i].get());
+                memoryManager->unregisterAllocation(allocations[t * allocationsPerThread + i + 1].get());
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    auto &sysMemAllocs = memoryManager->getSysMemAllocs();
+    auto &localMemAllocs = memoryManager->getLocalMemAllocs(rootDeviceIndex);
+    EXPECT_EQ(numThreads * allocationsPerThread / 4, sysMemAllocs.size());
+    EXPECT_EQ(numThreads * allocationsPerThread / 4, localMemAllocs.size());
+
+    for (size_t i = 0; i < allocations.size(); i++) {
+        auto allocation = allocations[i].get();
+        bool removed = (i % allocationsPerThread) % 4 < 2;
+        auto &expectedList = (i % 2) ? sysMemAllocs : localMemAllocs;
+        auto &otherList = (i % 2) ? localMemAllocs : sysMemAllocs;
+        EXPECT_EQ(removed ? 0 : 1, std::count(expectedList.begin(), expectedList.end(), allocation));
+        EXPECT_EQ(0, std::count(otherList.begin(), otherList.end(), allocation));
+    }
+
+    for (auto &allocation : allocations) {
+        memoryManager->unregisterAllocation(allocation.get());
+    }
+    EXPECT_TRUE(sysMemAllocs.empty());
+    EXPECT_TRUE(localMemAllocs.empty());
+}
+
 TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenDrmMemoryManagerWhenGpuAddressReservationIsAttemptedWithKnownAddressAtIndex1ThenAddressFromGfxPartitionIsUsed) {
     auto memoryManager = std::make_unique<TestedDrmMemoryManager>(false, true, false, *executionEnvironment);
     RootDeviceIndicesContainer rootDeviceIndices;
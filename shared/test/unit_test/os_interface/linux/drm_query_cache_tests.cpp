@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_query_cache.h"
+#include "shared/source/os_interface/linux/os_inc.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/libult/linux/drm_mock.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace NEO;
+
+TEST(DrmQueryCacheTest, givenDifferentKeysWhenCreatingCacheThenFilePathsDifferAndAreInCacheDir) {
+    DrmQueryCache cache("cacheDir", "0000:03:00.0|3000|8|i915|6.2.0|2.0|1.0");
+    DrmQueryCache otherCache("cacheDir", "0000:03:00.0|3000|8|i915|6.3.0|2.0|1.0");
+
+    EXPECT_EQ(0u, cache.getFilePath().find("cacheDir/"));
+    EXPECT_NE(cache.getFilePath(), otherCache.getFilePath());
+}
+
+TEST(DrmQueryCacheTest, givenStoredQueriesWhenDeserializingSerializedDataThenSameQueriesAreFound) {
+    DrmQueryCache cache("cacheDir", "key");
+    EXPECT_FALSE(cache.isDirty());
+
+    cache.store(1u, 0u, {1, 2, 3});
+    cache.store(2u, 0x101u, {4});
+    EXPECT_TRUE(cache.isDirty());
+    auto fileData = cache.serialize();
+
+    DrmQueryCache loadedCache("cacheDir", "key");
+    EXPECT_TRUE(loadedCache.deserialize(fileData.data(), fileData.size()));
+    EXPECT_FALSE(loadedCache.isDirty());
+    EXPECT_EQ(2u, loadedCache.getNumEntries());
+
+    std::vector<uint8_t> data;
+    EXPECT_TRUE(loadedCache.find(1u, 0u, data));
+    EXPECT_EQ(std::vector<uint8_t>({1, 2, 3}), data);
+    EXPECT_TRUE(loadedCache.find(2u, 0x101u, data));
+    EXPECT_EQ(std::vector<uint8_t>({4}), data);
+    EXPECT_FALSE(loadedCache.find(2u, 0u, data));
+}
+
+TEST(DrmQueryCacheTest, givenDataOfOtherKeyOrTruncatedDataWhenDeserializingThenItIsRejected) {
+    DrmQueryCache cache("cacheDir", "key");
+    cache.store(1u, 0u, {1, 2, 3});
+    auto fileData = cache.serialize();
+
+    DrmQueryCache otherKeyCache("cacheDir", "otherKey");
+    EXPECT_FALSE(otherKeyCache.deserialize(fileData.data(), fileData.size()));
+    EXPECT_EQ(0u, otherKeyCache.getNumEntries());
+
+    DrmQueryCache truncatedCache("cacheDir", "key");
+    EXPECT_FALSE(truncatedCache.deserialize(fileData.data(), fileData.size() - 1));
+    EXPECT_FALSE(truncatedCache.deserialize(fileData.data(), 4u));
+    EXPECT_EQ(0u, truncatedCache.getNumEntries());
+}
+
+TEST(DrmQueryCacheTest, givenDirtyCacheWhenSavingThenTemporaryFileIsRenamedToCacheFile) {
+    VariableBackup<decltype(SysCalls::renameCalled)> renameCalledBackup(&SysCalls::renameCalled, 0);
+    static std::string renamedTo;
+    VariableBackup<decltype(SysCalls::sysCallsRename)> renameBackup(&SysCalls::sysCallsRename, [](const char *currName, const char *dstName) -> int {
+        renamedTo = dstName;
+        return 0;
+    });
+
+    DrmQueryCache cache("cacheDir", "key");
+    cache.store(1u, 0u, {1, 2, 3});
+    EXPECT_TRUE(cache.save());
+    EXPECT_FALSE(cache.isDirty());
+    EXPECT_EQ(1, SysCalls::renameCalled);
+    EXPECT_EQ(cache.getFilePath(), renamedTo);
+}
+
+TEST(DrmQueryCacheTest, givenReadableGucInfoWhenGettingFirmwareIdentityThenLoadedGucVersionIsReturned) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    drm.setPciPath("device");
+
+    auto firmwareIdentity = drm.getFirmwareIdentity("i915");
+    EXPECT_NE(std::string::npos, firmwareIdentity.find("i915/dg2_guc_70.bin"));
+    EXPECT_NE(std::string::npos, firmwareIdentity.find("found 70.5.1"));
+}
+
+TEST(DrmQueryCacheTest, givenNoGucInfoWhenGettingFirmwareIdentityThenModificationTimeOfFirmwareDirectoryIsReturned) {
+    VariableBackup<decltype(SysCalls::sysCallsStat)> statBackup(&SysCalls::sysCallsStat, [](const std::string &filePath, struct stat *statbuf) -> int {
+        statbuf->st_mtime = 1234;
+        return 0;
+    });
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    drm.setPciPath("invalidPci");
+
+    auto firmwareIdentity = drm.getFirmwareIdentity("i915");
+    EXPECT_EQ(0u, firmwareIdentity.find(Os::firmwarePathPrefix));
+    EXPECT_NE(std::string::npos, firmwareIdentity.find("@1234"));
+}
+
+TEST(DrmQueryCacheTest, givenNoGucInfoAndNoFirmwareDirectoryWhenGettingFirmwareIdentityThenEmptyIdentityIsReturned) {
+    VariableBackup<decltype(SysCalls::sysCallsStat)> statBackup(&SysCalls::sysCallsStat, [](const std::string &filePath, struct stat *statbuf) -> int {
+        return -1;
+    });
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    drm.setPciPath("invalidPci");
+
+    EXPECT_TRUE(drm.getFirmwareIdentity("i915").empty());
+}
+
+TEST(DrmQueryCacheTest, givenQueryCacheSavedByPreviousInitializationWhenSettingUpHardwareInfoAgainThenCachedQueriesAreNotIssuedToKmd) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DeviceQueryCacheDir.set(".");
+
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    *executionEnvironment->rootDeviceEnvironments[0]->getMutableHardwareInfo() = *defaultHwInfo;
+    auto hwInfo = executionEnvironment->rootDeviceEnvironments[0]->getMutableHardwareInfo();
+    auto setupHardwareInfo = [](HardwareInfo *, bool, const CompilerProductHelper &) {};
+    DeviceDescriptor device = {0, hwInfo, setupHardwareInfo};
+
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    drm.setPciPath("device");
+    EXPECT_EQ(0, drm.setupHardwareInfo(&device, false));
+    ASSERT_NE(nullptr, drm.queryCache);
+    EXPECT_NE(0u, drm.queryCache->getNumEntries());
+    auto queriesWithoutCache = drm.ioctlCount.query.load();
+    EXPECT_NE(0, queriesWithoutCache);
+
+    // ULT file io keeps written files virtual, publish the saved cache as a previous process would
+    auto cacheFilePath = drm.queryCache->getFilePath();
+    auto fileData = drm.queryCache->serialize();
+    {
+        std::ofstream cacheFile(cacheFilePath, std::ios::binary);
+        cacheFile.write(fileData.data(), fileData.size());
+    }
+
+    DrmMock secondDrm{*executionEnvironment->rootDeviceEnvironments[0]};
+    secondDrm.setPciPath("device");
+    EXPECT_EQ(0, secondDrm.setupHardwareInfo(&device, false));
+    ASSERT_NE(nullptr, secondDrm.queryCache);
+    EXPECT_EQ(drm.queryCache->getNumEntries(), secondDrm.queryCache->getNumEntries());
+    EXPECT_FALSE(secondDrm.queryCache->isDirty());
+    EXPECT_LT(secondDrm.ioctlCount.query.load(), queriesWithoutCache);
+
+    std::remove(cacheFilePath.c_str());
+}
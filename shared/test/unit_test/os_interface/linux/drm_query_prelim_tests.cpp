@@ -388,6 +388,38 @@ TEST(DrmBufferObjectTestPrelim, givenBufferObjectSetToColourWithBindWhenBindingT
     EXPECT_EQ(drm.context.receivedVmBind->start, 0xffeeffee);
 }
 
+TEST(DrmBufferObjectTestPrelim, givenIoctlHelperWithoutArrayBindWhenChangingBindingOfBufferObjectsThenEachBufferObjectIsBoundWithItsOwnUserFence) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    executionEnvironment->rootDeviceEnvironments[0]->initGmm();
+    executionEnvironment->initializeMemoryManager();
+    DrmQueryMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    drm.pageFaultSupported = true;
+    ASSERT_FALSE(drm.getIoctlHelper()->isVmBindBatchSupported());
+
+    BufferObjectMock bo0(0u, &drm, 3, 1, 0, 1);
+    BufferObjectMock bo1(0u, &drm, 3, 2, 0, 1);
+    bo0.requireExplicitResidency(true);
+    bo1.requireExplicitResidency(true);
+    OsContextLinux osContext(drm, 0, 0u, EngineDescriptorHelper::getDefaultDescriptor());
+    osContext.ensureContextInitialized();
+
+    auto fenceValueBefore = drm.fenceVal[0];
+    std::vector<BufferObject *> bufferObjects = {&bo0, &bo1};
+    EXPECT_EQ(0, drm.changeBufferObjectsBinding(&osContext, 0, bufferObjects, true));
+
+    EXPECT_EQ(2u, drm.context.vmBindCalled);
+    EXPECT_EQ(fenceValueBefore + 2, drm.fenceVal[0]);
+    ASSERT_TRUE(drm.context.receivedVmBindUserFence);
+    EXPECT_EQ(drm.fenceVal[0], drm.context.receivedVmBindUserFence->val);
+    EXPECT_TRUE(bo0.bindInfo[0][0]);
+    EXPECT_TRUE(bo1.bindInfo[0][0]);
+
+    EXPECT_EQ(0, drm.changeBufferObjectsBinding(&osContext, 0, bufferObjects, false));
+    EXPECT_EQ(2u, drm.context.vmUnbindCalled);
+    EXPECT_FALSE(bo0.bindInfo[0][0]);
+    EXPECT_FALSE(bo1.bindInfo[0][0]);
+}
+
 TEST(DrmBufferObjectTestPrelim, givenPageFaultNotSupportedWhenCallingCreateDrmVirtualMemoryThenDontEnablePageFaultsOnVirtualMemory) {
     auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
     DrmQueryMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
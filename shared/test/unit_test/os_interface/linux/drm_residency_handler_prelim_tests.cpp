@@ -668,6 +668,75 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, whenMakeResidentTwiceThenAllocIsBound
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenVmBindBatchingWhenMakeResidentMultipleAllocationsThenEachBoIsBoundOnceAndAllocationsAreResident) {
+    DebugManager.flags.EnableVmBindBatching.set(1);
+
+    GraphicsAllocation *allocations[3] = {};
+    for (auto &allocation : allocations) {
+        allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    }
+
+    EXPECT_EQ(operationHandler->makeResident(device, ArrayRef<GraphicsAllocation *>(allocations)), MemoryOperationsStatus::SUCCESS);
+    EXPECT_EQ(operationHandler->makeResident(device, ArrayRef<GraphicsAllocation *>(allocations)), MemoryOperationsStatus::SUCCESS);
+    for (auto &allocation : allocations) {
+        EXPECT_EQ(operationHandler->isResident(device, *allocation), MemoryOperationsStatus::SUCCESS);
+    }
+
+    EXPECT_EQ(mock->context.vmBindCalled, 6u);
+
+    for (auto &allocation : allocations) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenVmBindBatchingWhenRunningOutOfMemoryThenUnusedAllocationsAreUnbound) {
+    DebugManager.flags.EnableVmBindBatching.set(1);
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+
+    for (auto &engine : device->getAllEngines()) {
+        *engine.commandStreamReceiver->getTagAddress() = 10;
+        allocation->updateTaskCount(8u, engine.osContext->getContextId());
+        EXPECT_EQ(operationHandler->makeResidentWithinOsContext(engine.osContext, ArrayRef<GraphicsAllocation *>(&allocation, 1), true), MemoryOperationsStatus::SUCCESS);
+    }
+
+    EXPECT_EQ(mock->context.vmBindCalled, 2u);
+
+    operationHandler->evictUnusedAllocations(false, true);
+
+    EXPECT_EQ(mock->context.vmBindCalled, 2u);
+    EXPECT_EQ(mock->context.vmUnbindCalled, 2u);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenVmBindBatchingWhenUnbindFailsDuringEvictionThenFailureIsReturnedAndAllocationStaysResident) {
+    DebugManager.flags.EnableVmBindBatching.set(1);
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+
+    for (auto &engine : device->getAllEngines()) {
+        *engine.commandStreamReceiver->getTagAddress() = 10;
+        allocation->updateTaskCount(8u, engine.osContext->getContextId());
+        EXPECT_EQ(operationHandler->makeResidentWithinOsContext(engine.osContext, ArrayRef<GraphicsAllocation *>(&allocation, 1), true), MemoryOperationsStatus::SUCCESS);
+        allocation->updateResidencyTaskCount(8u, engine.osContext->getContextId());
+    }
+
+    mock->context.vmUnbindReturn = -1;
+    EXPECT_EQ(operationHandler->evictUnusedAllocations(false, true), MemoryOperationsStatus::FAILED);
+
+    for (auto &engine : device->getAllEngines()) {
+        EXPECT_TRUE(allocation->isResident(engine.osContext->getContextId()));
+    }
+
+    mock->context.vmUnbindReturn = 0;
+    EXPECT_EQ(operationHandler->evictUnusedAllocations(false, true), MemoryOperationsStatus::SUCCESS);
+
+    for (auto &engine : device->getAllEngines()) {
+        EXPECT_FALSE(allocation->isResident(engine.osContext->getContextId()));
+    }
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 TEST_F(DrmMemoryOperationsHandlerBindTest, WhenVmBindAvaialableThenMemoryManagerReturnsSupportForIndirectAllocationsAsPack) {
     mock->bindAvailable = true;
     EXPECT_TRUE(memoryManager->allowIndirectAllocationsAsPack(0u));
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_userptr_cache.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+namespace {
+// the cache never dereferences stored BOs
+BufferObject *fakeBo(uintptr_t value) {
+    return reinterpret_cast<BufferObject *>(value);
+}
+} // namespace
+
+TEST(DrmUserptrCacheTest, givenEmptyCacheWhenAcquiringThenMissIsCountedAndNullptrReturned) {
+    DrmUserptrCache cache(4);
+
+    EXPECT_EQ(nullptr, cache.acquire(0u, 0x1000, 0x1000));
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(0u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+}
+
+TEST(DrmUserptrCacheTest, givenReleasedBoWhenAcquiringSameRangeThenBoIsReturnedAndRemovedFromCache) {
+    DrmUserptrCache cache(4);
+    std::vector<BufferObject *> bosToDestroy;
+
+    cache.release(0u, 0x1000, 0x1000, fakeBo(0x10), bosToDestroy);
+    EXPECT_TRUE(bosToDestroy.empty());
+    EXPECT_EQ(1u, cache.getNumEntries());
+
+    EXPECT_EQ(nullptr, cache.acquire(1u, 0x1000, 0x1000));
+    EXPECT_EQ(nullptr, cache.acquire(0u, 0x1000, 0x2000));
+    EXPECT_EQ(fakeBo(0x10), cache.acquire(0u, 0x1000, 0x1000));
+    EXPECT_EQ(0u, cache.getNumEntries());
+
+    auto statistics = cache.getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(2u, statistics.misses);
+}
+
+TEST(DrmUserptrCacheTest, givenFullCacheWhenReleasingBoThenLeastRecentlyReleasedBoIsEvicted) {
+    DrmUserptrCache cache(2);
+    std::vector<BufferObject *> bosToDestroy;
+
+    cache.release(0u, 0x1000, 0x1000, fakeBo(0x10), bosToDestroy);
+    cache.release(0u, 0x2000, 0x1000, fakeBo(0x20), bosToDestroy);
+    cache.release(0u, 0x3000, 0x1000, fakeBo(0x30), bosToDestroy);
+
+    ASSERT_EQ(1u, bosToDestroy.size());
+    EXPECT_EQ(fakeBo(0x10), bosToDestroy[0]);
+    EXPECT_EQ(2u, cache.getNumEntries());
+    EXPECT_EQ(1u, cache.getStatistics().evictions);
+    EXPECT_EQ(nullptr, cache.acquire(0u, 0x1000, 0x1000));
+
+    cache.releaseAll(bosToDestroy);
+    EXPECT_EQ(3u, bosToDestroy.size());
+}
+
+TEST(DrmUserptrCacheTest, givenRangeAlreadyCachedWhenReleasingAnotherBoForSameRangeThenNewBoIsReturnedForDestruction) {
+    DrmUserptrCache cache(4);
+    std::vector<BufferObject *> bosToDestroy;
+
+    cache.release(0u, 0x1000, 0x1000, fakeBo(0x10), bosToDestroy);
+    cache.release(0u, 0x1000, 0x1000, fakeBo(0x20), bosToDestroy);
+
+    ASSERT_EQ(1u, bosToDestroy.size());
+    EXPECT_EQ(fakeBo(0x20), bosToDestroy[0]);
+    EXPECT_EQ(fakeBo(0x10), cache.acquire(0u, 0x1000, 0x1000));
+}
+
+TEST(DrmUserptrCacheTest, givenZeroMaxEntriesWhenReleasingBoThenBoIsNotCached) {
+    DrmUserptrCache cache(0);
+    std::vector<BufferObject *> bosToDestroy;
+
+    cache.release(0u, 0x1000, 0x1000, fakeBo(0x10), bosToDestroy);
+
+    EXPECT_EQ(1u, bosToDestroy.size());
+    EXPECT_EQ(0u, cache.getNumEntries());
+}
+
+TEST(DrmUserptrCacheTest, givenCachedRangesWhenInvalidatingRangeThenOnlyOverlappingEntriesOfAllRootDevicesAreRemoved) {
+    DrmUserptrCache cache(8);
+    std::vector<BufferObject *> bosToDestroy;
+
+    cache.release(0u, 0x1000, 0x1000, fakeBo(0x10), bosToDestroy);
+    cache.release(0u, 0x2000, 0x4000, fakeBo(0x20), bosToDestroy);
+    cache.release(1u, 0x5000, 0x1000, fakeBo(0x30), bosToDestroy);
+    cache.release(0u, 0x6000, 0x1000, fakeBo(0x40), bosToDestroy);
+    ASSERT_TRUE(bosToDestroy.empty());
+
+    cache.invalidateRange(0x4000, 0x2000, bosToDestroy);
+
+    ASSERT_EQ(2u, bosToDestroy.size());
+    EXPECT_EQ(fakeBo(0x20), bosToDestroy[0]);
+    EXPECT_EQ(fakeBo(0x30), bosToDestroy[1]);
+    EXPECT_EQ(2u, cache.getNumEntries());
+    EXPECT_EQ(2u, cache.getStatistics().invalidations);
+
+    EXPECT_EQ(fakeBo(0x10), cache.acquire(0u, 0x1000, 0x1000));
+    EXPECT_EQ(fakeBo(0x40), cache.acquire(0u, 0x6000, 0x1000));
+}
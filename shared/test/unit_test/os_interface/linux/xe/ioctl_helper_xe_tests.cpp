@@ -649,6 +649,10 @@ class DrmMockXe : public DrmMockCustom {
             ret = gemVmBindReturn;
             auto vmBindInput = static_cast<drm_xe_vm_bind *>(arg);
             vmBindInputs.push_back(*vmBindInput);
+            if (vmBindInput->num_binds > 1) {
+                auto bindOperations = reinterpret_cast<drm_xe_vm_bind_op *>(vmBindInput->vector_of_binds);
+                vmBindOpInputs.insert(vmBindOpInputs.end(), bindOperations, bindOperations + vmBindInput->num_binds);
+            }
 
             EXPECT_EQ(1u, vmBindInput->num_syncs);
 
@@ -689,6 +693,7 @@ class DrmMockXe : public DrmMockCustom {
 
     StackVec<drm_xe_wait_user_fence, 1> waitUserFenceInputs;
     StackVec<drm_xe_vm_bind, 1> vmBindInputs;
+    std::vector<drm_xe_vm_bind_op> vmBindOpInputs;
     StackVec<drm_xe_sync, 1> syncInputs;
     int waitUserFenceReturn = 0;
 };
@@ -1187,6 +1192,108 @@ TEST(IoctlHelperXeTest, whenUserFenceFailsThenErrorIsPropagated) {
     EXPECT_EQ(errorValue, xeIoctlHelper->vmUnbind(vmBindParams));
 }
 
+TEST(IoctlHelperXeTest, whenCallingVmBindBatchThenAllOperationsAreSubmittedInSingleIoctlWithFenceOfLastOperation) {
+    DebugManagerStateRestore restorer;
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMockXe drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    auto xeIoctlHelper = std::make_unique<MockIoctlHelperXe>(drm);
+
+    uint64_t fenceAddress = 0x4321;
+    uint64_t fenceValue = 0x789;
+
+    std::vector<VmBindParams> vmBindParams(3);
+    for (uint32_t i = 0; i < vmBindParams.size(); i++) {
+        BindInfo mockBindInfo{};
+        mockBindInfo.handle = 0x1234 + i;
+        xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+
+        vmBindParams[i].handle = mockBindInfo.handle;
+        vmBindParams[i].start = 0x10000 * (i + 1);
+        vmBindParams[i].length = MemoryConstants::pageSize64k;
+    }
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, fenceAddress, fenceValue, 0u);
+    vmBindParams.back().extensions = castToUint64(&vmBindExtUserFence);
+
+    drm.vmBindInputs.clear();
+    drm.syncInputs.clear();
+    drm.waitUserFenceInputs.clear();
+    size_t numCompleted = 0;
+    EXPECT_EQ(0, xeIoctlHelper->vmBindBatch(vmBindParams, true, numCompleted));
+    EXPECT_EQ(vmBindParams.size(), numCompleted);
+
+    ASSERT_EQ(1u, drm.vmBindInputs.size());
+    EXPECT_EQ(3u, drm.vmBindInputs[0].num_binds);
+    ASSERT_EQ(3u, drm.vmBindOpInputs.size());
+    for (uint32_t i = 0; i < vmBindParams.size(); i++) {
+        EXPECT_EQ(vmBindParams[i].handle, drm.vmBindOpInputs[i].obj);
+        EXPECT_EQ(vmBindParams[i].start, drm.vmBindOpInputs[i].addr);
+        EXPECT_EQ(static_cast<uint32_t>(XE_VM_BIND_OP_MAP | XE_VM_BIND_FLAG_ASYNC), drm.vmBindOpInputs[i].op);
+    }
+
+    ASSERT_EQ(1u, drm.syncInputs.size());
+    EXPECT_EQ(fenceAddress, drm.syncInputs[0].addr);
+    EXPECT_EQ(fenceValue, drm.syncInputs[0].timeline_value);
+    ASSERT_EQ(1u, drm.waitUserFenceInputs.size());
+    EXPECT_EQ(fenceAddress, drm.waitUserFenceInputs[0].addr);
+    EXPECT_EQ(fenceValue, drm.waitUserFenceInputs[0].value);
+    EXPECT_EQ(static_cast<int64_t>(3 * XE_ONE_SEC), drm.waitUserFenceInputs[0].timeout);
+
+    drm.vmBindInputs.clear();
+    drm.vmBindOpInputs.clear();
+    drm.waitUserFenceInputs.clear();
+    EXPECT_EQ(0, xeIoctlHelper->vmBindBatch(vmBindParams, false, numCompleted));
+    EXPECT_EQ(vmBindParams.size(), numCompleted);
+    ASSERT_EQ(1u, drm.vmBindInputs.size());
+    ASSERT_EQ(3u, drm.vmBindOpInputs.size());
+    for (uint32_t i = 0; i < vmBindParams.size(); i++) {
+        EXPECT_EQ(0u, drm.vmBindOpInputs[i].obj);
+        EXPECT_EQ(static_cast<uint32_t>(XE_VM_BIND_OP_UNMAP | XE_VM_BIND_FLAG_ASYNC), drm.vmBindOpInputs[i].op);
+    }
+    EXPECT_EQ(1u, drm.waitUserFenceInputs.size());
+}
+
+TEST(IoctlHelperXeTest, whenVmBindBatchFailsThenOnlySubmittedOperationsAreReportedAsCompleted) {
+    DebugManagerStateRestore restorer;
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMockXe drm{*executionEnvironment->rootDeviceEnvironments[0]};
+    auto xeIoctlHelper = std::make_unique<MockIoctlHelperXe>(drm);
+
+    std::vector<VmBindParams> vmBindParams(2);
+    for (uint32_t i = 0; i < vmBindParams.size(); i++) {
+        BindInfo mockBindInfo{};
+        mockBindInfo.handle = 0x1234 + i;
+        xeIoctlHelper->bindInfo.push_back(mockBindInfo);
+        vmBindParams[i].handle = mockBindInfo.handle;
+    }
+
+    VmBindExtUserFenceT vmBindExtUserFence{};
+    xeIoctlHelper->fillVmBindExtUserFence(vmBindExtUserFence, 0x4321, 0x789, 0u);
+    vmBindParams.back().extensions = castToUint64(&vmBindExtUserFence);
+
+    drm.waitUserFenceInputs.clear();
+    size_t numCompleted = 1;
+    drm.gemVmBindReturn = -1;
+    EXPECT_EQ(-1, xeIoctlHelper->vmBindBatch(vmBindParams, true, numCompleted));
+    EXPECT_EQ(0u, numCompleted);
+    EXPECT_EQ(0u, drm.waitUserFenceInputs.size());
+
+    drm.gemVmBindReturn = 0;
+    drm.waitUserFenceReturn = -1;
+    numCompleted = 0;
+    EXPECT_EQ(-1, xeIoctlHelper->vmBindBatch(vmBindParams, true, numCompleted));
+    EXPECT_EQ(vmBindParams.size(), numCompleted);
+    EXPECT_EQ(1u, drm.waitUserFenceInputs.size());
+
+    vmBindParams[0].handle = 0x4321;
+    drm.waitUserFenceReturn = 0;
+    drm.vmBindInputs.clear();
+    EXPECT_EQ(-1, xeIoctlHelper->vmBindBatch(vmBindParams, true, numCompleted));
+    EXPECT_EQ(0u, numCompleted);
+    EXPECT_EQ(0u, drm.vmBindInputs.size());
+}
+
 TEST(IoctlHelperXeTest, WhenSetupIpVersionIsCalledThenIpVersionIsCorrect) {
     auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
     DrmMockXe drm{*executionEnvironment->rootDeviceEnvironments[0]};
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/worker_pool.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(WorkerPoolTest, givenWorkerPoolWhenRunningParallelForThenEveryTaskIndexIsExecutedExactlyOnce) {
+    WorkerPool workerPool(3u);
+    constexpr size_t numTasks = 16u;
+    std::vector<std::atomic<uint32_t>> executions(numTasks);
+
+    workerPool.parallelFor(numTasks, [&executions](size_t taskIndex) {
+        executions[taskIndex]++;
+    });
+
+    for (auto &execution : executions) {
+        EXPECT_EQ(1u, execution.load());
+    }
+}
+
+TEST(WorkerPoolTest, givenWorkerPoolWhenRunningParallelForMultipleTimesThenWorkersAreCreatedOnceAndReused) {
+    WorkerPool workerPool(2u);
+    EXPECT_EQ(0u, workerPool.getNumWorkers());
+
+    std::atomic<uint32_t> executions{0u};
+    auto task = [&executions](size_t taskIndex) { executions++; };
+
+    workerPool.parallelFor(8u, task);
+    EXPECT_EQ(8u, executions.load());
+    EXPECT_EQ(2u, workerPool.getNumWorkers());
+
+    workerPool.parallelFor(8u, task);
+    EXPECT_EQ(16u, executions.load());
+    EXPECT_EQ(2u, workerPool.getNumWorkers());
+}
+
+TEST(WorkerPoolTest, givenFewerTasksThanMaxWorkersWhenRunningParallelForThenOnlyNeededWorkersAreCreated) {
+    WorkerPool workerPool(8u);
+
+    workerPool.parallelFor(3u, [](size_t taskIndex) {});
+    EXPECT_EQ(2u, workerPool.getNumWorkers());
+
+    workerPool.parallelFor(1u, [](size_t taskIndex) {});
+    EXPECT_EQ(2u, workerPool.getNumWorkers());
+}
+
+TEST(WorkerPoolTest, givenWorkerPoolWithoutWorkersWhenRunningParallelForThenTasksAreExecutedInOrderOnCallingThread) {
+    WorkerPool workerPool(0u);
+    auto callingThreadId = std::this_thread::get_id();
+    std::vector<size_t> executedTasks;
+
+    workerPool.parallelFor(4u, [&](size_t taskIndex) {
+        EXPECT_EQ(callingThreadId, std::this_thread::get_id());
+        executedTasks.push_back(taskIndex);
+    });
+
+    EXPECT_EQ(0u, workerPool.getNumWorkers());
+    EXPECT_EQ((std::vector<size_t>{0u, 1u, 2u, 3u}), executedTasks);
+}